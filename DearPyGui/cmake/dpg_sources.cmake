@@ -3,6 +3,7 @@ set(MARVEL_SOURCES
 
 	# core
 	"src/core/mvContext.cpp"
+	"src/core/mvFrameSignal.cpp"
 	"src/core/mvMath.cpp"
 	"src/core/mvProfiler.cpp"
 
@@ -53,6 +54,10 @@ set(MARVEL_SOURCES
 	"src/ui/AppItems/textures/mvStaticTexture.cpp"
 	"src/ui/AppItems/textures/mvDynamicTexture.cpp"
 	"src/ui/AppItems/textures/mvTextureRegistry.cpp"
+	"src/ui/AppItems/textures/mvTexturePixels.cpp"
+	"src/ui/AppItems/textures/mvTextureRegions.cpp"
+	"src/ui/AppItems/textures/mvImageDecoder.cpp"
+	"src/ui/AppItems/textures/mvTextureAtlas.cpp"
 	"src/ui/AppItems/basic/mvMenuItem.cpp"
 	"src/ui/AppItems/basic/mvText.cpp"
 	"src/ui/AppItems/basic/mvSlider.cpp"
@@ -101,6 +106,8 @@ set(MARVEL_SOURCES
 	"src/ui/AppItems/tables/mvTableColumn.cpp"
 	"src/ui/AppItems/tables/mvTableRow.cpp"
 	"src/ui/AppItems/tables/mvTableCell.cpp"
+	"src/ui/AppItems/tables/mvTableData.cpp"
+	"src/ui/AppItems/tables/mvTableSort.cpp"
 	"src/ui/AppItems/custom/mvDatePicker.cpp"
 	"src/ui/AppItems/custom/mvTimePicker.cpp"
 	"src/ui/AppItems/custom/mvSlider3D.cpp"
@@ -145,6 +152,9 @@ set(MARVEL_SOURCES
 	"src/ui/AppItems/plots/mvDragLine.cpp"
 	"src/ui/AppItems/plots/mvAnnotation.cpp"
 	"src/ui/AppItems/plots/mvSimplePlot.cpp"
+	"src/ui/AppItems/plots/mvSeriesBuffer.cpp"
+	"src/ui/AppItems/plots/mvSeriesDecimation.cpp"
+	"src/ui/AppItems/plots/mvSeriesPyramid.cpp"
 	"src/ui/AppItems/plots/mvLineSeries.cpp"
 	"src/ui/AppItems/plots/mvScatterSeries.cpp"
 	"src/ui/AppItems/plots/mvStemSeries.cpp"
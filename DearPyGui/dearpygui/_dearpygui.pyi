@@ -18,11 +18,11 @@ def add_alias(alias : str, item : Union[int, str]) -> None:
 	"""Adds an alias."""
 	...
 
-def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', fill: Union[List[int], Tuple[int, ...]] ='', contribute_to_bounds: bool ='') -> Union[int, str]:
+def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', fill: Union[List[int], Tuple[int, ...]] ='', contribute_to_bounds: bool ='', zero_copy: bool ='', downsample: int ='', sorted_x: bool ='') -> Union[int, str]:
 	"""Adds an area series to a plot."""
 	...
 
-def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', weight: float ='', horizontal: bool ='') -> Union[int, str]:
+def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', weight: float ='', horizontal: bool ='', zero_copy: bool ='') -> Union[int, str]:
 	"""Adds a bar series to a plot."""
 	...
 
@@ -150,7 +150,7 @@ def add_drawlist(width : int, height : int, *, label: str ='', user_data: Any ='
 	"""Adds a drawing canvas."""
 	...
 
-def add_dynamic_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='') -> Union[int, str]:
+def add_dynamic_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', format: int ='', streaming: bool ='', parent: Union[int, str] ='') -> Union[int, str]:
 	"""Adds a dynamic texture."""
 	...
 
@@ -210,7 +210,7 @@ def add_handler_registry(*, label: str ='', user_data: Any ='', use_internal_lab
 	"""Adds a handler registry."""
 	...
 
-def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols : int, *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', scale_min: float ='', scale_max: float ='', bounds_min: Any ='', bounds_max: Any ='', format: str ='', contribute_to_bounds: bool ='') -> Union[int, str]:
+def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols : int, *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', scale_min: float ='', scale_max: float ='', bounds_min: Any ='', bounds_max: Any ='', format: str ='', contribute_to_bounds: bool ='', use_texture: bool ='') -> Union[int, str]:
 	"""Adds a heat series to a plot."""
 	...
 
@@ -326,7 +326,7 @@ def add_knob_float(*, label: str ='', user_data: Any ='', use_internal_label: bo
 	"""Adds a knob that rotates based on change in x mouse position."""
 	...
 
-def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='') -> Union[int, str]:
+def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', zero_copy: bool ='', capacity: int ='', downsample: int ='', sorted_x: bool ='', lod: bool ='') -> Union[int, str]:
 	"""Adds a line series to a plot."""
 	...
 
@@ -422,11 +422,11 @@ def add_radio_button(items : Union[List[str], Tuple[str, ...]] ='', *, label: st
 	"""Adds a set of radio buttons. If items keyword is empty, nothing will be shown."""
 	...
 
-def add_raw_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', format: int ='', parent: Union[int, str] ='') -> Union[int, str]:
+def add_raw_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', format: int ='', full_upload: bool ='', streaming: bool ='', parent: Union[int, str] ='') -> Union[int, str]:
 	"""Adds a raw texture."""
 	...
 
-def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='') -> Union[int, str]:
+def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', zero_copy: bool ='', capacity: int ='', sorted_x: bool ='') -> Union[int, str]:
 	"""Adds a scatter series to a plot."""
 	...
 
@@ -442,7 +442,7 @@ def add_series_value(*, label: str ='', user_data: Any ='', use_internal_label:
 	"""Adds a plot series value."""
 	...
 
-def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', y2: Any ='') -> Union[int, str]:
+def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', y2: Any ='', zero_copy: bool ='', downsample: int ='', sorted_x: bool ='') -> Union[int, str]:
 	"""Adds a shade series to a plot."""
 	...
 
@@ -474,15 +474,15 @@ def add_stage(*, label: str ='', user_data: Any ='', use_internal_label: bool ='
 	"""Adds a stage."""
 	...
 
-def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='') -> Union[int, str]:
+def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', zero_copy: bool ='', capacity: int ='', downsample: int ='', sorted_x: bool ='', lod: bool ='') -> Union[int, str]:
 	"""Adds a stair series to a plot."""
 	...
 
-def add_static_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', parent: Union[int, str] ='') -> Union[int, str]:
+def add_static_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', format: int ='', file: str ='', parent: Union[int, str] ='') -> Union[int, str]:
 	"""Adds a static texture."""
 	...
 
-def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', indent: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='') -> Union[int, str]:
+def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', indent: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', show: bool ='', zero_copy: bool ='', sorted_x: bool ='') -> Union[int, str]:
 	"""Adds a stem series to a plot."""
 	...
 
@@ -506,7 +506,7 @@ def add_tab_button(*, label: str ='', user_data: Any ='', use_internal_label: bo
 	"""Adds a tab button to a tab bar."""
 	...
 
-def add_table(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', width: int ='', height: int ='', indent: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', callback: Callable ='', show: bool ='', pos: Union[List[int], Tuple[int, ...]] ='', filter_key: str ='', delay_search: bool ='', header_row: bool ='', clipper: bool ='', inner_width: int ='', policy: int ='', freeze_rows: int ='', freeze_columns: int ='', sort_multi: bool ='', sort_tristate: bool ='', resizable: bool ='', reorderable: bool ='', hideable: bool ='', sortable: bool ='', context_menu_in_body: bool ='', row_background: bool ='', borders_innerH: bool ='', borders_outerH: bool ='', borders_innerV: bool ='', borders_outerV: bool ='', no_host_extendX: bool ='', no_host_extendY: bool ='', no_keep_columns_visible: bool ='', precise_widths: bool ='', no_clip: bool ='', pad_outerX: bool ='', no_pad_outerX: bool ='', no_pad_innerX: bool ='', scrollX: bool ='', scrollY: bool ='', no_saved_settings: bool ='') -> Union[int, str]:
+def add_table(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', width: int ='', height: int ='', indent: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', source: Union[int, str] ='', callback: Callable ='', show: bool ='', pos: Union[List[int], Tuple[int, ...]] ='', filter_key: str ='', delay_search: bool ='', header_row: bool ='', clipper: bool ='', inner_width: int ='', policy: int ='', freeze_rows: int ='', freeze_columns: int ='', sort_multi: bool ='', sort_tristate: bool ='', resizable: bool ='', reorderable: bool ='', hideable: bool ='', sortable: bool ='', context_menu_in_body: bool ='', row_background: bool ='', borders_innerH: bool ='', borders_outerH: bool ='', borders_innerV: bool ='', borders_outerV: bool ='', no_host_extendX: bool ='', no_host_extendY: bool ='', no_keep_columns_visible: bool ='', precise_widths: bool ='', no_clip: bool ='', pad_outerX: bool ='', no_pad_outerX: bool ='', no_pad_innerX: bool ='', scrollX: bool ='', scrollY: bool ='', no_saved_settings: bool ='', native_sort: bool ='') -> Union[int, str]:
 	"""Adds a table."""
 	...
 
@@ -514,7 +514,7 @@ def add_table_cell(*, label: str ='', user_data: Any ='', use_internal_label: bo
 	"""Adds a table."""
 	...
 
-def add_table_column(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', width: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', show: bool ='', enabled: bool ='', init_width_or_weight: float ='', default_hide: bool ='', default_sort: bool ='', width_stretch: bool ='', width_fixed: bool ='', no_resize: bool ='', no_reorder: bool ='', no_hide: bool ='', no_clip: bool ='', no_sort: bool ='', no_sort_ascending: bool ='', no_sort_descending: bool ='', no_header_width: bool ='', prefer_sort_ascending: bool ='', prefer_sort_descending: bool ='', indent_enable: bool ='', indent_disable: bool ='') -> Union[int, str]:
+def add_table_column(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', width: int ='', parent: Union[int, str] ='', before: Union[int, str] ='', show: bool ='', enabled: bool ='', init_width_or_weight: float ='', default_hide: bool ='', default_sort: bool ='', width_stretch: bool ='', width_fixed: bool ='', no_resize: bool ='', no_reorder: bool ='', no_hide: bool ='', no_clip: bool ='', no_sort: bool ='', no_sort_ascending: bool ='', no_sort_descending: bool ='', no_header_width: bool ='', prefer_sort_ascending: bool ='', prefer_sort_descending: bool ='', indent_enable: bool ='', indent_disable: bool ='', sort_key: int ='') -> Union[int, str]:
 	"""Adds a table column."""
 	...
 
@@ -534,7 +534,7 @@ def add_text_point(x : float, y : float, *, label: str ='', user_data: Any ='',
 	"""Adds a label series to a plot."""
 	...
 
-def add_texture_registry(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', show: bool ='') -> Union[int, str]:
+def add_texture_registry(*, label: str ='', user_data: Any ='', use_internal_label: bool ='', tag: Union[int, str] ='', show: bool ='', atlas: bool ='', atlas_page_size: int ='') -> Union[int, str]:
 	"""Adds a dynamic texture."""
 	...
 
@@ -586,6 +586,10 @@ def add_window(*, label: str ='', user_data: Any ='', use_internal_label: bool =
 	"""Creates a new window for following items to be added to."""
 	...
 
+def append_series_data(series : Union[int, str], x : Any, y : Any) -> None:
+	"""Appends samples to a line, scatter or stair series. If the series has a capacity, the oldest samples are overwritten once it is full."""
+	...
+
 def apply_transform(item : Union[int, str], transform : Any) -> None:
 	"""New in 1.1. Applies a transformation matrix to a layer."""
 	...
@@ -630,7 +634,7 @@ def clear_selected_nodes(node_editor : Union[int, str]) -> None:
 	"""Clears a node editor's selected nodes."""
 	...
 
-def configure_app(*, docking: bool ='', docking_space: bool ='', load_init_file: str ='', init_file: str ='', auto_save_init_file: bool ='', device: int ='', auto_device: bool ='', allow_alias_overwrites: bool ='', manual_alias_management: bool ='', skip_required_args: bool ='', skip_positional_args: bool ='', skip_keyword_args: bool ='', wait_for_input: bool ='', **kwargs) -> None:
+def configure_app(*, docking: bool ='', docking_space: bool ='', load_init_file: str ='', init_file: str ='', auto_save_init_file: bool ='', device: int ='', auto_device: bool ='', allow_alias_overwrites: bool ='', manual_alias_management: bool ='', skip_required_args: bool ='', skip_positional_args: bool ='', skip_keyword_args: bool ='', wait_for_input: bool ='', deferred_updates: bool ='', **kwargs) -> None:
 	"""Configures app."""
 	...
 
@@ -638,6 +642,10 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item."""
 	...
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], configs : Any ='', **kwargs) -> None:
+	"""Configures a list of items in one call, either with the same keywords or a config dict per item."""
+	...
+
 def configure_viewport(item : Union[int, str], **kwargs) -> None:
 	"""Configures a viewport."""
 	...
@@ -790,6 +798,10 @@ def get_axis_limits(axis : Union[int, str]) -> Union[List[float], Tuple[float, .
 	"""Get the specified axis limits."""
 	...
 
+def get_callback_statistics(*, reset: bool ='') -> dict:
+	"""Returns the callbacks run so far, the GIL acquisitions it took (batches), their latency from being queued to being called in seconds, the callbacks queued now (queue_depth) and those coalesced into a newer one or dropped by the queue limit."""
+	...
+
 def get_colormap_color(colormap : Union[int, str], index : int) -> Union[List[int], Tuple[int, ...]]:
 	"""Returns a color from a colormap given an index >= 0. (ex. 0 will be the first color in the color list of the color map) Modulo will be performed against the number of items in the color list."""
 	...
@@ -814,6 +826,10 @@ def get_frame_rate() -> float:
 	"""Returns the average frame rate across 120 frames."""
 	...
 
+def get_frame_wakeup_fd() -> int:
+	"""Returns a file descriptor that becomes readable after every rendered frame (eventfd or pipe, drain it after waking up), for event loops to wait on. -1 where unsupported (Windows)."""
+	...
+
 def get_global_font_scale() -> float:
 	"""Returns global font scale."""
 	...
@@ -862,10 +878,18 @@ def get_selected_nodes(node_editor : Union[int, str]) -> Union[List[int], Tuple[
 	"""Returns a node editor's selected nodes."""
 	...
 
+def get_table_data(table : Union[int, str]) -> List[List[str]]:
+	"""Returns the cells of the data bound with set_table_data as they are drawn, one list of strings per column."""
+	...
+
 def get_text_size(text : str, *, wrap_width: float ='', font: Union[int, str] ='') -> Union[List[float], Tuple[float, ...]]:
 	"""Returns width/height of text with specified font (must occur after 1st frame)."""
 	...
 
+def get_texture_pixels(texture : Union[int, str]) -> Any:
+	"""Reads back what the gpu holds for a dynamic or raw texture (in the texture's format) or for the image of a heat series drawn with use_texture (float rgba). Call it from the thread rendering frames."""
+	...
+
 def get_total_time() -> float:
 	"""Returns total time since Dear PyGui has started."""
 	...
@@ -982,10 +1006,14 @@ def last_root() -> Union[int, str]:
 	"""Returns the last root added (registry or window)."""
 	...
 
-def load_image(file : str, *, gamma: float ='', gamma_scale_factor: float ='') -> Any:
+def load_image(file : str, *, gamma: float ='', gamma_scale_factor: float ='', format: int ='') -> Any:
 	"""Loads an image. Returns width, height, channels, mvBuffer"""
 	...
 
+def load_image_async(file : str, callback : Callable, *, gamma: float ='', gamma_scale_factor: float ='', format: int ='', user_data: Any ='') -> Union[int, str]:
+	"""Loads an image on a worker thread (see configure_app decode_threads) and passes it to the callback. Returns the id used as the callback's sender."""
+	...
+
 def lock_mutex() -> None:
 	"""Locks render thread mutex."""
 	...
@@ -1018,6 +1046,10 @@ def push_container_stack(item : Union[int, str]) -> bool:
 	"""Pushes an item onto the container stack."""
 	...
 
+def push_texture_rows(texture : Union[int, str], data : Any) -> None:
+	"""Writes rows at a cursor that wraps around the texture (spectrograms, waterfalls). Images of the texture scroll so the newest row is at the bottom."""
+	...
+
 def remove_alias(alias : str) -> None:
 	"""Removes an alias."""
 	...
@@ -1058,6 +1090,14 @@ def set_axis_ticks(axis : Union[int, str], label_pairs : Any) -> None:
 	"""Replaces axis ticks with 'label_pairs' argument."""
 	...
 
+def set_callback_event_loop(loop : Any) -> None:
+	"""Sets the asyncio event loop coroutine callbacks (async def) are scheduled on as tasks. None stops accepting them."""
+	...
+
+def set_callback_lane(item : Union[int, str], *, lane: str ='', parallel: bool ='') -> None:
+	"""Routes the callbacks of an item (widget or handler) to the callback workers set with configure_app(callback_workers=...). Other callbacks keep their order on the callback thread. Workers still take turns holding the GIL, so only callbacks releasing it (I/O, sleeping, native code) or free-threaded builds overlap."""
+	...
+
 def set_clip_space(item : Union[int, str], top_left_x : float, top_left_y : float, width : float, height : float, min_depth : float, max_depth : float) -> None:
 	"""New in 1.1. Set the clip space for depth clipping and 'viewport' transformation."""
 	...
@@ -1086,14 +1126,26 @@ def set_primary_window(window : Union[int, str], value : bool) -> None:
 	"""Sets the primary window."""
 	...
 
+def set_table_data(table : Union[int, str], columns : List[Any], *, formats: Union[List[str], Tuple[str, ...]] ='') -> None:
+	"""Binds columnar data to a table. Rows are drawn straight from the data (only the visible ones are formatted) instead of from table rows, so tables with millions of rows stay cheap to create and draw."""
+	...
+
 def set_table_row_color(table : Union[int, str], row : int, color : Union[List[int], Tuple[int, ...]]) -> None:
 	"""Set table row color."""
 	...
 
+def set_texture_region(texture : Union[int, str], x : int, y : int, width : int, height : int, *, data: Any ='') -> None:
+	"""Updates a rectangle of a dynamic or raw texture. Only the rectangle is uploaded on the next frame."""
+	...
+
 def set_value(item : Union[int, str], value : Any) -> None:
 	"""Set's an item's value."""
 	...
 
+def set_values(items : Union[List[int], Tuple[int, ...]], values : Any) -> None:
+	"""Set's the values of a list of items."""
+	...
+
 def set_viewport_resize_callback(callback : Callable) -> str:
 	"""Sets a callback to run on viewport resize."""
 	...
@@ -1170,6 +1222,10 @@ def unstage(item : Union[int, str]) -> None:
 	"""Unstages an item."""
 	...
 
+def wait_for_frame(*, frame: int ='') -> int:
+	"""Blocks, without holding the GIL, until a frame has rendered. Returns the last rendered frame, -1 once the context is destroyed."""
+	...
+
 mvMouseButton_Left=0
 mvMouseButton_Right=0
 mvMouseButton_Middle=0
@@ -1411,6 +1467,9 @@ def unstage(item : Union[int, str]) -> None:
 mvPlotMarker_Cross=0
 mvPlotMarker_Plus=0
 mvPlotMarker_Asterisk=0
+mvPlotDownsample_None=0
+mvPlotDownsample_MinMax=0
+mvPlotDownsample_LTTB=0
 mvPlot_Location_Center=0
 mvPlot_Location_North=0
 mvPlot_Location_South=0
@@ -1424,8 +1483,15 @@ def unstage(item : Union[int, str]) -> None:
 mvTable_SizingFixedSame=0
 mvTable_SizingStretchProp=0
 mvTable_SizingStretchSame=0
+mvTable_SortKeyAuto=0
+mvTable_SortKeyText=0
+mvTable_SortKeyNumber=0
 mvFormat_Float_rgba=0
 mvFormat_Float_rgb=0
+mvFormat_Byte_rgba=0
+mvFormat_Byte_r=0
+mvFormat_Byte_rg=0
+mvFormat_Half_rgba=0
 mvThemeCat_Core=0
 mvThemeCat_Plots=0
 mvThemeCat_Nodes=0
@@ -63,6 +63,14 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_item(item, **kwargs)
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], configs : Union[List[dict], Tuple[dict, ...]] =None, **kwargs) -> None:
+	"""Configures a list of items in one call. Applies the same keywords to every item and,
+	when configs is given, configs[i] to items[i] on top of them."""
+	if configs is None:
+		internal_dpg.configure_items(items, **kwargs)
+	else:
+		internal_dpg.configure_items(items, configs, **kwargs)
+
 def configure_app(**kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_app(**kwargs)
@@ -2277,6 +2285,7 @@ def table(**kwargs):
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows internally when the sort specs change instead of running the callback. Stable, multi-column, keyed per column by sort_key.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2368,6 +2377,8 @@ def texture_registry(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		show (bool, optional): Attempt to render widget.
+		atlas (bool, optional): Packs static textures added afterwards into shared pages, so images of them batch into fewer draw calls.
+		atlas_page_size (int, optional): Width and height of new atlas pages, larger static textures get their own texture.
 		id (Union[int, str], optional): (deprecated)
 	Yields:
 		Union[int, str]
@@ -2696,6 +2707,9 @@ def add_area_series(x, y, **kwargs):
 		show (bool, optional): Attempt to render widget.
 		fill (Union[List[int], Tuple[int, ...]], optional): 
 		contribute_to_bounds (bool, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -2719,6 +2733,7 @@ def add_bar_series(x, y, **kwargs):
 		show (bool, optional): Attempt to render widget.
 		weight (float, optional): 
 		horizontal (bool, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -3605,6 +3620,8 @@ def add_dynamic_texture(width, height, default_value, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		format (int, optional): Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is).
+		streaming (bool, optional): Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -3916,6 +3933,7 @@ def add_heat_series(x, rows, cols, **kwargs):
 		bounds_max (Any, optional): 
 		format (str, optional): 
 		contribute_to_bounds (bool, optional): 
+		use_texture (bool, optional): Colorizes the matrix into a texture when the data, scale or colormap change and draws it as a single image. Much faster for large matrices (cell labels are not drawn).
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -4621,6 +4639,11 @@ def add_line_series(x, y, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
+		lod (bool, optional): Builds a min/max level of detail pyramid in the background and draws the level matching the pixel density (large series with sorted x). Ring buffer (capacity) and source series always draw every sample, wrapping shifts every index so no pyramid is kept for them.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5223,7 +5246,9 @@ def add_raw_texture(width, height, default_value, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		format (int, optional): Data format.
+		format (int, optional): Data format, the buffer is uploaded as is so it must match (float32, uint8 for the byte formats, float16 for mvFormat_Half_rgba).
+		full_upload (bool, optional): Uploads the whole buffer every frame. Turn off to upload only the regions reported with set_texture_region/push_texture_rows.
+		streaming (bool, optional): Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -5246,6 +5271,9 @@ def add_scatter_series(x, y, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5339,6 +5367,9 @@ def add_shade_series(x, y1, **kwargs):
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
 		y2 (Any, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5581,6 +5612,11 @@ def add_stair_series(x, y, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
+		lod (bool, optional): Builds a min/max level of detail pyramid in the background and draws the level matching the pixel density (large series with sorted x). Ring buffer (capacity) and source series always draw every sample, wrapping shifts every index so no pyramid is kept for them.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5599,6 +5635,8 @@ def add_static_texture(width, height, default_value, **kwargs):
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		format (int, optional): Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is).
+		file (str, optional): Image file decoded on a worker thread, replaces width, height and default_value once loaded.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated)
 	Returns:
@@ -5622,6 +5660,8 @@ def add_stem_series(x, y, **kwargs):
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5819,6 +5859,7 @@ def add_table(**kwargs):
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows internally when the sort specs change instead of running the callback. Stable, multi-column, keyed per column by sort_key.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5876,6 +5917,7 @@ def add_table_column(**kwargs):
 		prefer_sort_descending (bool, optional): Make the initial sort direction Descending when first sorting on this column.
 		indent_enable (bool, optional): Use current Indent value when entering cell (default for column 0).
 		indent_disable (bool, optional): Ignore current Indent value when entering cell (default for columns > 0). Indentation changes _within_ the cell will still be honored.
+		sort_key (int, optional): How cells are compared by tables with native_sort. mvTable_SortKeyAuto (numbers for numeric values, text otherwise), mvTable_SortKeyText or mvTable_SortKeyNumber. A cell's filter_key is used as its key if set.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -5983,6 +6025,8 @@ def add_texture_registry(**kwargs):
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		show (bool, optional): Attempt to render widget.
+		atlas (bool, optional): Packs static textures added afterwards into shared pages, so images of them batch into fewer draw calls.
+		atlas_page_size (int, optional): Width and height of new atlas pages, larger static textures get their own texture.
 		id (Union[int, str], optional): (deprecated)
 	Returns:
 		Union[int, str]
@@ -6256,6 +6300,19 @@ def add_window(**kwargs):
 
 	return internal_dpg.add_window(**kwargs)
 
+def append_series_data(series, x, y):
+	"""	 Appends samples to a line, scatter or stair series. If the series has a capacity, the oldest samples are overwritten once it is full.
+
+	Args:
+		series (Union[int, str]): 
+		x (Any): Single value, list or buffer of x values.
+		y (Any): Single value, list or buffer of y values.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.append_series_data(series, x, y)
+
 def apply_transform(item, transform):
 	"""	 New in 1.1. Applies a transformation matrix to a layer.
 
@@ -6995,6 +7052,17 @@ def get_axis_limits(axis):
 
 	return internal_dpg.get_axis_limits(axis)
 
+def get_callback_statistics(**kwargs):
+	"""	 Returns the callbacks run so far, the GIL acquisitions it took (batches), their latency from being queued to being called in seconds, the callbacks queued now (queue_depth) and those coalesced into a newer one or dropped by the queue limit.
+
+	Args:
+		reset (bool, optional): Starts counting again after returning.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_callback_statistics(**kwargs)
+
 def get_colormap_color(colormap, index):
 	"""	 Returns a color from a colormap given an index >= 0. (ex. 0 will be the first color in the color list of the color map) Modulo will be performed against the number of items in the color list.
 
@@ -7058,6 +7126,16 @@ def get_frame_rate():
 
 	return internal_dpg.get_frame_rate()
 
+def get_frame_wakeup_fd():
+	"""	 Returns a file descriptor that becomes readable after every rendered frame (eventfd or pipe, drain it after waking up), for event loops to wait on. -1 where unsupported (Windows).
+
+	Args:
+	Returns:
+		int
+	"""
+
+	return internal_dpg.get_frame_wakeup_fd()
+
 def get_global_font_scale():
 	"""	 Returns global font scale.
 
@@ -7186,6 +7264,17 @@ def get_selected_nodes(node_editor):
 
 	return internal_dpg.get_selected_nodes(node_editor)
 
+def get_table_data(table):
+	"""	 Returns the cells of the data bound with set_table_data as they are drawn, one list of strings per column.
+
+	Args:
+		table (Union[int, str]): 
+	Returns:
+		List[List[str]]
+	"""
+
+	return internal_dpg.get_table_data(table)
+
 def get_text_size(text, **kwargs):
 	"""	 Returns width/height of text with specified font (must occur after 1st frame).
 
@@ -7199,6 +7288,17 @@ def get_text_size(text, **kwargs):
 
 	return internal_dpg.get_text_size(text, **kwargs)
 
+def get_texture_pixels(texture):
+	"""	 Reads back what the gpu holds for a dynamic or raw texture (in the texture's format) or for the image of a heat series drawn with use_texture (float rgba). Call it from the thread rendering frames.
+
+	Args:
+		texture (Union[int, str]): 
+	Returns:
+		Any
+	"""
+
+	return internal_dpg.get_texture_pixels(texture)
+
 def get_total_time():
 	"""	 Returns total time since Dear PyGui has started.
 
@@ -7530,12 +7630,29 @@ def load_image(file, **kwargs):
 		file (str): 
 		gamma (float, optional): Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading.
 		gamma_scale_factor (float, optional): Gamma scale factor.
+		format (int, optional): mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray.
 	Returns:
 		Any
 	"""
 
 	return internal_dpg.load_image(file, **kwargs)
 
+def load_image_async(file, callback, **kwargs):
+	"""	 Loads an image on a worker thread (see configure_app decode_threads) and passes it to the callback. Returns the id used as the callback's sender.
+
+	Args:
+		file (str): 
+		callback (Callable): Called with (sender, (width, height, channels, data), user_data) once decoded, app_data is None if the file couldn't be loaded.
+		gamma (float, optional): Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading.
+		gamma_scale_factor (float, optional): Gamma scale factor.
+		format (int, optional): mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray.
+		user_data (Any, optional): User data for the callback.
+	Returns:
+		Union[int, str]
+	"""
+
+	return internal_dpg.load_image_async(file, callback, **kwargs)
+
 def lock_mutex():
 	"""	 Locks render thread mutex.
 
@@ -7622,6 +7739,18 @@ def push_container_stack(item):
 
 	return internal_dpg.push_container_stack(item)
 
+def push_texture_rows(texture, data):
+	"""	 Writes rows at a cursor that wraps around the texture (spectrograms, waterfalls). Images of the texture scroll so the newest row is at the bottom.
+
+	Args:
+		texture (Union[int, str]): 
+		data (Any): Whole rows in the texture's format.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.push_texture_rows(texture, data)
+
 def remove_alias(alias):
 	"""	 Removes an alias.
 
@@ -7737,6 +7866,30 @@ def set_axis_ticks(axis, label_pairs):
 
 	return internal_dpg.set_axis_ticks(axis, label_pairs)
 
+def set_callback_event_loop(loop):
+	"""	 Sets the asyncio event loop coroutine callbacks (async def) are scheduled on as tasks. None stops accepting them.
+
+	Args:
+		loop (Any): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_callback_event_loop(loop)
+
+def set_callback_lane(item, **kwargs):
+	"""	 Routes the callbacks of an item (widget or handler) to the callback workers set with configure_app(callback_workers=...). Other callbacks keep their order on the callback thread. Workers still take turns holding the GIL, so only callbacks releasing it (I/O, sleeping, native code) or free-threaded builds overlap.
+
+	Args:
+		item (Union[int, str]): 
+		lane (str, optional): Callbacks of items sharing a lane run one at a time, in order. Empty runs them on the callback thread again.
+		parallel (bool, optional): Runs the item's callbacks on any worker, with no ordering. They must be thread safe.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_callback_lane(item, **kwargs)
+
 def set_clip_space(item, top_left_x, top_left_y, width, height, min_depth, max_depth):
 	"""	 New in 1.1. Set the clip space for depth clipping and 'viewport' transformation.
 
@@ -7825,6 +7978,19 @@ def set_primary_window(window, value):
 
 	return internal_dpg.set_primary_window(window, value)
 
+def set_table_data(table, columns, **kwargs):
+	"""	 Binds columnar data to a table. Rows are drawn straight from the data (only the visible ones are formatted) instead of from table rows, so tables with millions of rows stay cheap to create and draw.
+
+	Args:
+		table (Union[int, str]): 
+		columns (List[Any]): One buffer, list of numbers or list of strings per column. An empty list unbinds the data.
+		formats (Union[List[str], Tuple[str, ...]], optional): printf style format per numeric column (e.g. '%.3f'). Defaults to '%g', or '%.0f' for integers.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_table_data(table, columns, **kwargs)
+
 def set_table_row_color(table, row, color):
 	"""	 Set table row color.
 
@@ -7838,6 +8004,22 @@ def set_table_row_color(table, row, color):
 
 	return internal_dpg.set_table_row_color(table, row, color)
 
+def set_texture_region(texture, x, y, width, height, **kwargs):
+	"""	 Updates a rectangle of a dynamic or raw texture. Only the rectangle is uploaded on the next frame.
+
+	Args:
+		texture (Union[int, str]): 
+		x (int): 
+		y (int): 
+		width (int): 
+		height (int): 
+		data (Any, optional): width*height pixels in the texture's format. Raw textures can leave it out to upload what was written to their buffer.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_texture_region(texture, x, y, width, height, **kwargs)
+
 def set_value(item, value):
 	"""	 Set's an item's value.
 
@@ -7850,6 +8032,18 @@ def set_value(item, value):
 
 	return internal_dpg.set_value(item, value)
 
+def set_values(items, values):
+	"""	 Set's the values of a list of items.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+		values (Any): List of values or a buffer of numbers (same length as items).
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_values(items, values)
+
 def set_viewport_resize_callback(callback):
 	"""	 Sets a callback to run on viewport resize.
 
@@ -7955,7 +8149,7 @@ def split_frame(**kwargs):
 	"""	 Waits one frame.
 
 	Args:
-		delay (int, optional): Minimal delay in in milliseconds
+		delay (int, optional): Unused, the render loop wakes the caller when the frame ends.
 	Returns:
 		None
 	"""
@@ -8062,6 +8256,17 @@ def unstage(item):
 
 	return internal_dpg.unstage(item)
 
+def wait_for_frame(**kwargs):
+	"""	 Blocks, without holding the GIL, until a frame has rendered. Returns the last rendered frame, -1 once the context is destroyed.
+
+	Args:
+		frame (int, optional): Frame to wait for, -1 is the next one. Frames already rendered return right away.
+	Returns:
+		int
+	"""
+
+	return internal_dpg.wait_for_frame(**kwargs)
+
 
 ##########################################################
 # Constants #
@@ -8308,6 +8513,9 @@ def unstage(item):
 mvPlotMarker_Cross=internal_dpg.mvPlotMarker_Cross
 mvPlotMarker_Plus=internal_dpg.mvPlotMarker_Plus
 mvPlotMarker_Asterisk=internal_dpg.mvPlotMarker_Asterisk
+mvPlotDownsample_None=internal_dpg.mvPlotDownsample_None
+mvPlotDownsample_MinMax=internal_dpg.mvPlotDownsample_MinMax
+mvPlotDownsample_LTTB=internal_dpg.mvPlotDownsample_LTTB
 mvPlot_Location_Center=internal_dpg.mvPlot_Location_Center
 mvPlot_Location_North=internal_dpg.mvPlot_Location_North
 mvPlot_Location_South=internal_dpg.mvPlot_Location_South
@@ -8321,8 +8529,15 @@ def unstage(item):
 mvTable_SizingFixedSame=internal_dpg.mvTable_SizingFixedSame
 mvTable_SizingStretchProp=internal_dpg.mvTable_SizingStretchProp
 mvTable_SizingStretchSame=internal_dpg.mvTable_SizingStretchSame
+mvTable_SortKeyAuto=internal_dpg.mvTable_SortKeyAuto
+mvTable_SortKeyText=internal_dpg.mvTable_SortKeyText
+mvTable_SortKeyNumber=internal_dpg.mvTable_SortKeyNumber
 mvFormat_Float_rgba=internal_dpg.mvFormat_Float_rgba
 mvFormat_Float_rgb=internal_dpg.mvFormat_Float_rgb
+mvFormat_Byte_rgba=internal_dpg.mvFormat_Byte_rgba
+mvFormat_Byte_r=internal_dpg.mvFormat_Byte_r
+mvFormat_Byte_rg=internal_dpg.mvFormat_Byte_rg
+mvFormat_Half_rgba=internal_dpg.mvFormat_Half_rgba
 mvThemeCat_Core=internal_dpg.mvThemeCat_Core
 mvThemeCat_Plots=internal_dpg.mvThemeCat_Plots
 mvThemeCat_Nodes=internal_dpg.mvThemeCat_Nodes
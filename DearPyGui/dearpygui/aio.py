@@ -0,0 +1,130 @@
+##########################################################
+# Dear PyGui User Interface - asyncio
+#
+#   import dearpygui.aio as dpg_aio
+#
+#   async def main():
+#       dpg_aio.setup_event_loop()       # async def callbacks run here
+#       frame = await dpg_aio.next_frame()
+#       await dpg_aio.until_frame(frame + 10)
+#
+# The render loop wakes the event loop through the frame
+# wakeup fd (get_frame_wakeup_fd), nothing polls. Loops that
+# can't watch it (Windows proactor loops) block a worker
+# thread on wait_for_frame instead. The fd is shared, so a
+# single event loop should await frames at a time.
+##########################################################
+
+import asyncio
+import heapq
+import itertools
+import os
+import weakref
+import dearpygui._dearpygui as internal_dpg
+
+
+def setup_event_loop(loop=None):
+    """ Schedules coroutine callbacks (async def) on loop, the running loop by default.
+
+    Args:
+        loop (asyncio.AbstractEventLoop, optional): None uses the running loop.
+    Returns:
+        None
+    """
+
+    if loop is None:
+        loop = asyncio.get_running_loop()
+    internal_dpg.set_callback_event_loop(loop)
+
+
+async def next_frame():
+    """ Resolves once the frame being rendered has finished.
+
+    Returns:
+        int: the last rendered frame
+    """
+
+    return await until_frame(internal_dpg.wait_for_frame(frame=0) + 1)
+
+
+async def until_frame(frame):
+    """ Resolves once frame has rendered, right away if it already has. Cancelled
+    when the context is destroyed.
+
+    Args:
+        frame (int): frame number, as returned by get_frame_count
+    Returns:
+        int: the last rendered frame
+    """
+
+    loop = asyncio.get_running_loop()
+    waiters = _waiters.get(loop)
+    if waiters is None:
+        waiters = _waiters[loop] = _FrameWaiters(loop)
+    return await waiters.add(frame)
+
+
+class _FrameWaiters:
+
+    # futures of one event loop, by frame
+
+    def __init__(self, loop):
+        self.loop = loop
+        self.pending = []  # heap of (frame, order, future)
+        self.order = itertools.count()
+        self.fd = internal_dpg.get_frame_wakeup_fd()
+        self.reading = False
+        self.blocking = False
+
+    def add(self, frame):
+        future = self.loop.create_future()
+        heapq.heappush(self.pending, (frame, next(self.order), future))
+        self.resolve(internal_dpg.wait_for_frame(frame=0))
+        return future
+
+    def resolve(self, rendered):
+
+        # -1: the context is gone
+        while self.pending and (rendered < 0 or self.pending[0][0] <= rendered):
+            _, _, future = heapq.heappop(self.pending)
+            if future.done():
+                continue
+            if rendered < 0:
+                future.cancel()
+            else:
+                future.set_result(rendered)
+        self.watch()
+
+    def watch(self):
+
+        if not self.pending:
+            if self.reading:
+                self.loop.remove_reader(self.fd)
+                self.reading = False
+            return
+
+        if self.fd >= 0 and not self.reading:
+            try:
+                self.loop.add_reader(self.fd, self.on_wakeup)
+                self.reading = True
+            except NotImplementedError:
+                self.fd = -1
+
+        if self.fd < 0 and not self.blocking:
+            self.blocking = True
+            job = self.loop.run_in_executor(None, internal_dpg.wait_for_frame, self.pending[0][0])
+            job.add_done_callback(self.on_frame)
+
+    def on_wakeup(self):
+        try:
+            os.read(self.fd, 4096)
+        except BlockingIOError:
+            pass
+        self.resolve(internal_dpg.wait_for_frame(frame=0))
+
+    def on_frame(self, job):
+        self.blocking = False
+        self.resolve(job.result())
+
+
+_waiters = weakref.WeakKeyDictionary()  # event loop -> _FrameWaiters
@@ -63,6 +63,14 @@ def configure_item(item : Union[int, str], **kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_item(item, **kwargs)
 
+def configure_items(items : Union[List[int], Tuple[int, ...]], configs : Union[List[dict], Tuple[dict, ...]] =None, **kwargs) -> None:
+	"""Configures a list of items in one call. Applies the same keywords to every item and,
+	when configs is given, configs[i] to items[i] on top of them."""
+	if configs is None:
+		internal_dpg.configure_items(items, **kwargs)
+	else:
+		internal_dpg.configure_items(items, configs, **kwargs)
+
 def configure_app(**kwargs) -> None:
 	"""Configures an item after creation."""
 	internal_dpg.configure_app(**kwargs)
@@ -2337,7 +2345,7 @@ def tab_bar(*, label: str =None, user_data: Any =None, use_internal_label: bool
 		internal_dpg.pop_container_stack()
 
 @contextmanager
-def table(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, callback: Callable =None, show: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', delay_search: bool =False, header_row: bool =True, clipper: bool =False, inner_width: int =0, policy: int =0, freeze_rows: int =0, freeze_columns: int =0, sort_multi: bool =False, sort_tristate: bool =False, resizable: bool =False, reorderable: bool =False, hideable: bool =False, sortable: bool =False, context_menu_in_body: bool =False, row_background: bool =False, borders_innerH: bool =False, borders_outerH: bool =False, borders_innerV: bool =False, borders_outerV: bool =False, no_host_extendX: bool =False, no_host_extendY: bool =False, no_keep_columns_visible: bool =False, precise_widths: bool =False, no_clip: bool =False, pad_outerX: bool =False, no_pad_outerX: bool =False, no_pad_innerX: bool =False, scrollX: bool =False, scrollY: bool =False, no_saved_settings: bool =False, **kwargs) -> Union[int, str]:
+def table(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, callback: Callable =None, show: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', delay_search: bool =False, header_row: bool =True, clipper: bool =False, inner_width: int =0, policy: int =0, freeze_rows: int =0, freeze_columns: int =0, sort_multi: bool =False, sort_tristate: bool =False, resizable: bool =False, reorderable: bool =False, hideable: bool =False, sortable: bool =False, context_menu_in_body: bool =False, row_background: bool =False, borders_innerH: bool =False, borders_outerH: bool =False, borders_innerV: bool =False, borders_outerV: bool =False, no_host_extendX: bool =False, no_host_extendY: bool =False, no_keep_columns_visible: bool =False, precise_widths: bool =False, no_clip: bool =False, pad_outerX: bool =False, no_pad_outerX: bool =False, no_pad_innerX: bool =False, scrollX: bool =False, scrollY: bool =False, no_saved_settings: bool =False, native_sort: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a table.
 
 	Args:
@@ -2385,6 +2393,7 @@ def table(*, label: str =None, user_data: Any =None, use_internal_label: bool =T
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows internally when the sort specs change instead of running the callback. Stable, multi-column, keyed per column by sort_key.
 		id (Union[int, str], optional): (deprecated) 
 	Yields:
 		Union[int, str]
@@ -2394,7 +2403,7 @@ def table(*, label: str =None, user_data: Any =None, use_internal_label: bool =T
 		if 'id' in kwargs.keys():
 			warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 			tag=kwargs['id']
-		widget = internal_dpg.add_table(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, parent=parent, before=before, source=source, callback=callback, show=show, pos=pos, filter_key=filter_key, delay_search=delay_search, header_row=header_row, clipper=clipper, inner_width=inner_width, policy=policy, freeze_rows=freeze_rows, freeze_columns=freeze_columns, sort_multi=sort_multi, sort_tristate=sort_tristate, resizable=resizable, reorderable=reorderable, hideable=hideable, sortable=sortable, context_menu_in_body=context_menu_in_body, row_background=row_background, borders_innerH=borders_innerH, borders_outerH=borders_outerH, borders_innerV=borders_innerV, borders_outerV=borders_outerV, no_host_extendX=no_host_extendX, no_host_extendY=no_host_extendY, no_keep_columns_visible=no_keep_columns_visible, precise_widths=precise_widths, no_clip=no_clip, pad_outerX=pad_outerX, no_pad_outerX=no_pad_outerX, no_pad_innerX=no_pad_innerX, scrollX=scrollX, scrollY=scrollY, no_saved_settings=no_saved_settings, **kwargs)
+		widget = internal_dpg.add_table(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, parent=parent, before=before, source=source, callback=callback, show=show, pos=pos, filter_key=filter_key, delay_search=delay_search, header_row=header_row, clipper=clipper, inner_width=inner_width, policy=policy, freeze_rows=freeze_rows, freeze_columns=freeze_columns, sort_multi=sort_multi, sort_tristate=sort_tristate, resizable=resizable, reorderable=reorderable, hideable=hideable, sortable=sortable, context_menu_in_body=context_menu_in_body, row_background=row_background, borders_innerH=borders_innerH, borders_outerH=borders_outerH, borders_innerV=borders_innerV, borders_outerV=borders_outerV, no_host_extendX=no_host_extendX, no_host_extendY=no_host_extendY, no_keep_columns_visible=no_keep_columns_visible, precise_widths=precise_widths, no_clip=no_clip, pad_outerX=pad_outerX, no_pad_outerX=no_pad_outerX, no_pad_innerX=no_pad_innerX, scrollX=scrollX, scrollY=scrollY, no_saved_settings=no_saved_settings, native_sort=native_sort, **kwargs)
 		internal_dpg.push_container_stack(widget)
 		yield widget
 	finally:
@@ -2483,7 +2492,7 @@ def template_registry(*, label: str =None, user_data: Any =None, use_internal_la
 		internal_dpg.pop_container_stack()
 
 @contextmanager
-def texture_registry(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, show: bool =False, **kwargs) -> Union[int, str]:
+def texture_registry(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, show: bool =False, atlas: bool =False, atlas_page_size: int =1024, **kwargs) -> Union[int, str]:
 	"""	 Adds a dynamic texture.
 
 	Args:
@@ -2492,6 +2501,8 @@ def texture_registry(*, label: str =None, user_data: Any =None, use_internal_lab
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		show (bool, optional): Attempt to render widget.
+		atlas (bool, optional): Packs static textures added afterwards into shared pages, so images of them batch into fewer draw calls.
+		atlas_page_size (int, optional): Width and height of new atlas pages, larger static textures get their own texture.
 		id (Union[int, str], optional): (deprecated) 
 	Yields:
 		Union[int, str]
@@ -2501,7 +2512,7 @@ def texture_registry(*, label: str =None, user_data: Any =None, use_internal_lab
 		if 'id' in kwargs.keys():
 			warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 			tag=kwargs['id']
-		widget = internal_dpg.add_texture_registry(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, show=show, **kwargs)
+		widget = internal_dpg.add_texture_registry(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, show=show, atlas=atlas, atlas_page_size=atlas_page_size, **kwargs)
 		internal_dpg.push_container_stack(widget)
 		yield widget
 	finally:
@@ -2852,7 +2863,7 @@ def add_alias(alias : str, item : Union[int, str], **kwargs) -> None:
 
 	return internal_dpg.add_alias(alias, item, **kwargs)
 
-def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, fill: Union[List[int], Tuple[int, ...]] =(0, 0, 0, -255), contribute_to_bounds: bool =True, **kwargs) -> Union[int, str]:
+def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, fill: Union[List[int], Tuple[int, ...]] =(0, 0, 0, -255), contribute_to_bounds: bool =True, zero_copy: bool =False, downsample: int =0, sorted_x: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds an area series to a plot.
 
 	Args:
@@ -2868,6 +2879,9 @@ def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		show (bool, optional): Attempt to render widget.
 		fill (Union[List[int], Tuple[int, ...]], optional): 
 		contribute_to_bounds (bool, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -2877,9 +2891,9 @@ def add_area_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_area_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, fill=fill, contribute_to_bounds=contribute_to_bounds, **kwargs)
+	return internal_dpg.add_area_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, fill=fill, contribute_to_bounds=contribute_to_bounds, zero_copy=zero_copy, downsample=downsample, sorted_x=sorted_x, **kwargs)
 
-def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, weight: float =1.0, horizontal: bool =False, **kwargs) -> Union[int, str]:
+def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, weight: float =1.0, horizontal: bool =False, zero_copy: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a bar series to a plot.
 
 	Args:
@@ -2895,6 +2909,7 @@ def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[flo
 		show (bool, optional): Attempt to render widget.
 		weight (float, optional): 
 		horizontal (bool, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -2904,7 +2919,7 @@ def add_bar_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[flo
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_bar_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, weight=weight, horizontal=horizontal, **kwargs)
+	return internal_dpg.add_bar_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, weight=weight, horizontal=horizontal, zero_copy=zero_copy, **kwargs)
 
 def add_bool_value(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, source: Union[int, str] =0, default_value: bool =False, parent: Union[int, str] =internal_dpg.mvReservedUUID_3, **kwargs) -> Union[int, str]:
 	"""	 Adds a bool value.
@@ -3910,7 +3925,7 @@ def add_drawlist(width : int, height : int, *, label: str =None, user_data: Any
 
 	return internal_dpg.add_drawlist(width, height, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, callback=callback, show=show, pos=pos, filter_key=filter_key, delay_search=delay_search, tracked=tracked, track_offset=track_offset, **kwargs)
 
-def add_dynamic_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
+def add_dynamic_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, format: int =internal_dpg.mvFormat_Float_rgba, streaming: bool =False, parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
 	"""	 Adds a dynamic texture.
 
 	Args:
@@ -3921,6 +3936,8 @@ def add_dynamic_texture(width : int, height : int, default_value : Union[List[fl
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		format (int, optional): Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is).
+		streaming (bool, optional): Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
@@ -3931,7 +3948,7 @@ def add_dynamic_texture(width : int, height : int, default_value : Union[List[fl
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_dynamic_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, **kwargs)
+	return internal_dpg.add_dynamic_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, format=format, streaming=streaming, parent=parent, **kwargs)
 
 def add_error_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], negative : Union[List[float], Tuple[float, ...]], positive : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, contribute_to_bounds: bool =True, horizontal: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds an error series to a plot.
@@ -4277,7 +4294,7 @@ def add_handler_registry(*, label: str =None, user_data: Any =None, use_internal
 
 	return internal_dpg.add_handler_registry(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, show=show, **kwargs)
 
-def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols : int, *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, scale_min: float =0.0, scale_max: float =1.0, bounds_min: Any =(0.0, 0.0), bounds_max: Any =(1.0, 1.0), format: str ='%0.1f', contribute_to_bounds: bool =True, **kwargs) -> Union[int, str]:
+def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols : int, *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, scale_min: float =0.0, scale_max: float =1.0, bounds_min: Any =(0.0, 0.0), bounds_max: Any =(1.0, 1.0), format: str ='%0.1f', contribute_to_bounds: bool =True, use_texture: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a heat series to a plot.
 
 	Args:
@@ -4298,6 +4315,7 @@ def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols
 		bounds_max (Any, optional): 
 		format (str, optional): 
 		contribute_to_bounds (bool, optional): 
+		use_texture (bool, optional): Colorizes the matrix into a texture when the data, scale or colormap change and draws it as a single image. Much faster for large matrices (cell labels are not drawn).
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -4307,7 +4325,7 @@ def add_heat_series(x : Union[List[float], Tuple[float, ...]], rows : int, cols
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_heat_series(x, rows, cols, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, scale_min=scale_min, scale_max=scale_max, bounds_min=bounds_min, bounds_max=bounds_max, format=format, contribute_to_bounds=contribute_to_bounds, **kwargs)
+	return internal_dpg.add_heat_series(x, rows, cols, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, scale_min=scale_min, scale_max=scale_max, bounds_min=bounds_min, bounds_max=bounds_max, format=format, contribute_to_bounds=contribute_to_bounds, use_texture=use_texture, **kwargs)
 
 def add_histogram_series(x : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, bins: int =-1, bar_scale: float =1.0, min_range: float =0.0, max_range: float =1.0, cumlative: bool =False, density: bool =False, outliers: bool =True, contribute_to_bounds: bool =True, **kwargs) -> Union[int, str]:
 	"""	 Adds a histogram series to a plot.
@@ -5105,7 +5123,7 @@ def add_knob_float(*, label: str =None, user_data: Any =None, use_internal_label
 
 	return internal_dpg.add_knob_float(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, parent=parent, before=before, source=source, payload_type=payload_type, callback=callback, drag_callback=drag_callback, drop_callback=drop_callback, show=show, pos=pos, filter_key=filter_key, tracked=tracked, track_offset=track_offset, default_value=default_value, min_value=min_value, max_value=max_value, **kwargs)
 
-def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, **kwargs) -> Union[int, str]:
+def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, zero_copy: bool =False, capacity: int =0, downsample: int =0, sorted_x: bool =False, lod: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a line series to a plot.
 
 	Args:
@@ -5119,6 +5137,11 @@ def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
+		lod (bool, optional): Builds a min/max level of detail pyramid in the background and draws the level matching the pixel density (large series with sorted x). Ring buffer (capacity) and source series always draw every sample, wrapping shifts every index so no pyramid is kept for them.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -5128,7 +5151,7 @@ def add_line_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_line_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, **kwargs)
+	return internal_dpg.add_line_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, zero_copy=zero_copy, capacity=capacity, downsample=downsample, sorted_x=sorted_x, lod=lod, **kwargs)
 
 def add_listbox(items : Union[List[str], Tuple[str, ...]] =(), *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, payload_type: str ='$$DPG_PAYLOAD', callback: Callable =None, drag_callback: Callable =None, drop_callback: Callable =None, show: bool =True, enabled: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', tracked: bool =False, track_offset: float =0.5, default_value: str ='', num_items: int =3, **kwargs) -> Union[int, str]:
 	"""	 Adds a listbox. If height is not large enough to show all items a scroll bar will appear.
@@ -5812,7 +5835,7 @@ def add_radio_button(items : Union[List[str], Tuple[str, ...]] =(), *, label: st
 
 	return internal_dpg.add_radio_button(items, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, indent=indent, parent=parent, before=before, source=source, payload_type=payload_type, callback=callback, drag_callback=drag_callback, drop_callback=drop_callback, show=show, enabled=enabled, pos=pos, filter_key=filter_key, tracked=tracked, track_offset=track_offset, default_value=default_value, horizontal=horizontal, **kwargs)
 
-def add_raw_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, format: int =internal_dpg.mvFormat_Float_rgba, parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
+def add_raw_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, format: int =internal_dpg.mvFormat_Float_rgba, full_upload: bool =True, streaming: bool =False, parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
 	"""	 Adds a raw texture.
 
 	Args:
@@ -5823,7 +5846,9 @@ def add_raw_texture(width : int, height : int, default_value : Union[List[float]
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
-		format (int, optional): Data format.
+		format (int, optional): Data format, the buffer is uploaded as is so it must match (float32, uint8 for the byte formats, float16 for mvFormat_Half_rgba).
+		full_upload (bool, optional): Uploads the whole buffer every frame. Turn off to upload only the regions reported with set_texture_region/push_texture_rows.
+		streaming (bool, optional): Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
@@ -5834,9 +5859,9 @@ def add_raw_texture(width : int, height : int, default_value : Union[List[float]
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_raw_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, format=format, parent=parent, **kwargs)
+	return internal_dpg.add_raw_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, format=format, full_upload=full_upload, streaming=streaming, parent=parent, **kwargs)
 
-def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, **kwargs) -> Union[int, str]:
+def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, zero_copy: bool =False, capacity: int =0, sorted_x: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a scatter series to a plot.
 
 	Args:
@@ -5850,6 +5875,9 @@ def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -5859,7 +5887,7 @@ def add_scatter_series(x : Union[List[float], Tuple[float, ...]], y : Union[List
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_scatter_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, **kwargs)
+	return internal_dpg.add_scatter_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, zero_copy=zero_copy, capacity=capacity, sorted_x=sorted_x, **kwargs)
 
 def add_selectable(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, payload_type: str ='$$DPG_PAYLOAD', callback: Callable =None, drag_callback: Callable =None, drop_callback: Callable =None, show: bool =True, enabled: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', tracked: bool =False, track_offset: float =0.5, default_value: bool =False, span_columns: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a selectable. Similar to a button but can indicate its selected state.
@@ -5944,7 +5972,7 @@ def add_series_value(*, label: str =None, user_data: Any =None, use_internal_lab
 
 	return internal_dpg.add_series_value(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, source=source, default_value=default_value, parent=parent, **kwargs)
 
-def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, y2: Any =[], **kwargs) -> Union[int, str]:
+def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, y2: Any =[], zero_copy: bool =False, downsample: int =0, sorted_x: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a shade series to a plot.
 
 	Args:
@@ -5959,6 +5987,9 @@ def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
 		y2 (Any, optional): 
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -5968,7 +5999,7 @@ def add_shade_series(x : Union[List[float], Tuple[float, ...]], y1 : Union[List[
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_shade_series(x, y1, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, y2=y2, **kwargs)
+	return internal_dpg.add_shade_series(x, y1, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, y2=y2, zero_copy=zero_copy, downsample=downsample, sorted_x=sorted_x, **kwargs)
 
 def add_simple_plot(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, payload_type: str ='$$DPG_PAYLOAD', drag_callback: Callable =None, drop_callback: Callable =None, show: bool =True, filter_key: str ='', tracked: bool =False, track_offset: float =0.5, default_value: Union[List[float], Tuple[float, ...]] =(), overlay: str ='', histogram: bool =False, autosize: bool =True, min_scale: float =0.0, max_scale: float =0.0, **kwargs) -> Union[int, str]:
 	"""	 Adds a simple plot for visualization of a 1 dimensional set of values.
@@ -6219,7 +6250,7 @@ def add_stage(*, label: str =None, user_data: Any =None, use_internal_label: boo
 
 	return internal_dpg.add_stage(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, **kwargs)
 
-def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, **kwargs) -> Union[int, str]:
+def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, zero_copy: bool =False, capacity: int =0, downsample: int =0, sorted_x: bool =False, lod: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a stair series to a plot.
 
 	Args:
@@ -6233,6 +6264,11 @@ def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[f
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		capacity (int, optional): Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).
+		downsample (int, optional): Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
+		lod (bool, optional): Builds a min/max level of detail pyramid in the background and draws the level matching the pixel density (large series with sorted x). Ring buffer (capacity) and source series always draw every sample, wrapping shifts every index so no pyramid is kept for them.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -6242,9 +6278,9 @@ def add_stair_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[f
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_stair_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, **kwargs)
+	return internal_dpg.add_stair_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, zero_copy=zero_copy, capacity=capacity, downsample=downsample, sorted_x=sorted_x, lod=lod, **kwargs)
 
-def add_static_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
+def add_static_texture(width : int, height : int, default_value : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, format: int =internal_dpg.mvFormat_Float_rgba, file: str ='', parent: Union[int, str] =internal_dpg.mvReservedUUID_2, **kwargs) -> Union[int, str]:
 	"""	 Adds a static texture.
 
 	Args:
@@ -6255,6 +6291,8 @@ def add_static_texture(width : int, height : int, default_value : Union[List[flo
 		user_data (Any, optional): User data for callbacks
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
+		format (int, optional): Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is).
+		file (str, optional): Image file decoded on a worker thread, replaces width, height and default_value once loaded.
 		parent (Union[int, str], optional): Parent to add this item to. (runtime adding)
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
@@ -6265,9 +6303,9 @@ def add_static_texture(width : int, height : int, default_value : Union[List[flo
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_static_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, **kwargs)
+	return internal_dpg.add_static_texture(width, height, default_value, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, format=format, file=file, parent=parent, **kwargs)
 
-def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, **kwargs) -> Union[int, str]:
+def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[float], Tuple[float, ...]], *, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, show: bool =True, zero_copy: bool =False, sorted_x: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a stem series to a plot.
 
 	Args:
@@ -6282,6 +6320,8 @@ def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		before (Union[int, str], optional): This item will be displayed before the specified item in the parent.
 		source (Union[int, str], optional): Overrides 'id' as value storage key.
 		show (bool, optional): Attempt to render widget.
+		zero_copy (bool, optional): Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.
+		sorted_x (bool, optional): Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -6291,7 +6331,7 @@ def add_stem_series(x : Union[List[float], Tuple[float, ...]], y : Union[List[fl
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_stem_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, indent=indent, parent=parent, before=before, source=source, show=show, **kwargs)
+	return internal_dpg.add_stem_series(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, indent=indent, parent=parent, before=before, source=source, show=show, zero_copy=zero_copy, sorted_x=sorted_x, **kwargs)
 
 def add_string_value(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, source: Union[int, str] =0, default_value: str ='', parent: Union[int, str] =internal_dpg.mvReservedUUID_3, **kwargs) -> Union[int, str]:
 	"""	 Adds a string value.
@@ -6455,7 +6495,7 @@ def add_tab_button(*, label: str =None, user_data: Any =None, use_internal_label
 
 	return internal_dpg.add_tab_button(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, indent=indent, parent=parent, before=before, payload_type=payload_type, callback=callback, drag_callback=drag_callback, drop_callback=drop_callback, show=show, filter_key=filter_key, tracked=tracked, track_offset=track_offset, no_reorder=no_reorder, leading=leading, trailing=trailing, no_tooltip=no_tooltip, **kwargs)
 
-def add_table(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, callback: Callable =None, show: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', delay_search: bool =False, header_row: bool =True, clipper: bool =False, inner_width: int =0, policy: int =0, freeze_rows: int =0, freeze_columns: int =0, sort_multi: bool =False, sort_tristate: bool =False, resizable: bool =False, reorderable: bool =False, hideable: bool =False, sortable: bool =False, context_menu_in_body: bool =False, row_background: bool =False, borders_innerH: bool =False, borders_outerH: bool =False, borders_innerV: bool =False, borders_outerV: bool =False, no_host_extendX: bool =False, no_host_extendY: bool =False, no_keep_columns_visible: bool =False, precise_widths: bool =False, no_clip: bool =False, pad_outerX: bool =False, no_pad_outerX: bool =False, no_pad_innerX: bool =False, scrollX: bool =False, scrollY: bool =False, no_saved_settings: bool =False, **kwargs) -> Union[int, str]:
+def add_table(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, height: int =0, indent: int =-1, parent: Union[int, str] =0, before: Union[int, str] =0, source: Union[int, str] =0, callback: Callable =None, show: bool =True, pos: Union[List[int], Tuple[int, ...]] =[], filter_key: str ='', delay_search: bool =False, header_row: bool =True, clipper: bool =False, inner_width: int =0, policy: int =0, freeze_rows: int =0, freeze_columns: int =0, sort_multi: bool =False, sort_tristate: bool =False, resizable: bool =False, reorderable: bool =False, hideable: bool =False, sortable: bool =False, context_menu_in_body: bool =False, row_background: bool =False, borders_innerH: bool =False, borders_outerH: bool =False, borders_innerV: bool =False, borders_outerV: bool =False, no_host_extendX: bool =False, no_host_extendY: bool =False, no_keep_columns_visible: bool =False, precise_widths: bool =False, no_clip: bool =False, pad_outerX: bool =False, no_pad_outerX: bool =False, no_pad_innerX: bool =False, scrollX: bool =False, scrollY: bool =False, no_saved_settings: bool =False, native_sort: bool =False, **kwargs) -> Union[int, str]:
 	"""	 Adds a table.
 
 	Args:
@@ -6503,6 +6543,7 @@ def add_table(*, label: str =None, user_data: Any =None, use_internal_label: boo
 		scrollX (bool, optional): Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX.
 		scrollY (bool, optional): Enable vertical scrolling.
 		no_saved_settings (bool, optional): Never load/save settings in .ini file.
+		native_sort (bool, optional): Sort rows internally when the sort specs change instead of running the callback. Stable, multi-column, keyed per column by sort_key.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -6512,7 +6553,7 @@ def add_table(*, label: str =None, user_data: Any =None, use_internal_label: boo
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_table(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, parent=parent, before=before, source=source, callback=callback, show=show, pos=pos, filter_key=filter_key, delay_search=delay_search, header_row=header_row, clipper=clipper, inner_width=inner_width, policy=policy, freeze_rows=freeze_rows, freeze_columns=freeze_columns, sort_multi=sort_multi, sort_tristate=sort_tristate, resizable=resizable, reorderable=reorderable, hideable=hideable, sortable=sortable, context_menu_in_body=context_menu_in_body, row_background=row_background, borders_innerH=borders_innerH, borders_outerH=borders_outerH, borders_innerV=borders_innerV, borders_outerV=borders_outerV, no_host_extendX=no_host_extendX, no_host_extendY=no_host_extendY, no_keep_columns_visible=no_keep_columns_visible, precise_widths=precise_widths, no_clip=no_clip, pad_outerX=pad_outerX, no_pad_outerX=no_pad_outerX, no_pad_innerX=no_pad_innerX, scrollX=scrollX, scrollY=scrollY, no_saved_settings=no_saved_settings, **kwargs)
+	return internal_dpg.add_table(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, parent=parent, before=before, source=source, callback=callback, show=show, pos=pos, filter_key=filter_key, delay_search=delay_search, header_row=header_row, clipper=clipper, inner_width=inner_width, policy=policy, freeze_rows=freeze_rows, freeze_columns=freeze_columns, sort_multi=sort_multi, sort_tristate=sort_tristate, resizable=resizable, reorderable=reorderable, hideable=hideable, sortable=sortable, context_menu_in_body=context_menu_in_body, row_background=row_background, borders_innerH=borders_innerH, borders_outerH=borders_outerH, borders_innerV=borders_innerV, borders_outerV=borders_outerV, no_host_extendX=no_host_extendX, no_host_extendY=no_host_extendY, no_keep_columns_visible=no_keep_columns_visible, precise_widths=precise_widths, no_clip=no_clip, pad_outerX=pad_outerX, no_pad_outerX=no_pad_outerX, no_pad_innerX=no_pad_innerX, scrollX=scrollX, scrollY=scrollY, no_saved_settings=no_saved_settings, native_sort=native_sort, **kwargs)
 
 def add_table_cell(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, height: int =0, parent: Union[int, str] =0, before: Union[int, str] =0, show: bool =True, filter_key: str ='', **kwargs) -> Union[int, str]:
 	"""	 Adds a table.
@@ -6538,7 +6579,7 @@ def add_table_cell(*, label: str =None, user_data: Any =None, use_internal_label
 
 	return internal_dpg.add_table_cell(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, height=height, parent=parent, before=before, show=show, filter_key=filter_key, **kwargs)
 
-def add_table_column(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, parent: Union[int, str] =0, before: Union[int, str] =0, show: bool =True, enabled: bool =True, init_width_or_weight: float =0.0, default_hide: bool =False, default_sort: bool =False, width_stretch: bool =False, width_fixed: bool =False, no_resize: bool =False, no_reorder: bool =False, no_hide: bool =False, no_clip: bool =False, no_sort: bool =False, no_sort_ascending: bool =False, no_sort_descending: bool =False, no_header_width: bool =False, prefer_sort_ascending: bool =True, prefer_sort_descending: bool =False, indent_enable: bool =False, indent_disable: bool =False, **kwargs) -> Union[int, str]:
+def add_table_column(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, width: int =0, parent: Union[int, str] =0, before: Union[int, str] =0, show: bool =True, enabled: bool =True, init_width_or_weight: float =0.0, default_hide: bool =False, default_sort: bool =False, width_stretch: bool =False, width_fixed: bool =False, no_resize: bool =False, no_reorder: bool =False, no_hide: bool =False, no_clip: bool =False, no_sort: bool =False, no_sort_ascending: bool =False, no_sort_descending: bool =False, no_header_width: bool =False, prefer_sort_ascending: bool =True, prefer_sort_descending: bool =False, indent_enable: bool =False, indent_disable: bool =False, sort_key: int =0, **kwargs) -> Union[int, str]:
 	"""	 Adds a table column.
 
 	Args:
@@ -6568,6 +6609,7 @@ def add_table_column(*, label: str =None, user_data: Any =None, use_internal_lab
 		prefer_sort_descending (bool, optional): Make the initial sort direction Descending when first sorting on this column.
 		indent_enable (bool, optional): Use current Indent value when entering cell (default for column 0).
 		indent_disable (bool, optional): Ignore current Indent value when entering cell (default for columns > 0). Indentation changes _within_ the cell will still be honored.
+		sort_key (int, optional): How cells are compared by tables with native_sort. mvTable_SortKeyAuto (numbers for numeric values, text otherwise), mvTable_SortKeyText or mvTable_SortKeyNumber. A cell's filter_key is used as its key if set.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -6577,7 +6619,7 @@ def add_table_column(*, label: str =None, user_data: Any =None, use_internal_lab
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_table_column(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, parent=parent, before=before, show=show, enabled=enabled, init_width_or_weight=init_width_or_weight, default_hide=default_hide, default_sort=default_sort, width_stretch=width_stretch, width_fixed=width_fixed, no_resize=no_resize, no_reorder=no_reorder, no_hide=no_hide, no_clip=no_clip, no_sort=no_sort, no_sort_ascending=no_sort_ascending, no_sort_descending=no_sort_descending, no_header_width=no_header_width, prefer_sort_ascending=prefer_sort_ascending, prefer_sort_descending=prefer_sort_descending, indent_enable=indent_enable, indent_disable=indent_disable, **kwargs)
+	return internal_dpg.add_table_column(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, parent=parent, before=before, show=show, enabled=enabled, init_width_or_weight=init_width_or_weight, default_hide=default_hide, default_sort=default_sort, width_stretch=width_stretch, width_fixed=width_fixed, no_resize=no_resize, no_reorder=no_reorder, no_hide=no_hide, no_clip=no_clip, no_sort=no_sort, no_sort_ascending=no_sort_ascending, no_sort_descending=no_sort_descending, no_header_width=no_header_width, prefer_sort_ascending=prefer_sort_ascending, prefer_sort_descending=prefer_sort_descending, indent_enable=indent_enable, indent_disable=indent_disable, sort_key=sort_key, **kwargs)
 
 def add_table_row(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, height: int =0, parent: Union[int, str] =0, before: Union[int, str] =0, show: bool =True, filter_key: str ='', **kwargs) -> Union[int, str]:
 	"""	 Adds a table row.
@@ -6686,7 +6728,7 @@ def add_text_point(x : float, y : float, *, label: str =None, user_data: Any =No
 
 	return internal_dpg.add_text_point(x, y, label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, parent=parent, before=before, source=source, show=show, x_offset=x_offset, y_offset=y_offset, vertical=vertical, **kwargs)
 
-def add_texture_registry(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, show: bool =False, **kwargs) -> Union[int, str]:
+def add_texture_registry(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, show: bool =False, atlas: bool =False, atlas_page_size: int =1024, **kwargs) -> Union[int, str]:
 	"""	 Adds a dynamic texture.
 
 	Args:
@@ -6695,6 +6737,8 @@ def add_texture_registry(*, label: str =None, user_data: Any =None, use_internal
 		use_internal_label (bool, optional): Use generated internal label instead of user specified (appends ### uuid).
 		tag (Union[int, str], optional): Unique id used to programmatically refer to the item.If label is unused this will be the label.
 		show (bool, optional): Attempt to render widget.
+		atlas (bool, optional): Packs static textures added afterwards into shared pages, so images of them batch into fewer draw calls.
+		atlas_page_size (int, optional): Width and height of new atlas pages, larger static textures get their own texture.
 		id (Union[int, str], optional): (deprecated) 
 	Returns:
 		Union[int, str]
@@ -6704,7 +6748,7 @@ def add_texture_registry(*, label: str =None, user_data: Any =None, use_internal
 		warnings.warn('id keyword renamed to tag', DeprecationWarning, 2)
 		tag=kwargs['id']
 
-	return internal_dpg.add_texture_registry(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, show=show, **kwargs)
+	return internal_dpg.add_texture_registry(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, show=show, atlas=atlas, atlas_page_size=atlas_page_size, **kwargs)
 
 def add_theme(*, label: str =None, user_data: Any =None, use_internal_label: bool =True, tag: Union[int, str] =0, **kwargs) -> Union[int, str]:
 	"""	 Adds a theme.
@@ -7026,6 +7070,19 @@ def add_window(*, label: str =None, user_data: Any =None, use_internal_label: bo
 
 	return internal_dpg.add_window(label=label, user_data=user_data, use_internal_label=use_internal_label, tag=tag, width=width, height=height, indent=indent, show=show, pos=pos, delay_search=delay_search, min_size=min_size, max_size=max_size, menubar=menubar, collapsed=collapsed, autosize=autosize, no_resize=no_resize, no_title_bar=no_title_bar, no_move=no_move, no_scrollbar=no_scrollbar, no_collapse=no_collapse, horizontal_scrollbar=horizontal_scrollbar, no_focus_on_appearing=no_focus_on_appearing, no_bring_to_front_on_focus=no_bring_to_front_on_focus, no_close=no_close, no_background=no_background, modal=modal, popup=popup, no_saved_settings=no_saved_settings, on_close=on_close, **kwargs)
 
+def append_series_data(series : Union[int, str], x : Any, y : Any, **kwargs) -> None:
+	"""	 Appends samples to a line, scatter or stair series. If the series has a capacity, the oldest samples are overwritten once it is full.
+
+	Args:
+		series (Union[int, str]): 
+		x (Any): Single value, list or buffer of x values.
+		y (Any): Single value, list or buffer of y values.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.append_series_data(series, x, y, **kwargs)
+
 def apply_transform(item : Union[int, str], transform : Any, **kwargs) -> None:
 	"""	 New in 1.1. Applies a transformation matrix to a layer.
 
@@ -7821,6 +7878,17 @@ def get_axis_limits(axis : Union[int, str], **kwargs) -> Union[List[float], Tupl
 
 	return internal_dpg.get_axis_limits(axis, **kwargs)
 
+def get_callback_statistics(*, reset: bool =False, **kwargs) -> dict:
+	"""	 Returns the callbacks run so far, the GIL acquisitions it took (batches), their latency from being queued to being called in seconds, the callbacks queued now (queue_depth) and those coalesced into a newer one or dropped by the queue limit.
+
+	Args:
+		reset (bool, optional): Starts counting again after returning.
+	Returns:
+		dict
+	"""
+
+	return internal_dpg.get_callback_statistics(reset=reset, **kwargs)
+
 def get_colormap_color(colormap : Union[int, str], index : int, **kwargs) -> Union[List[int], Tuple[int, ...]]:
 	"""	 Returns a color from a colormap given an index >= 0. (ex. 0 will be the first color in the color list of the color map) Modulo will be performed against the number of items in the color list.
 
@@ -7884,6 +7952,16 @@ def get_frame_rate(**kwargs) -> float:
 
 	return internal_dpg.get_frame_rate(**kwargs)
 
+def get_frame_wakeup_fd(**kwargs) -> int:
+	"""	 Returns a file descriptor that becomes readable after every rendered frame (eventfd or pipe, drain it after waking up), for event loops to wait on. -1 where unsupported (Windows).
+
+	Args:
+	Returns:
+		int
+	"""
+
+	return internal_dpg.get_frame_wakeup_fd(**kwargs)
+
 def get_global_font_scale(**kwargs) -> float:
 	"""	 Returns global font scale.
 
@@ -8012,6 +8090,17 @@ def get_selected_nodes(node_editor : Union[int, str], **kwargs) -> Union[List[in
 
 	return internal_dpg.get_selected_nodes(node_editor, **kwargs)
 
+def get_table_data(table : Union[int, str], **kwargs) -> List[List[str]]:
+	"""	 Returns the cells of the data bound with set_table_data as they are drawn, one list of strings per column.
+
+	Args:
+		table (Union[int, str]): 
+	Returns:
+		List[List[str]]
+	"""
+
+	return internal_dpg.get_table_data(table, **kwargs)
+
 def get_text_size(text : str, *, wrap_width: float =-1.0, font: Union[int, str] =0, **kwargs) -> Union[List[float], Tuple[float, ...]]:
 	"""	 Returns width/height of text with specified font (must occur after 1st frame).
 
@@ -8025,6 +8114,17 @@ def get_text_size(text : str, *, wrap_width: float =-1.0, font: Union[int, str]
 
 	return internal_dpg.get_text_size(text, wrap_width=wrap_width, font=font, **kwargs)
 
+def get_texture_pixels(texture : Union[int, str], **kwargs) -> Any:
+	"""	 Reads back what the gpu holds for a dynamic or raw texture (in the texture's format) or for the image of a heat series drawn with use_texture (float rgba). Call it from the thread rendering frames.
+
+	Args:
+		texture (Union[int, str]): 
+	Returns:
+		Any
+	"""
+
+	return internal_dpg.get_texture_pixels(texture, **kwargs)
+
 def get_total_time(**kwargs) -> float:
 	"""	 Returns total time since Dear PyGui has started.
 
@@ -8349,18 +8449,35 @@ def last_root(**kwargs) -> Union[int, str]:
 
 	return internal_dpg.last_root(**kwargs)
 
-def load_image(file : str, *, gamma: float =1.0, gamma_scale_factor: float =1.0, **kwargs) -> Any:
+def load_image(file : str, *, gamma: float =1.0, gamma_scale_factor: float =1.0, format: int =internal_dpg.mvFormat_Float_rgba, **kwargs) -> Any:
 	"""	 Loads an image. Returns width, height, channels, mvBuffer
 
 	Args:
 		file (str): 
 		gamma (float, optional): Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading.
 		gamma_scale_factor (float, optional): Gamma scale factor.
+		format (int, optional): mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray.
 	Returns:
 		Any
 	"""
 
-	return internal_dpg.load_image(file, gamma=gamma, gamma_scale_factor=gamma_scale_factor, **kwargs)
+	return internal_dpg.load_image(file, gamma=gamma, gamma_scale_factor=gamma_scale_factor, format=format, **kwargs)
+
+def load_image_async(file : str, callback : Callable, *, gamma: float =1.0, gamma_scale_factor: float =1.0, format: int =internal_dpg.mvFormat_Float_rgba, user_data: Any =None, **kwargs) -> Union[int, str]:
+	"""	 Loads an image on a worker thread (see configure_app decode_threads) and passes it to the callback. Returns the id used as the callback's sender.
+
+	Args:
+		file (str): 
+		callback (Callable): Called with (sender, (width, height, channels, data), user_data) once decoded, app_data is None if the file couldn't be loaded.
+		gamma (float, optional): Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading.
+		gamma_scale_factor (float, optional): Gamma scale factor.
+		format (int, optional): mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray.
+		user_data (Any, optional): User data for the callback.
+	Returns:
+		Union[int, str]
+	"""
+
+	return internal_dpg.load_image_async(file, callback, gamma=gamma, gamma_scale_factor=gamma_scale_factor, format=format, user_data=user_data, **kwargs)
 
 def lock_mutex(**kwargs) -> None:
 	"""	 Locks render thread mutex.
@@ -8448,6 +8565,18 @@ def push_container_stack(item : Union[int, str], **kwargs) -> bool:
 
 	return internal_dpg.push_container_stack(item, **kwargs)
 
+def push_texture_rows(texture : Union[int, str], data : Any, **kwargs) -> None:
+	"""	 Writes rows at a cursor that wraps around the texture (spectrograms, waterfalls). Images of the texture scroll so the newest row is at the bottom.
+
+	Args:
+		texture (Union[int, str]): 
+		data (Any): Whole rows in the texture's format.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.push_texture_rows(texture, data, **kwargs)
+
 def remove_alias(alias : str, **kwargs) -> None:
 	"""	 Removes an alias.
 
@@ -8563,6 +8692,30 @@ def set_axis_ticks(axis : Union[int, str], label_pairs : Any, **kwargs) -> None:
 
 	return internal_dpg.set_axis_ticks(axis, label_pairs, **kwargs)
 
+def set_callback_event_loop(loop : Any, **kwargs) -> None:
+	"""	 Sets the asyncio event loop coroutine callbacks (async def) are scheduled on as tasks. None stops accepting them.
+
+	Args:
+		loop (Any): 
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_callback_event_loop(loop, **kwargs)
+
+def set_callback_lane(item : Union[int, str], *, lane: str ='', parallel: bool =False, **kwargs) -> None:
+	"""	 Routes the callbacks of an item (widget or handler) to the callback workers set with configure_app(callback_workers=...). Other callbacks keep their order on the callback thread. Workers still take turns holding the GIL, so only callbacks releasing it (I/O, sleeping, native code) or free-threaded builds overlap.
+
+	Args:
+		item (Union[int, str]): 
+		lane (str, optional): Callbacks of items sharing a lane run one at a time, in order. Empty runs them on the callback thread again.
+		parallel (bool, optional): Runs the item's callbacks on any worker, with no ordering. They must be thread safe.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_callback_lane(item, lane=lane, parallel=parallel, **kwargs)
+
 def set_clip_space(item : Union[int, str], top_left_x : float, top_left_y : float, width : float, height : float, min_depth : float, max_depth : float, **kwargs) -> None:
 	"""	 New in 1.1. Set the clip space for depth clipping and 'viewport' transformation.
 
@@ -8651,6 +8804,19 @@ def set_primary_window(window : Union[int, str], value : bool, **kwargs) -> None
 
 	return internal_dpg.set_primary_window(window, value, **kwargs)
 
+def set_table_data(table : Union[int, str], columns : List[Any], *, formats: Union[List[str], Tuple[str, ...]] =[], **kwargs) -> None:
+	"""	 Binds columnar data to a table. Rows are drawn straight from the data (only the visible ones are formatted) instead of from table rows, so tables with millions of rows stay cheap to create and draw.
+
+	Args:
+		table (Union[int, str]): 
+		columns (List[Any]): One buffer, list of numbers or list of strings per column. An empty list unbinds the data.
+		formats (Union[List[str], Tuple[str, ...]], optional): printf style format per numeric column (e.g. '%.3f'). Defaults to '%g', or '%.0f' for integers.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_table_data(table, columns, formats=formats, **kwargs)
+
 def set_table_row_color(table : Union[int, str], row : int, color : Union[List[int], Tuple[int, ...]], **kwargs) -> None:
 	"""	 Set table row color.
 
@@ -8664,6 +8830,22 @@ def set_table_row_color(table : Union[int, str], row : int, color : Union[List[i
 
 	return internal_dpg.set_table_row_color(table, row, color, **kwargs)
 
+def set_texture_region(texture : Union[int, str], x : int, y : int, width : int, height : int, *, data: Any =None, **kwargs) -> None:
+	"""	 Updates a rectangle of a dynamic or raw texture. Only the rectangle is uploaded on the next frame.
+
+	Args:
+		texture (Union[int, str]): 
+		x (int): 
+		y (int): 
+		width (int): 
+		height (int): 
+		data (Any, optional): width*height pixels in the texture's format. Raw textures can leave it out to upload what was written to their buffer.
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_texture_region(texture, x, y, width, height, data=data, **kwargs)
+
 def set_value(item : Union[int, str], value : Any, **kwargs) -> None:
 	"""	 Set's an item's value.
 
@@ -8676,6 +8858,18 @@ def set_value(item : Union[int, str], value : Any, **kwargs) -> None:
 
 	return internal_dpg.set_value(item, value, **kwargs)
 
+def set_values(items : Union[List[int], Tuple[int, ...]], values : Any, **kwargs) -> None:
+	"""	 Set's the values of a list of items.
+
+	Args:
+		items (Union[List[int], Tuple[int, ...]]): 
+		values (Any): List of values or a buffer of numbers (same length as items).
+	Returns:
+		None
+	"""
+
+	return internal_dpg.set_values(items, values, **kwargs)
+
 def set_viewport_resize_callback(callback : Callable, **kwargs) -> str:
 	"""	 Sets a callback to run on viewport resize.
 
@@ -8793,7 +8987,7 @@ def split_frame(*, delay: int =32, **kwargs) -> None:
 	"""	 Waits one frame.
 
 	Args:
-		delay (int, optional): Minimal delay in in milliseconds
+		delay (int, optional): Unused, the render loop wakes the caller when the frame ends.
 	Returns:
 		None
 	"""
@@ -8900,6 +9094,17 @@ def unstage(item : Union[int, str], **kwargs) -> None:
 
 	return internal_dpg.unstage(item, **kwargs)
 
+def wait_for_frame(*, frame: int =-1, **kwargs) -> int:
+	"""	 Blocks, without holding the GIL, until a frame has rendered. Returns the last rendered frame, -1 once the context is destroyed.
+
+	Args:
+		frame (int, optional): Frame to wait for, -1 is the next one. Frames already rendered return right away.
+	Returns:
+		int
+	"""
+
+	return internal_dpg.wait_for_frame(frame=frame, **kwargs)
+
 
 ##########################################################
 # Constants #
@@ -9146,6 +9351,9 @@ def unstage(item : Union[int, str], **kwargs) -> None:
 mvPlotMarker_Cross=internal_dpg.mvPlotMarker_Cross
 mvPlotMarker_Plus=internal_dpg.mvPlotMarker_Plus
 mvPlotMarker_Asterisk=internal_dpg.mvPlotMarker_Asterisk
+mvPlotDownsample_None=internal_dpg.mvPlotDownsample_None
+mvPlotDownsample_MinMax=internal_dpg.mvPlotDownsample_MinMax
+mvPlotDownsample_LTTB=internal_dpg.mvPlotDownsample_LTTB
 mvPlot_Location_Center=internal_dpg.mvPlot_Location_Center
 mvPlot_Location_North=internal_dpg.mvPlot_Location_North
 mvPlot_Location_South=internal_dpg.mvPlot_Location_South
@@ -9159,8 +9367,15 @@ def unstage(item : Union[int, str], **kwargs) -> None:
 mvTable_SizingFixedSame=internal_dpg.mvTable_SizingFixedSame
 mvTable_SizingStretchProp=internal_dpg.mvTable_SizingStretchProp
 mvTable_SizingStretchSame=internal_dpg.mvTable_SizingStretchSame
+mvTable_SortKeyAuto=internal_dpg.mvTable_SortKeyAuto
+mvTable_SortKeyText=internal_dpg.mvTable_SortKeyText
+mvTable_SortKeyNumber=internal_dpg.mvTable_SortKeyNumber
 mvFormat_Float_rgba=internal_dpg.mvFormat_Float_rgba
 mvFormat_Float_rgb=internal_dpg.mvFormat_Float_rgb
+mvFormat_Byte_rgba=internal_dpg.mvFormat_Byte_rgba
+mvFormat_Byte_r=internal_dpg.mvFormat_Byte_r
+mvFormat_Byte_rg=internal_dpg.mvFormat_Byte_rg
+mvFormat_Half_rgba=internal_dpg.mvFormat_Half_rgba
 mvThemeCat_Core=internal_dpg.mvThemeCat_Core
 mvThemeCat_Plots=internal_dpg.mvThemeCat_Plots
 mvThemeCat_Nodes=internal_dpg.mvThemeCat_Nodes
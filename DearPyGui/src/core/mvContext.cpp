@@ -2,9 +2,12 @@
 #include "dearpygui.h"
 #include "mvViewport.h"
 #include "mvCallbackRegistry.h"
+#include "mvThreadPool.h"
+#include "mvFrameSignal.h"
 #include <thread>
 #include <future>
 #include <chrono>
+#include <algorithm>
 #include "mvProfiler.h"
 #include <implot.h>
 #include "mvFontManager.h"
@@ -185,6 +188,8 @@ namespace Marvel {
         GContext->time = ImGui::GetTime();
         GContext->frame = ImGui::GetFrameCount();
         GContext->framerate = (i32)ImGui::GetIO().Framerate;
+        GContext->textureBytesLastFrame = GContext->textureBytes;
+        GContext->textureBytes = 0;
 
         ImGui::GetIO().FontGlobalScale = mvToolManager::GetFontManager().getGlobalFontScale();
 
@@ -199,20 +204,40 @@ namespace Marvel {
         mvToolManager::Draw();
 
         {
-            std::lock_guard<std::mutex> lk(GContext->mutex);
+            std::lock_guard<std::recursive_mutex> lk(GContext->mutex);
             if (GContext->resetTheme)
             {
                 SetDefaultTheme();
                 GContext->resetTheme = false;
             }
 
+            mvRunCommands();
             mvRunTasks();
             RenderItemRegistry(*GContext->itemRegistry);
             mvRunTasks();
         }
 
-        if (GContext->waitOneFrame == true)
-            GContext->waitOneFrame = false;
+        SignalFrame(GContext->frame);
+    }
+
+    mvPySafeLockGuard::mvPySafeLockGuard(std::recursive_mutex& mutex)
+    {
+        if (GContext->manualMutexControl)
+            return;
+
+        if (!mutex.try_lock())
+        {
+            Py_BEGIN_ALLOW_THREADS;
+            mutex.lock();
+            Py_END_ALLOW_THREADS;
+        }
+        _mutex = &mutex;
+    }
+
+    mvPySafeLockGuard::~mvPySafeLockGuard()
+    {
+        if (_mutex)
+            _mutex->unlock();
     }
 
     std::map<std::string, mvPythonParser>& 
@@ -221,6 +246,15 @@ namespace Marvel {
         return const_cast<std::map<std::string, mvPythonParser>&>(GetModuleParsers());
     }
 
+    mvThreadPool&
+    GetThreadPool()
+    {
+        // only called with GContext->mutex held
+        if (GContext->threadPool == nullptr)
+            GContext->threadPool = new mvThreadPool(std::max(1u, std::thread::hardware_concurrency() / 2));
+        return *GContext->threadPool;
+    }
+
     void 
     InsertConstants_mvContext(std::vector<std::pair<std::string, long>>& constants)
     {
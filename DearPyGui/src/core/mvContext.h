@@ -9,6 +9,7 @@
 #include <future>
 #include <atomic>
 #include <memory>
+#include <mutex>
 #include "mvCore.h"
 #include "cpp.hint"
 #include "mvPythonParser.h"
@@ -27,7 +28,9 @@ namespace Marvel {
     struct mvItemRegistry;
     struct mvIO;
     struct mvContext;
+    struct mvImageDecoder;
     struct mvInput;
+    class  mvThreadPool;
 
     //-----------------------------------------------------------------------------
     // public API
@@ -39,6 +42,7 @@ namespace Marvel {
     void                                   SetDefaultTheme();
     void                                   Render();
     std::map<std::string, mvPythonParser>& GetParsers();
+    mvThreadPool&                          GetThreadPool(); // created on first use
 
     struct mvInput
     {
@@ -99,14 +103,26 @@ namespace Marvel {
         b8 skipRequiredArgs = false;
         b8 skipPositionalArgs = false;
         b8 skipKeywordArgs = false;
+
+        // commands
+        b8 deferredUpdates = false; // set_value/configure_item/delete_item applied by render thread
+
+        // callbacks
+        i32 callbackBatch = 64;        // queued callbacks run per GIL acquisition
+        i32 callbackQueueLimit = 0;    // queued callbacks past which new ones are dropped, 0 is unbounded
+        b8  callbackCoalescing = true; // continuous events keep only their newest queued call
+        b8  lazyItemState      = false; // interaction state only for items with handlers or queried lately (opt-in)
+        i32 callbackWorkers    = 0;    // threads running callbacks of routed items (set_callback_lane)
+
+        // textures
+        i32 decodeThreads = 2; // concurrent image decodes (load_image_async, file textures)
     };
 
     struct mvContext
     {
-        std::atomic_bool    waitOneFrame       = false;
         std::atomic_bool    manualMutexControl = false;
         std::atomic_bool    started            = false;
-        std::mutex          mutex;
+        std::recursive_mutex mutex;
         std::future<b8>     future;
         f32                 deltaTime = 0.0f;   // time since last frame
         f64                 time      = 0.0;    // total time since starting
@@ -118,10 +134,32 @@ namespace Marvel {
         mvIO                IO;
         mvItemRegistry*     itemRegistry = nullptr;
         mvCallbackRegistry* callbackRegistry = nullptr;
+        mvThreadPool*       threadPool = nullptr; // background work (i.e. plot lod)
+        mvImageDecoder*     imageDecoder = nullptr; // created on first decode
+        u64                 textureBytes = 0;          // uploaded by texture items this frame
+        u64                 textureBytesLastFrame = 0; // metrics window
         mvInput             input;
 
     };
     
+    //-----------------------------------------------------------------------------
+    // mvPySafeLockGuard
+    //     - Scoped lock of GContext->mutex for python commands. The GIL is
+    //       released while waiting because the render thread may need the GIL
+    //       while it holds the mutex (i.e. item destructors).
+    //     - Does nothing while the user holds the mutex (lock_mutex).
+    //-----------------------------------------------------------------------------
+    struct mvPySafeLockGuard
+    {
+        explicit mvPySafeLockGuard(std::recursive_mutex& mutex);
+        ~mvPySafeLockGuard();
+
+        mvPySafeLockGuard(const mvPySafeLockGuard& other) = delete;
+        mvPySafeLockGuard& operator=(const mvPySafeLockGuard& other) = delete;
+
+        std::recursive_mutex* _mutex = nullptr;
+    };
+
     //-----------------------------------------------------------------------------
     // Python Parsing
     //-----------------------------------------------------------------------------
@@ -0,0 +1,124 @@
+#include "mvFrameSignal.h"
+#include <mutex>
+#include <condition_variable>
+
+#if defined(__linux__)
+#include <sys/eventfd.h>
+#include <unistd.h>
+#elif !defined(_WIN32)
+#include <fcntl.h>
+#include <unistd.h>
+#endif
+
+namespace Marvel {
+
+	struct mvFrameSignal
+	{
+		std::mutex              mutex;
+		std::condition_variable signal;
+		i32                     frame = 0;        // last rendered
+		b8                      released = false; // context destroyed
+		i32                     wakeupRead = -1;
+		i32                     wakeupWrite = -1;
+	};
+
+	mv_internal mvFrameSignal&
+	GetFrameSignal()
+	{
+		mv_local_persist mvFrameSignal signal;
+		return signal;
+	}
+
+	mv_internal void
+	WakeFrameFd(i32 fd)
+	{
+		if (fd < 0)
+			return;
+
+		// a full pipe already has a wakeup pending
+#if defined(__linux__)
+		u64 one = 1;
+		(void)!write(fd, &one, sizeof(one));
+#elif !defined(_WIN32)
+		char byte = 0;
+		(void)!write(fd, &byte, 1);
+#endif
+	}
+
+	void
+	SignalFrame(i32 frame)
+	{
+		mvFrameSignal& signal = GetFrameSignal();
+		i32 fd = -1;
+		{
+			std::lock_guard<std::mutex> lock(signal.mutex);
+			signal.frame = frame;
+			fd = signal.wakeupWrite;
+		}
+		signal.signal.notify_all();
+		WakeFrameFd(fd);
+	}
+
+	void
+	ResetFrameSignal()
+	{
+		mvFrameSignal& signal = GetFrameSignal();
+		std::lock_guard<std::mutex> lock(signal.mutex);
+		signal.frame = 0;
+		signal.released = false;
+	}
+
+	void
+	ReleaseFrameWaiters()
+	{
+		mvFrameSignal& signal = GetFrameSignal();
+		i32 fd = -1;
+		{
+			std::lock_guard<std::mutex> lock(signal.mutex);
+			signal.released = true;
+			fd = signal.wakeupWrite;
+		}
+		signal.signal.notify_all();
+		WakeFrameFd(fd);
+	}
+
+	i32
+	WaitForFrame(i32 frame)
+	{
+		mvFrameSignal& signal = GetFrameSignal();
+		std::unique_lock<std::mutex> lock(signal.mutex);
+		if (frame < 0)
+			frame = signal.frame + 1;
+		signal.signal.wait(lock, [&signal, frame]() { return signal.released || signal.frame >= frame; });
+		return signal.released ? -1 : signal.frame;
+	}
+
+	i32
+	GetFrameWakeupFd()
+	{
+		mvFrameSignal& signal = GetFrameSignal();
+		std::lock_guard<std::mutex> lock(signal.mutex);
+		if (signal.wakeupRead >= 0)
+			return signal.wakeupRead;
+
+#if defined(__linux__)
+		i32 fd = eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
+		signal.wakeupRead = fd;
+		signal.wakeupWrite = fd;
+#elif !defined(_WIN32)
+		i32 fds[2];
+		if (pipe(fds) == 0)
+		{
+			for (i32 fd : fds)
+			{
+				fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
+				fcntl(fd, F_SETFD, FD_CLOEXEC);
+			}
+			signal.wakeupRead = fds[0];
+			signal.wakeupWrite = fds[1];
+		}
+#endif
+		return signal.wakeupRead;
+	}
+
+}
@@ -0,0 +1,30 @@
+#pragma once
+
+#include "mvTypes.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvFrameSignal
+    //     - wakes whoever waits for rendered frames (split_frame, wait_for_frame,
+    //       asyncio loops through get_frame_wakeup_fd) at the end of Render(),
+    //       instead of them sleep-polling
+    //     - the wakeup fd is an eventfd on linux and a non-blocking pipe on
+    //       other posix systems; windows has none (wait_for_frame instead)
+    //     - outlives contexts: waiters blocked while a context is destroyed
+    //       are released, and the fd stays valid for event loops watching it
+    //-----------------------------------------------------------------------------
+
+    void SignalFrame        (i32 frame); // end of Render()
+    void ResetFrameSignal   ();          // create_context
+    void ReleaseFrameWaiters();          // destroy_context, waiters get -1
+
+    // blocks until frame has rendered (-1 is the next one), call without
+    // the GIL; returns the last rendered frame, -1 once the context is gone
+    i32  WaitForFrame       (i32 frame);
+
+    // readable after every frame rendered since it was last drained, opened
+    // on first use; -1 where unsupported
+    i32  GetFrameWakeupFd   ();
+
+}
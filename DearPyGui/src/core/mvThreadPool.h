@@ -18,6 +18,7 @@
 #include <vector>
 #include <queue>
 #include <deque>
+#include <cstdint>
 #include "mvCore.h"
 
 namespace Marvel {
@@ -156,6 +157,158 @@ namespace Marvel {
 
     };
 
+    //-----------------------------------------------------------------------------
+    // mvMPSCQueue
+    //     - lock-free multiple producer, single consumer queue (Vyukov style).
+    //       push may be called from any thread, try_pop only from the consumer.
+    //-----------------------------------------------------------------------------
+    template<typename T>
+    class mvMPSCQueue
+    {
+
+        struct node
+        {
+            std::atomic<node*> next = nullptr;
+            T                  data;
+        };
+
+    public:
+
+        mvMPSCQueue() : m_head(new node), m_tail(m_head.load()) {}
+
+        ~mvMPSCQueue()
+        {
+            T value;
+            while (try_pop(value)) {}
+            delete m_tail;
+        }
+
+        // copy assignment and constructor deleted
+        mvMPSCQueue(const mvMPSCQueue& other) = delete;
+        mvMPSCQueue& operator=(const mvMPSCQueue& other) = delete;
+
+        void push(T value)
+        {
+            node* new_node = new node;
+            new_node->data = std::move(value);
+            m_size.fetch_add(1, std::memory_order_relaxed);
+            node* prev = m_head.exchange(new_node, std::memory_order_acq_rel);
+            prev->next.store(new_node, std::memory_order_release);
+        }
+
+        // consumer only
+        bool try_pop(T& value)
+        {
+            node* tail = m_tail;
+            node* next = tail->next.load(std::memory_order_acquire);
+            if (next == nullptr)
+                return false;
+
+            value = std::move(next->data);
+            m_tail = next;
+            delete tail;
+            m_size.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        // consumer only
+        bool empty() const { return m_tail->next.load(std::memory_order_acquire) == nullptr; }
+
+        // approximate, may include items still being linked by producers
+        size_t size() const { return m_size.load(std::memory_order_relaxed); }
+
+    private:
+
+        std::atomic<node*>  m_head;
+        node*               m_tail;
+        std::atomic<size_t> m_size = 0;
+
+    };
+
+    //-----------------------------------------------------------------------------
+    // mvRingQueue
+    //     - bounded lock-free multiple producer, single consumer queue over a
+    //       preallocated ring (Vyukov style), no allocation after construction.
+    //       try_push fails when the ring is full, try_pop is consumer only.
+    //     - capacity must be a power of two
+    //-----------------------------------------------------------------------------
+    template<typename T>
+    class mvRingQueue
+    {
+
+        struct cell
+        {
+            std::atomic<size_t> sequence;
+            T                   data;
+        };
+
+    public:
+
+        explicit mvRingQueue(size_t capacity)
+            : m_cells(new cell[capacity]), m_mask(capacity - 1)
+        {
+            for (size_t i = 0; i < capacity; i++)
+                m_cells[i].sequence.store(i, std::memory_order_relaxed);
+        }
+
+        // copy assignment and constructor deleted
+        mvRingQueue(const mvRingQueue& other) = delete;
+        mvRingQueue& operator=(const mvRingQueue& other) = delete;
+
+        bool try_push(const T& value)
+        {
+            cell* target = nullptr;
+            size_t pos = m_enqueue.load(std::memory_order_relaxed);
+            for (;;)
+            {
+                target = &m_cells[pos & m_mask];
+                size_t sequence = target->sequence.load(std::memory_order_acquire);
+                intptr_t diff = (intptr_t)sequence - (intptr_t)pos;
+                if (diff == 0)
+                {
+                    if (m_enqueue.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed))
+                        break;
+                }
+                else if (diff < 0)
+                    return false; // full
+                else
+                    pos = m_enqueue.load(std::memory_order_relaxed);
+            }
+
+            target->data = value;
+            target->sequence.store(pos + 1, std::memory_order_release);
+            return true;
+        }
+
+        // consumer only
+        bool try_pop(T& value)
+        {
+            cell& target = m_cells[m_dequeue & m_mask];
+            size_t sequence = target.sequence.load(std::memory_order_acquire);
+            if ((intptr_t)sequence - (intptr_t)(m_dequeue + 1) < 0)
+                return false;
+
+            value = target.data;
+            target.sequence.store(m_dequeue + m_mask + 1, std::memory_order_release);
+            m_dequeue++;
+            return true;
+        }
+
+        // consumer only
+        bool empty() const
+        {
+            return (intptr_t)m_cells[m_dequeue & m_mask].sequence.load(std::memory_order_acquire) - (intptr_t)(m_dequeue + 1) < 0;
+        }
+
+    private:
+
+        std::unique_ptr<cell[]> m_cells;
+        size_t                  m_mask;
+        std::atomic<size_t>     m_enqueue = 0;
+        size_t                  m_dequeue = 0;
+
+    };
+
     //-----------------------------------------------------------------------------
     // mvThreadJoiner
     //-----------------------------------------------------------------------------
@@ -276,14 +429,29 @@ namespace Marvel {
             }
         }
 
-        ~mvThreadPool() { m_done = true; }
+        ~mvThreadPool() { setDone(); }
 
         bool isReadyToDelete() const { return m_taskCount == 0; }
 
-        void setDone() { m_done = true; }
+        void setDone()
+        {
+            {
+                std::lock_guard<std::mutex> lock(m_idle_mutex);
+                m_done = true;
+            }
+            m_idle_cond.notify_all();
+        }
 
         static const char* getVersion() { return "v0.2"; }
 
+        // workers without a task, anything submitted past them waits for
+        // one to finish (i.e. fork/join work from a thread that waits on it)
+        unsigned getIdleCount() const
+        {
+            i32 busy = m_taskCount;
+            return busy >= (i32)m_threads.size() ? 0u : (unsigned)m_threads.size() - (unsigned)busy;
+        }
+
         template<typename F, typename ...Args>
         std::future<typename std::invoke_result<F, Args...>::type> submit(F f)
         {
@@ -292,11 +460,19 @@ namespace Marvel {
             std::future<result_type> res(task.get_future());
             m_done = false;
             m_taskCount++;
-            if (m_local_work_queue)
+            {
+                std::lock_guard<std::mutex> lock(m_idle_mutex);
+                m_queuedCount++;
+            }
+            // a worker of another pool submits to this pool's queue
+            if (m_local_work_queue && m_local_pool == this)
                 m_local_work_queue->push(std::move(task));
             else
                 m_pool_work_queue.push(std::move(task));
 
+            // wake an idle worker
+            m_idle_cond.notify_one();
+
             return res;
         }
 
@@ -307,6 +483,7 @@ namespace Marvel {
             m_index = index;
 
             m_local_work_queue = m_queues[m_index].get();
+            m_local_pool = this;
 
             while (!m_done || !isReadyToDelete())
                 run_pending_task();
@@ -319,13 +496,23 @@ namespace Marvel {
                 pop_task_from_pool_queue(task) ||
                 pop_task_from_other_thread_queue(task))
             {
+                m_queuedCount--;
                 task();
-                m_taskCount--;
+
+                // the last task lets sleeping workers exit
+                if (--m_taskCount == 0 && m_done)
+                {
+                    std::lock_guard<std::mutex> lock(m_idle_mutex);
+                    m_idle_cond.notify_all();
+                }
             }
 
+            // sleep until work is submitted instead of spinning
             else
-                std::this_thread::yield();
-
+            {
+                std::unique_lock<std::mutex> lock(m_idle_mutex);
+                m_idle_cond.wait(lock, [&] { return m_queuedCount > 0 || (m_done && isReadyToDelete()); });
+            }
 
         }
 
@@ -354,13 +541,17 @@ namespace Marvel {
     private:
 
         std::atomic_bool                                   m_done;
+        std::atomic_int                                    m_taskCount = 0;
+        std::atomic_int                                    m_queuedCount = 0; // submitted but not yet started
+        std::mutex                                         m_idle_mutex;      // declared before the joiner,
+        std::condition_variable                            m_idle_cond;       // workers use them until joined
         mvQueue<task_type>                                 m_pool_work_queue;
         std::vector<std::unique_ptr<mvWorkStealingQueue> > m_queues;
         std::vector<std::thread>                           m_threads;
         mvThreadJoiner                                     m_joiner;
-        static thread_local mvWorkStealingQueue*           m_local_work_queue;
-        static thread_local unsigned                       m_index;
-        std::atomic_int                                    m_taskCount = 0;
+        inline static thread_local mvWorkStealingQueue*    m_local_work_queue = nullptr;
+        inline static thread_local mvThreadPool*           m_local_pool = nullptr;
+        inline static thread_local unsigned                m_index = 0;
 
     };
 
@@ -14,20 +14,71 @@
 
 namespace Marvel {
 
+	// pixel layouts for array textures, values match the mvFormat_* constants
+	enum mvTextureFormat
+	{
+		mvTextureFormat_Float_rgba = 0,
+		mvTextureFormat_Float_rgb,
+		mvTextureFormat_Byte_rgba,
+		mvTextureFormat_Byte_r,
+		mvTextureFormat_Byte_rg,
+		mvTextureFormat_Half_rgba,
+		mvTextureFormat_Count
+	};
+
+	inline i32 GetTextureFormatComponents(i32 format)
+	{
+		switch (format)
+		{
+		case mvTextureFormat_Float_rgb: return 3;
+		case mvTextureFormat_Byte_r:    return 1;
+		case mvTextureFormat_Byte_rg:   return 2;
+		default:                        return 4;
+		}
+	}
+
+	inline i32 GetTextureFormatComponentSize(i32 format)
+	{
+		switch (format)
+		{
+		case mvTextureFormat_Byte_rgba:
+		case mvTextureFormat_Byte_r:
+		case mvTextureFormat_Byte_rg:   return 1;
+		case mvTextureFormat_Half_rgba: return 2;
+		default:                        return 4;
+		}
+	}
+
+	inline u64 GetTextureFormatBytes(u32 width, u32 height, i32 format)
+	{
+		return (u64)width * height * GetTextureFormatComponents(format) * GetTextureFormatComponentSize(format);
+	}
+
 	// general
 	void FreeTexture(void* texture);
 	b8 UnloadTexture(const std::string& filename);
 	
 	// static textures
 	void* LoadTextureFromFile(const char* filename, i32& width, i32& height);
-	void* LoadTextureFromArray(u32 width, u32 height, f32* data);
+	void* LoadTextureFromArray(u32 width, u32 height, const void* data, i32 format = mvTextureFormat_Float_rgba);
+
+	// streaming dynamic/raw textures upload through a ring of pixel buffers
+	// (OpenGL), others reuse one
+	constexpr u32 MaxPixelBuffers = 3u;
+	constexpr u64 PixelBufferTimeout = 100000000u; // ns, before refilling a buffer still being read
 
 	// dynamic textures
-	void* LoadTextureFromArrayDynamic(u32 width, u32 height, f32* data);
-	void  UpdateTexture(void* texture, u32 width, u32 height, std::vector<f32>& data);
+	void* LoadTextureFromArrayDynamic(u32 width, u32 height, const void* data, i32 format = mvTextureFormat_Float_rgba, u32 pixelBuffers = 1u);
+	void  UpdateTexture(void* texture, u32 width, u32 height, const void* data, i32 format = mvTextureFormat_Float_rgba);
 
 	// raw textures
-	void* LoadTextureFromArrayRaw(u32 width, u32 height, f32* data, i32 components);
-	void  UpdateRawTexture(void* texture, u32 width, u32 height, f32* data, i32 components);
+	void* LoadTextureFromArrayRaw(u32 width, u32 height, const void* data, i32 format, u32 pixelBuffers = 1u);
+	void  UpdateRawTexture(void* texture, u32 width, u32 height, const void* data, i32 format);
+
+	// dynamic and raw textures, data is the whole surface (rows are width apart)
+	void  UpdateTextureRegion(void* texture, u32 width, u32 height, const void* data, i32 format, u32 x, u32 y, u32 regionWidth, u32 regionHeight);
+
+	// copies what the gpu holds back in format's layout, from the rendering thread
+	b8    ReadTexturePixels(void* texture, u32 width, u32 height, i32 format, void* data);
 
 }
\ No newline at end of file
@@ -159,6 +159,10 @@ namespace Marvel {
 			ModuleConstants.push_back({ "mvPlotMarker_Plus",  8L});  // a plus marker will be rendered at each point (not filled)
 			ModuleConstants.push_back({ "mvPlotMarker_Asterisk",  9L}); // a asterisk marker will be rendered at each point (not filled)
 
+			ModuleConstants.push_back({ "mvPlotDownsample_None", 0L});    // every point is plotted
+			ModuleConstants.push_back({ "mvPlotDownsample_MinMax", 1L});  // min and max of every pixel column
+			ModuleConstants.push_back({ "mvPlotDownsample_LTTB", 2L});    // largest triangle three buckets, expects sorted x
+
 			ModuleConstants.push_back({ "mvPlot_Location_Center", ImPlotLocation_Center });
 			ModuleConstants.push_back({ "mvPlot_Location_North", ImPlotLocation_North });
 			ModuleConstants.push_back({ "mvPlot_Location_South", ImPlotLocation_South });
@@ -173,9 +177,16 @@ namespace Marvel {
 			ModuleConstants.push_back({ "mvTable_SizingFixedSame", ImGuiTableFlags_SizingFixedSame });
 			ModuleConstants.push_back({ "mvTable_SizingStretchProp", ImGuiTableFlags_SizingStretchProp});
 			ModuleConstants.push_back({ "mvTable_SizingStretchSame", ImGuiTableFlags_SizingStretchSame});
+			ModuleConstants.push_back({ "mvTable_SortKeyAuto", mvTableSortKey_Auto});
+			ModuleConstants.push_back({ "mvTable_SortKeyText", mvTableSortKey_Text});
+			ModuleConstants.push_back({ "mvTable_SortKeyNumber", mvTableSortKey_Number});
 
 			ModuleConstants.push_back({ "mvFormat_Float_rgba", 0L });
 			ModuleConstants.push_back({ "mvFormat_Float_rgb", 1L });
+			ModuleConstants.push_back({ "mvFormat_Byte_rgba", mvTextureFormat_Byte_rgba });
+			ModuleConstants.push_back({ "mvFormat_Byte_r", mvTextureFormat_Byte_r });
+			ModuleConstants.push_back({ "mvFormat_Byte_rg", mvTextureFormat_Byte_rg });
+			ModuleConstants.push_back({ "mvFormat_Half_rgba", mvTextureFormat_Half_rgba });
 
 			ModuleConstants.push_back({ "mvThemeCat_Core", 0L });
 			ModuleConstants.push_back({ "mvThemeCat_Plots", 1L});
@@ -420,6 +431,8 @@ namespace Marvel {
 		mvUUID before = 0;
 		std::string alias;
 
+		mvPySafeLockGuard lk(GContext->mutex);
+
 		PreFetchItemInfo(&id, &parent, &before, &alias, args, kwargs);
 
 		// generate id if not specified
@@ -528,6 +541,7 @@ namespace Marvel {
 		// plots
 		MV_ADD_COMMAND(is_plot_queried);
 		MV_ADD_COMMAND(get_plot_query_area);
+		MV_ADD_COMMAND(append_series_data);
 
 		// plot axes
 		MV_ADD_COMMAND(reset_axis_ticks);
@@ -549,6 +563,8 @@ namespace Marvel {
 		MV_ADD_COMMAND(is_table_column_highlighted);
 		MV_ADD_COMMAND(is_table_row_highlighted);
 		MV_ADD_COMMAND(is_table_cell_highlighted);
+		MV_ADD_COMMAND(set_table_data);
+		MV_ADD_COMMAND(get_table_data);
 
 		// themes
 		MV_ADD_COMMAND(bind_theme);
@@ -585,10 +601,19 @@ namespace Marvel {
 		MV_ADD_COMMAND(generate_uuid);
 		MV_ADD_COMMAND(save_init_file);
 		MV_ADD_COMMAND(load_image);
+		MV_ADD_COMMAND(load_image_async);
+		MV_ADD_COMMAND(set_texture_region);
+		MV_ADD_COMMAND(push_texture_rows);
+		MV_ADD_COMMAND(get_texture_pixels);
 		MV_ADD_COMMAND(split_frame);
+		MV_ADD_COMMAND(wait_for_frame);
+		MV_ADD_COMMAND(get_frame_wakeup_fd);
 		MV_ADD_COMMAND(get_frame_count);
 		MV_ADD_COMMAND(get_frame_rate);
 		MV_ADD_COMMAND(get_app_configuration);
+		MV_ADD_COMMAND(get_callback_statistics);
+		MV_ADD_COMMAND(set_callback_lane);
+		MV_ADD_COMMAND(set_callback_event_loop);
 		MV_ADD_COMMAND(configure_app);
 		MV_ADD_COMMAND(get_drawing_mouse_pos);
 		MV_ADD_COMMAND(is_mouse_button_dragging);
@@ -639,9 +664,11 @@ namespace Marvel {
 		MV_ADD_COMMAND(get_item_configuration);
 		MV_ADD_COMMAND(get_item_state);
 		MV_ADD_COMMAND(configure_item);
+		MV_ADD_COMMAND(configure_items);
 		MV_ADD_COMMAND(get_value);
 		MV_ADD_COMMAND(get_values);
 		MV_ADD_COMMAND(set_value);
+		MV_ADD_COMMAND(set_values);
 		MV_ADD_COMMAND(reset_pos);
 		MV_ADD_COMMAND(set_item_children);
 		MV_ADD_COMMAND(bind_item_handler_registry);
@@ -12,6 +12,10 @@
 #include <stb_image.h>
 #include "mvLog.h"
 #include "mvProfiler.h"
+#include "textures/mvTexturePixels.h"
+#include "textures/mvImageDecoder.h"
+#include "mvGlobalIntepreterLock.h"
+#include "mvFrameSignal.h"
 
 namespace Marvel {
 
@@ -24,7 +28,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["bind_colormap"], args, kwargs, __FUNCTION__, &itemraw, &sourceraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID source = GetIDFromPyObject(sourceraw);
@@ -98,7 +102,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["sample_colormap"], args, kwargs, __FUNCTION__, &itemraw, &t))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -140,7 +144,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_colormap_color"], args, kwargs, __FUNCTION__, &itemraw, &index))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -175,7 +179,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_file_dialog_info"], args, kwargs, __FUNCTION__, &file_dialog_raw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID file_dialog = GetIDFromPyObject(file_dialog_raw);
 
@@ -208,7 +212,7 @@ namespace Marvel {
 			&itemraw, &value))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -254,7 +258,7 @@ namespace Marvel {
 			&itemraw, &value))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -299,7 +303,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -343,7 +347,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -387,7 +391,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -431,7 +435,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -480,7 +484,7 @@ namespace Marvel {
 			&topleftx, &toplefty, &width, &height, &mindepth, &maxdepth))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -530,7 +534,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["apply_transform"], args, kwargs, __FUNCTION__, &itemraw, &transform))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -571,7 +575,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["create_rotation_matrix"], args, kwargs, __FUNCTION__, &angle, &axis))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvVec4 aaxis = ToVec4(axis);
 
@@ -597,7 +601,7 @@ namespace Marvel {
 			&fov, &aspect, &zNear, &zFar))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		PyObject* newbuffer = nullptr;
 		PymvMat4* newbufferview = nullptr;
@@ -623,7 +627,7 @@ namespace Marvel {
 			&left, &right, &bottom, &top, &zNear, &zFar))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		PyObject* newbuffer = nullptr;
 		PymvMat4* newbufferview = nullptr;
@@ -644,7 +648,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["create_translation_matrix"], args, kwargs, __FUNCTION__, &axis))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvVec4 aaxis = ToVec4(axis);
 
@@ -667,7 +671,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["create_scale_matrix"], args, kwargs, __FUNCTION__, &axis))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvVec4 aaxis = ToVec4(axis);
 
@@ -693,7 +697,7 @@ namespace Marvel {
 			&eye, &center, &up))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvVec4 aeye = ToVec4(eye);
 		mvVec4 acenter = ToVec4(center);
@@ -721,7 +725,7 @@ namespace Marvel {
 			&eye, &pitch, &yaw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvVec4 aeye = ToVec4(eye);
 		PyObject* newbuffer = nullptr;
@@ -744,7 +748,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -790,7 +794,7 @@ namespace Marvel {
 			&text, &wrap_width, &fontRaw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID font = GetIDFromPyObject(fontRaw);
 
@@ -845,7 +849,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_selected_nodes"], args, kwargs, __FUNCTION__, &node_editor_raw))
 			return ToPyBool(false);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -880,7 +884,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_selected_links"], args, kwargs, __FUNCTION__, &node_editor_raw))
 			return ToPyBool(false);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -914,7 +918,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["clear_selected_links"], args, kwargs, __FUNCTION__, &node_editor_raw))
 			return ToPyBool(false);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -948,7 +952,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["clear_selected_nodes"], args, kwargs, __FUNCTION__, &node_editor_raw))
 			return ToPyBool(false);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID node_editor = GetIDFromPyObject(node_editor_raw);
 
@@ -982,7 +986,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["is_plot_queried"], args, kwargs, __FUNCTION__, &plotraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1014,7 +1018,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_plot_query_area"], args, kwargs, __FUNCTION__, &plotraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1050,7 +1054,7 @@ namespace Marvel {
 
 		auto mlabel_pairs = ToVectPairStringFloat(label_pairs);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1094,7 +1098,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["set_axis_limits"], args, kwargs, __FUNCTION__, &axisraw, &ymin, &ymax))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1128,7 +1132,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["set_axis_limits_auto"], args, kwargs, __FUNCTION__, &axisraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1162,7 +1166,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["fit_axis_data"], args, kwargs, __FUNCTION__, &axisraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID axis = GetIDFromPyObject(axisraw);
 
@@ -1196,7 +1200,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_axis_limits"], args, kwargs, __FUNCTION__, &plotraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1229,7 +1233,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["reset_axis_ticks"], args, kwargs, __FUNCTION__, &plotraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID plot = GetIDFromPyObject(plotraw);
 
@@ -1255,6 +1259,77 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	mv_internal std::vector<f64>
+	ToSeriesSamples(PyObject* value)
+	{
+		// single sample or sequence/buffer of samples
+		if (PyFloat_Check(value) || PyLong_Check(value))
+			return { PyFloat_AsDouble(value) };
+		return ToDoubleVect(value);
+	}
+
+	mv_internal void
+	AppendItemSeriesData(mvUUID series, const std::vector<f64>& x, const std::vector<f64>& y)
+	{
+		mvAppItem* item = GetItem(*GContext->itemRegistry, series);
+		if (item == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "append_series_data",
+				"Item not found: " + std::to_string(series), nullptr);
+			return;
+		}
+
+		switch (item->_type)
+		{
+		case mvAppItemType::mvLineSeries:    static_cast<mvLineSeries*>(item)->appendData(x, y); break;
+		case mvAppItemType::mvScatterSeries: static_cast<mvScatterSeries*>(item)->appendData(x, y); break;
+		case mvAppItemType::mvStairSeries:   static_cast<mvStairSeries*>(item)->appendData(x, y); break;
+		default:
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "append_series_data",
+				"Incompatible type. Expected types include: mvLineSeries, mvScatterSeries, mvStairSeries", item);
+			break;
+		}
+	}
+
+	mv_internal mv_python_function
+	append_series_data(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* seriesraw;
+		PyObject* xraw;
+		PyObject* yraw;
+
+		if (!Parse((GetParsers())["append_series_data"], args, kwargs, __FUNCTION__, &seriesraw, &xraw, &yraw))
+			return GetPyNone();
+
+		// converted up front so deferred appends don't hold python objects
+		std::vector<f64> x = ToSeriesSamples(xraw);
+		std::vector<f64> y = ToSeriesSamples(yraw);
+
+		if (x.size() != y.size())
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "append_series_data",
+				"x and y must have the same number of samples.", nullptr);
+			return GetPyNone();
+		}
+
+		mvUUID series = GetIDFromPyObject(seriesraw);
+
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			mvSubmitCommand([series, x = std::move(x), y = std::move(y)]()
+				{
+					AppendItemSeriesData(series, x, y);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		AppendItemSeriesData(series, x, y);
+
+		return GetPyNone();
+	}
+
 	mv_internal mv_python_function
 	highlight_table_column(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -1265,7 +1340,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["highlight_table_column"], args, kwargs, __FUNCTION__, &tableraw, &column, &color))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1309,7 +1384,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["unhighlight_table_column"], args, kwargs, __FUNCTION__, &tableraw, &column))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1352,7 +1427,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["set_table_row_color"], args, kwargs, __FUNCTION__, &tableraw, &row, &color))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1396,7 +1471,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["unset_table_row_color"], args, kwargs, __FUNCTION__, &tableraw, &row))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1438,7 +1513,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["highlight_table_row"], args, kwargs, __FUNCTION__, &tableraw, &row, &color))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1482,7 +1557,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["unhighlight_table_row"], args, kwargs, __FUNCTION__, &tableraw, &row))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1526,7 +1601,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["highlight_table_cell"], args, kwargs, __FUNCTION__, &tableraw, &row, &column, &color))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1571,7 +1646,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["unhighlight_table_cell"], args, kwargs, __FUNCTION__, &tableraw, &row, &column))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1614,7 +1689,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["is_table_cell_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &row, &column))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1661,7 +1736,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["is_table_row_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &row))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1701,7 +1776,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["is_table_column_highlighted"], args, kwargs, __FUNCTION__, &tableraw, &column))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID table = GetIDFromPyObject(tableraw);
 
@@ -1732,6 +1807,101 @@ namespace Marvel {
 		return ToPyBool(tablecast->_columnColorsSet[column]);
 	}
 
+	mv_internal mv_python_function
+	set_table_data(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* tableraw;
+		PyObject* columns;
+		PyObject* formatsraw = nullptr;
+
+		if (!Parse((GetParsers())["set_table_data"], args, kwargs, __FUNCTION__, &tableraw, &columns, &formatsraw))
+			return GetPyNone();
+
+		std::vector<std::string> formats = ToStringVect(formatsraw);
+		for (const auto& format : formats)
+		{
+			if (!format.empty() && !IsTableDataFormat(format))
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "set_table_data",
+					"Format must contain a single floating point conversion: " + format, nullptr);
+				return GetPyNone();
+			}
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID table = GetIDFromPyObject(tableraw);
+
+		auto atable = GetItem(*GContext->itemRegistry, table);
+		if (atable == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_table_data",
+				"Item not found: " + std::to_string(table), nullptr);
+			return GetPyNone();
+		}
+
+		if (atable->_type != mvAppItemType::mvTable)
+		{
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "set_table_data",
+				"Incompatible type. Expected types include: mvTable", atable);
+			return GetPyNone();
+		}
+
+		mvTable* tablecast = static_cast<mvTable*>(atable);
+		b8 valid = SetTableData(tablecast->_data, columns, formats);
+		tablecast->_sortDirty = tablecast->_filterDirty = true;
+		if (!valid)
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "set_table_data",
+				"Table data must be a list of buffers, lists or tuples.", atable);
+			return GetPyNone();
+		}
+
+		return GetPyNone();
+	}
+
+	mv_internal mv_python_function
+	get_table_data(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* tableraw;
+
+		if (!Parse((GetParsers())["get_table_data"], args, kwargs, __FUNCTION__, &tableraw))
+			return GetPyNone();
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID table = GetIDFromPyObject(tableraw);
+
+		auto atable = GetItem(*GContext->itemRegistry, table);
+		if (atable == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "get_table_data",
+				"Item not found: " + std::to_string(table), nullptr);
+			return GetPyNone();
+		}
+
+		if (atable->_type != mvAppItemType::mvTable)
+		{
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "get_table_data",
+				"Incompatible type. Expected types include: mvTable", atable);
+			return GetPyNone();
+		}
+
+		// cells as they are drawn, one list per column
+		const mvTableData& data = static_cast<mvTable*>(atable)->_data;
+		PyObject* pycolumns = PyList_New((Py_ssize_t)data.columns.size());
+		char buffer[64];
+		for (size_t i = 0; i < data.columns.size(); i++)
+		{
+			PyObject* pycells = PyList_New(data.rows);
+			for (i32 row = 0; row < data.rows; row++)
+				PyList_SetItem(pycells, row, ToPyString(FormatTableDataCell(data.columns[i], row, buffer, sizeof(buffer))));
+			PyList_SetItem(pycolumns, (Py_ssize_t)i, pycells);
+		}
+
+		return pycolumns;
+	}
+
 	mv_internal mv_python_function
 	bind_theme(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -1742,7 +1912,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -1785,7 +1955,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["set_global_font_scale"], args, kwargs, __FUNCTION__, &scale))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		mvToolManager::GetFontManager().setGlobalFontScale(scale);
 
 		return GetPyNone();
@@ -1877,7 +2047,7 @@ namespace Marvel {
 	get_viewport_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		PyObject* pdict = PyDict_New();
 
@@ -1913,7 +2083,7 @@ namespace Marvel {
 	is_viewport_ok(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvViewport* viewport = GContext->viewport;
 		if (viewport)
@@ -2037,7 +2207,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	maximize_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		mvSubmitTask([=]()
 			{
 				mvMaximizeViewport();
@@ -2049,7 +2219,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	minimize_viewport(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		mvSubmitTask([=]()
 			{
 				mvMinimizeViewport();
@@ -2061,7 +2231,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	toggle_viewport_fullscreen(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		mvSubmitTask([=]()
 			{
 				mvToggleFullScreen();
@@ -2095,21 +2265,43 @@ namespace Marvel {
 			&delay))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
-
+		// no lock, the render thread needs it to finish the frame
 		Py_BEGIN_ALLOW_THREADS;
-		GContext->waitOneFrame = true;
-		while (GContext->waitOneFrame)
-			std::this_thread::sleep_for(std::chrono::milliseconds(delay));
+		WaitForFrame(-1);
 		Py_END_ALLOW_THREADS;
 
 		return GetPyNone();
 	}
 
+	mv_internal mv_python_function
+	wait_for_frame(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		i32 frame = -1;
+
+		if (!Parse((GetParsers())["wait_for_frame"], args, kwargs, __FUNCTION__,
+			&frame))
+			return GetPyNone();
+
+		i32 rendered = 0;
+		Py_BEGIN_ALLOW_THREADS;
+		rendered = WaitForFrame(frame);
+		Py_END_ALLOW_THREADS;
+
+		return ToPyInt(rendered);
+	}
+
+	mv_internal mv_python_function
+	get_frame_wakeup_fd(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		return ToPyInt(GetFrameWakeupFd());
+	}
+
 	mv_internal mv_python_function
 	lock_mutex(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
+		Py_BEGIN_ALLOW_THREADS;
 		GContext->mutex.lock();
+		Py_END_ALLOW_THREADS;
 		GContext->manualMutexControl = true;
 
 		return GetPyNone();
@@ -2127,7 +2319,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	get_frame_count(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		return ToPyInt(GContext->frame);
 	}
 
@@ -2137,11 +2329,41 @@ namespace Marvel {
 		const char* file;
 		f32 gamma = 1.0f;
 		f32 gamma_scale = 1.0f;
+		i32 format = mvTextureFormat_Float_rgba;
 
 		if (!Parse((GetParsers())["load_image"], args, kwargs, __FUNCTION__,
-			&file, &gamma, &gamma_scale))
+			&file, &gamma, &gamma_scale, &format))
 			return GetPyNone();
 
+		// Load from disk into a raw RGBA buffer
+		i32 image_width = 0;
+		i32 image_height = 0;
+
+		// 8 bit pixels as stored, no float conversion
+		if (format == mvTextureFormat_Byte_rgba || format == mvTextureFormat_Byte_r || format == mvTextureFormat_Byte_rg)
+		{
+			i32 components = GetTextureFormatComponents(format);
+			unsigned char* image_data = stbi_load(file, &image_width, &image_height, NULL, components);
+			if (image_data == NULL)
+				return GetPyNone();
+
+			PyObject* newbuffer = PyByteArray_FromStringAndSize((const char*)image_data, (Py_ssize_t)image_width * image_height * components);
+			stbi_image_free(image_data);
+
+			PyObject* result = PyTuple_New(4);
+			PyTuple_SetItem(result, 0, Py_BuildValue("i", image_width));
+			PyTuple_SetItem(result, 1, Py_BuildValue("i", image_height));
+			PyTuple_SetItem(result, 2, PyLong_FromLong(components));
+			PyTuple_SetItem(result, 3, newbuffer);
+			return result;
+		}
+
+		if (format != mvTextureFormat_Float_rgba)
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "load_image", "Images load as mvFormat_Float_rgba or one of the byte formats.", nullptr);
+			return GetPyNone();
+		}
+
 		// Vout = (Vin / 255)^v; Where v = gamma
 
 		if (stbi_is_hdr(file))
@@ -2155,11 +2377,6 @@ namespace Marvel {
 			stbi_ldr_to_hdr_scale(gamma_scale);
 		}
 
-
-		// Load from disk into a raw RGBA buffer
-		i32 image_width = 0;
-		i32 image_height = 0;
-
 		// automatic gamma correction
 		f32* image_data = stbi_loadf(file, &image_width, &image_height, NULL, 4);
 		if (image_data == NULL)
@@ -2181,6 +2398,296 @@ namespace Marvel {
 		return result;
 	}
 
+	mv_internal mv_python_function
+	load_image_async(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		const char* file;
+		PyObject* callback;
+		f32 gamma = 1.0f;
+		f32 gamma_scale = 1.0f;
+		i32 format = mvTextureFormat_Float_rgba;
+		PyObject* user_data = nullptr;
+
+		if (!Parse((GetParsers())["load_image_async"], args, kwargs, __FUNCTION__,
+			&file, &callback, &gamma, &gamma_scale, &format, &user_data))
+			return GetPyNone();
+
+		if (!IsDecodableTextureFormat(format))
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "load_image_async", "Images load as mvFormat_Float_rgba or one of the byte formats.", nullptr);
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID id = GenerateUUID();
+		mvRef<mvImageDecode> decode = CreateRef<mvImageDecode>();
+		decode->file = file;
+		decode->gamma = gamma;
+		decode->gammaScale = gamma_scale;
+		decode->format = format;
+
+		user_data = user_data == Py_None ? nullptr : user_data;
+		Py_XINCREF(callback);
+		Py_XINCREF(user_data);
+
+		decode->done = [callback, user_data, id](mvImageDecode& decode, b8 cancelled)
+		{
+			if (cancelled)
+			{
+				mvGlobalIntepreterLock gil;
+				Py_XDECREF(callback);
+				Py_XDECREF(user_data);
+				return;
+			}
+
+			// queued even past the queue limit, a finished decode isn't dropped
+			mvRef<mvImageDecode> result = CreateRef<mvImageDecode>();
+			result->width = decode.width;
+			result->height = decode.height;
+			result->failed = decode.failed;
+			result->format = decode.format;
+			result->pixels = std::move(decode.pixels);
+
+			GContext->callbackRegistry->callCount++;
+			mvPushCallback(mvFunctionWrapper([callback, user_data, id, result]()
+				{
+					// same as load_image, None if the file couldn't be loaded
+					PyObject* app_data = nullptr;
+					if (!result->failed)
+					{
+						i32 components = GetTextureFormatComponents(result->format);
+						PyObject* pixels = nullptr;
+						if (result->format == mvTextureFormat_Float_rgba)
+						{
+							PymvBuffer* bufferview = PyObject_New(PymvBuffer, &PymvBufferType);
+							bufferview->arr.length = (i32)(result->pixels.size() / sizeof(f32));
+							bufferview->arr.data = new f32[bufferview->arr.length];
+							memcpy(bufferview->arr.data, result->pixels.data(), result->pixels.size());
+							pixels = PyObject_Init((PyObject*)bufferview, &PymvBufferType);
+						}
+						else
+							pixels = PyByteArray_FromStringAndSize((const char*)result->pixels.data(), (Py_ssize_t)result->pixels.size());
+
+						app_data = PyTuple_New(4);
+						PyTuple_SetItem(app_data, 0, Py_BuildValue("i", result->width));
+						PyTuple_SetItem(app_data, 1, Py_BuildValue("i", result->height));
+						PyTuple_SetItem(app_data, 2, PyLong_FromLong(components));
+						PyTuple_SetItem(app_data, 3, pixels);
+					}
+
+					mvRunCallback(callback, id, app_data, user_data);
+					Py_XDECREF(app_data);
+					Py_XDECREF(callback);
+					Py_XDECREF(user_data);
+				}));
+		};
+
+		SubmitImageDecode(decode);
+
+		return ToPyUUID(id);
+	}
+
+	mv_internal mv_python_function
+	set_texture_region(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* textureraw;
+		i32 x = 0;
+		i32 y = 0;
+		i32 width = 0;
+		i32 height = 0;
+		PyObject* data = nullptr;
+
+		if (!Parse((GetParsers())["set_texture_region"], args, kwargs, __FUNCTION__,
+			&textureraw, &x, &y, &width, &height, &data))
+			return GetPyNone();
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID texture = GetIDFromPyObject(textureraw);
+
+		auto atexture = GetItem(*GContext->itemRegistry, texture);
+		if (atexture == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_texture_region",
+				"Item not found: " + std::to_string(texture), nullptr);
+			return GetPyNone();
+		}
+
+		if (atexture->_type != mvAppItemType::mvDynamicTexture && atexture->_type != mvAppItemType::mvRawTexture)
+		{
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "set_texture_region",
+				"Incompatible type. Expected types include: mvDynamicTexture, mvRawTexture", atexture);
+			return GetPyNone();
+		}
+
+		if (x < 0 || y < 0 || width <= 0 || height <= 0 || x + width > atexture->_width || y + height > atexture->_height)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "set_texture_region", "Region is outside of the texture.", atexture);
+			return GetPyNone();
+		}
+
+		b8 raw = atexture->_type == mvAppItemType::mvRawTexture;
+		mvTextureRect rect = { (u32)x, (u32)y, (u32)width, (u32)height };
+
+		// raw textures can report changes already made to their buffer
+		if (data == nullptr || data == Py_None)
+		{
+			if (!raw)
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "set_texture_region", "Dynamic textures require data.", atexture);
+				return GetPyNone();
+			}
+			static_cast<mvRawTexture*>(atexture)->setRegion(rect, nullptr);
+			return GetPyNone();
+		}
+
+		if (raw && !static_cast<mvRawTexture*>(atexture)->isWritable())
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "set_texture_region", "Raw texture buffer is read only.", atexture);
+			return GetPyNone();
+		}
+
+		i32 format = GetTextureItemFormat(atexture);
+		std::vector<u8> pixels;
+		if (!SetTexturePixels(pixels, format, data))
+			return GetPyNone();
+
+		if ((u64)pixels.size() != GetTextureFormatBytes((u32)width, (u32)height, format))
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "set_texture_region", "Data doesn't match the region size.", atexture);
+			return GetPyNone();
+		}
+
+		if (raw)
+			static_cast<mvRawTexture*>(atexture)->setRegion(rect, pixels.data());
+		else
+			static_cast<mvDynamicTexture*>(atexture)->setRegion(rect, pixels.data());
+
+		return GetPyNone();
+	}
+
+	mv_internal mv_python_function
+	push_texture_rows(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* textureraw;
+		PyObject* data;
+
+		if (!Parse((GetParsers())["push_texture_rows"], args, kwargs, __FUNCTION__,
+			&textureraw, &data))
+			return GetPyNone();
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID texture = GetIDFromPyObject(textureraw);
+
+		auto atexture = GetItem(*GContext->itemRegistry, texture);
+		if (atexture == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "push_texture_rows",
+				"Item not found: " + std::to_string(texture), nullptr);
+			return GetPyNone();
+		}
+
+		if (atexture->_type != mvAppItemType::mvDynamicTexture && atexture->_type != mvAppItemType::mvRawTexture)
+		{
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "push_texture_rows",
+				"Incompatible type. Expected types include: mvDynamicTexture, mvRawTexture", atexture);
+			return GetPyNone();
+		}
+
+		b8 raw = atexture->_type == mvAppItemType::mvRawTexture;
+		if (raw && !static_cast<mvRawTexture*>(atexture)->isWritable())
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "push_texture_rows", "Raw texture buffer is read only.", atexture);
+			return GetPyNone();
+		}
+
+		i32 format = GetTextureItemFormat(atexture);
+		std::vector<u8> pixels;
+		if (!SetTexturePixels(pixels, format, data))
+			return GetPyNone();
+
+		u64 rowSize = GetTextureFormatBytes((u32)atexture->_width, 1u, format);
+		if (rowSize == 0u || pixels.empty() || pixels.size() % rowSize != 0u)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "push_texture_rows", "Data must be whole rows of the texture.", atexture);
+			return GetPyNone();
+		}
+
+		u32 rows = (u32)(pixels.size() / rowSize);
+		if (raw)
+			static_cast<mvRawTexture*>(atexture)->pushRows(pixels.data(), rows);
+		else
+			static_cast<mvDynamicTexture*>(atexture)->pushRows(pixels.data(), rows);
+
+		return GetPyNone();
+	}
+
+	mv_internal mv_python_function
+	get_texture_pixels(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* textureraw;
+
+		if (!Parse((GetParsers())["get_texture_pixels"], args, kwargs, __FUNCTION__,
+			&textureraw))
+			return GetPyNone();
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID texture = GetIDFromPyObject(textureraw);
+
+		auto atexture = GetItem(*GContext->itemRegistry, texture);
+		if (atexture == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "get_texture_pixels",
+				"Item not found: " + std::to_string(texture), nullptr);
+			return GetPyNone();
+		}
+
+		void* handle = nullptr;
+		u32 width = (u32)atexture->_width;
+		u32 height = (u32)atexture->_height;
+		if (atexture->_type == mvAppItemType::mvDynamicTexture)
+			handle = static_cast<mvDynamicTexture*>(atexture)->getRawTexture();
+		else if (atexture->_type == mvAppItemType::mvRawTexture)
+			handle = static_cast<mvRawTexture*>(atexture)->getRawTexture();
+		else if (atexture->_type == mvAppItemType::mvHeatSeries)
+		{
+			mvHeatSeries* series = static_cast<mvHeatSeries*>(atexture);
+			handle = series->getRawTexture();
+			width = (u32)series->getTextureWidth();
+			height = (u32)series->getTextureHeight();
+		}
+		else
+		{
+			mvThrowPythonError(mvErrorCode::mvIncompatibleType, "get_texture_pixels",
+				"Incompatible type. Expected types include: mvDynamicTexture, mvRawTexture, mvHeatSeries", atexture);
+			return GetPyNone();
+		}
+
+		if (handle == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "get_texture_pixels", "Texture hasn't been uploaded yet.", atexture);
+			return GetPyNone();
+		}
+
+		i32 format = GetTextureItemFormat(atexture);
+		std::vector<u8> pixels((size_t)GetTextureFormatBytes(width, height, format));
+		if (!ReadTexturePixels(handle, width, height, format, pixels.data()))
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "get_texture_pixels", "Texture could not be read back.", atexture);
+			return GetPyNone();
+		}
+
+		if (IsFloatTextureFormat(format))
+		{
+			const f32* values = reinterpret_cast<const f32*>(pixels.data());
+			return ToPyList(std::vector<f32>(values, values + pixels.size() / sizeof(f32)));
+		}
+		return ToPyTexturePixels(pixels, format);
+	}
+
 	mv_internal mv_python_function
 	is_dearpygui_running(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -2191,7 +2698,7 @@ namespace Marvel {
 	setup_dearpygui(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		Py_BEGIN_ALLOW_THREADS;
 
@@ -2241,6 +2748,7 @@ namespace Marvel {
 		{
 
 			GContext = new mvContext();
+			ResetFrameSignal();
 
 			GContext->itemRegistry = new mvItemRegistry();
 			GContext->callbackRegistry = new mvCallbackRegistry();
@@ -2260,7 +2768,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	destroy_context(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		//if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		//mvPySafeLockGuard lk(GContext->mutex);
 
 		Py_BEGIN_ALLOW_THREADS;
 
@@ -2271,15 +2779,19 @@ namespace Marvel {
 
 		else
 		{
+			ReleaseFrameWaiters();
+
 			// hacky fix, started was set to false
 			// to exit the event loop, but needs to be
 			// true in order to run DPG commands for the 
 			// exit callback.
+			// both queued even past the queue limit
 			GContext->started = true;
-			mvSubmitCallback([=]() {
+			GContext->callbackRegistry->callCount++;
+			mvPushCallback(mvFunctionWrapper([=]() {
 				mvRunCallback(GContext->callbackRegistry->onCloseCallback, 0, nullptr, nullptr);
 				GContext->started = false;  // return to false after
-				});
+				}));
 
 			imnodes::DestroyContext();
 			ImPlot::DestroyContext();
@@ -2295,16 +2807,19 @@ namespace Marvel {
 			MV_ITEM_TYPES
 			#undef X
 
-			mvSubmitCallback([=]() {
+			GContext->callbackRegistry->callCount++;
+			mvPushCallback(mvFunctionWrapper([=]() {
 				GContext->callbackRegistry->running = false;
-					});
+					}));
 			if (GContext->future.valid())
 				GContext->future.get();
 			if (GContext->viewport)
 				delete GContext->viewport;
 
 			delete GContext->itemRegistry;
+			delete GContext->imageDecoder; // before the callbacks it completes into
 			delete GContext->callbackRegistry;
+			delete GContext->threadPool; // items have finished their jobs
 			delete GContext;
 			GContext = nullptr;
 		}
@@ -2316,7 +2831,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	stop_dearpygui(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		GContext->started = false;
 		auto viewport = GContext->viewport;
 		if (viewport)
@@ -2327,14 +2842,14 @@ namespace Marvel {
 	mv_internal mv_python_function
 	get_total_time(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		return ToPyFloat((f32)GContext->time);
 	}
 
 	mv_internal mv_python_function
 	get_delta_time(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		return ToPyFloat(GContext->deltaTime);
 
 	}
@@ -2342,7 +2857,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	get_frame_rate(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		return ToPyFloat((f32)GContext->framerate);
 
 	}
@@ -2369,7 +2884,7 @@ namespace Marvel {
 			return GetPyNone();
 		}
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		if (PyObject* item = PyDict_GetItemString(kwargs, "auto_device")) GContext->IO.info_auto_device = ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "docking")) GContext->IO.docking = ToBool(item);
@@ -2388,6 +2903,13 @@ namespace Marvel {
 		if (PyObject* item = PyDict_GetItemString(kwargs, "skip_required_args")) GContext->IO.skipRequiredArgs = ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "auto_save_init_file")) GContext->IO.autoSaveIniFile = ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "wait_for_input")) GContext->IO.waitForInput = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "deferred_updates")) GContext->IO.deferredUpdates = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "decode_threads")) GContext->IO.decodeThreads = std::max(ToInt(item), 1);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "callback_batch")) GContext->IO.callbackBatch = std::max(ToInt(item), 1);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "callback_queue_limit")) GContext->IO.callbackQueueLimit = std::max(ToInt(item), 0);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "callback_coalescing")) GContext->IO.callbackCoalescing = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "lazy_item_state")) GContext->IO.lazyItemState = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(kwargs, "callback_workers")) GContext->IO.callbackWorkers = std::max(ToInt(item), 0);
 
 		if (PyObject* item = PyDict_GetItemString(kwargs, "init_file")) GContext->IO.iniFile = ToString(item);
 		if (PyObject* item = PyDict_GetItemString(kwargs, "device_name")) GContext->IO.info_device_name = ToString(item);
@@ -2399,7 +2921,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	get_app_configuration(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		PyObject* pdict = PyDict_New();
 		PyDict_SetItemString(pdict, "auto_device", mvPyObject(ToPyBool(GContext->IO.info_auto_device)));
 		PyDict_SetItemString(pdict, "docking", mvPyObject(ToPyBool(GContext->IO.docking)));
@@ -2417,11 +2939,96 @@ namespace Marvel {
 		PyDict_SetItemString(pdict, "skip_keyword_args", mvPyObject(ToPyBool(GContext->IO.skipKeywordArgs)));
 		PyDict_SetItemString(pdict, "skip_positional_args", mvPyObject(ToPyBool(GContext->IO.skipPositionalArgs)));
 		PyDict_SetItemString(pdict, "skip_required_args", mvPyObject(ToPyBool(GContext->IO.skipRequiredArgs)));
+		PyDict_SetItemString(pdict, "deferred_updates", mvPyObject(ToPyBool(GContext->IO.deferredUpdates)));
+		PyDict_SetItemString(pdict, "decode_threads", mvPyObject(ToPyInt(GContext->IO.decodeThreads)));
+		PyDict_SetItemString(pdict, "callback_batch", mvPyObject(ToPyInt(GContext->IO.callbackBatch)));
+		PyDict_SetItemString(pdict, "callback_queue_limit", mvPyObject(ToPyInt(GContext->IO.callbackQueueLimit)));
+		PyDict_SetItemString(pdict, "callback_coalescing", mvPyObject(ToPyBool(GContext->IO.callbackCoalescing)));
+		PyDict_SetItemString(pdict, "lazy_item_state", mvPyObject(ToPyBool(GContext->IO.lazyItemState)));
+		PyDict_SetItemString(pdict, "callback_workers", mvPyObject(ToPyInt(GContext->IO.callbackWorkers)));
 		PyDict_SetItemString(pdict, "auto_save_init_file", mvPyObject(ToPyBool(GContext->IO.autoSaveIniFile)));
 		PyDict_SetItemString(pdict, "wait_for_input", mvPyObject(ToPyBool(GContext->IO.waitForInput)));
 		return pdict;
 	}
 
+	mv_internal mv_python_function
+	get_callback_statistics(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		i32 reset = false;
+
+		if (!Parse((GetParsers())["get_callback_statistics"], args, kwargs, __FUNCTION__, &reset))
+			return GetPyNone();
+
+		// copied first, workers take the mutex while holding the GIL
+		mvCallbackStatistics statistics;
+		{
+			std::lock_guard<std::mutex> lock(GContext->callbackRegistry->statisticsMutex);
+			statistics = GContext->callbackRegistry->statistics;
+			if (reset)
+				GContext->callbackRegistry->statistics = mvCallbackStatistics();
+		}
+
+		PyObject* pdict = PyDict_New();
+		PyDict_SetItemString(pdict, "calls", mvPyObject(ToPyLong((long)statistics.calls)));
+		PyDict_SetItemString(pdict, "batches", mvPyObject(ToPyLong((long)statistics.batches)));
+		PyDict_SetItemString(pdict, "latency_mean", mvPyObject(ToPyDouble(statistics.calls ? statistics.latency / statistics.calls : 0.0)));
+		PyDict_SetItemString(pdict, "latency_max", mvPyObject(ToPyDouble(statistics.maxLatency)));
+		PyDict_SetItemString(pdict, "queue_depth", mvPyObject(ToPyInt(GContext->callbackRegistry->callCount)));
+		PyDict_SetItemString(pdict, "coalesced", mvPyObject(ToPyLong((long)GContext->callbackRegistry->coalescedCalls)));
+		PyDict_SetItemString(pdict, "dropped", mvPyObject(ToPyLong((long)GContext->callbackRegistry->droppedCalls)));
+
+		if (reset)
+		{
+			GContext->callbackRegistry->coalescedCalls = 0;
+			GContext->callbackRegistry->droppedCalls = 0;
+		}
+
+		return pdict;
+	}
+
+	mv_internal mv_python_function
+	set_callback_event_loop(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* loop = nullptr;
+
+		if (!Parse((GetParsers())["set_callback_event_loop"], args, kwargs, __FUNCTION__,
+			&loop))
+			return GetPyNone();
+
+		// only touched with the GIL
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+		Py_XDECREF(registry.eventLoop);
+		registry.eventLoop = loop == Py_None ? nullptr : loop;
+		Py_XINCREF(registry.eventLoop);
+
+		return GetPyNone();
+	}
+
+	mv_internal mv_python_function
+	set_callback_lane(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* itemraw;
+		const char* lane = "";
+		i32 parallel = false;
+
+		if (!Parse((GetParsers())["set_callback_lane"], args, kwargs, __FUNCTION__,
+			&itemraw, &lane, &parallel))
+			return GetPyNone();
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		mvUUID item = GetIDFromPyObject(itemraw);
+		if (GetItem((*GContext->itemRegistry), item) == nullptr)
+		{
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_callback_lane",
+				"Item not found: " + std::to_string(item), nullptr);
+			return GetPyNone();
+		}
+
+		mvSetCallbackLane(item, lane, parallel);
+		return GetPyNone();
+	}
+
 	mv_internal mv_python_function
 	get_mouse_pos(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -2565,7 +3172,7 @@ namespace Marvel {
 	pop_container_stack(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		if (GContext->itemRegistry->containers.empty())
 		{
@@ -2588,7 +3195,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	empty_container_stack(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 		while (!GContext->itemRegistry->containers.empty())
 			GContext->itemRegistry->containers.pop();
 		return GetPyNone();
@@ -2597,7 +3204,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	top_container_stack(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvAppItem* item = nullptr;
 		if (!GContext->itemRegistry->containers.empty())
@@ -2612,7 +3219,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	last_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		return ToPyUUID(GContext->itemRegistry->lastItemAdded);
 	}
@@ -2620,7 +3227,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	last_container(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		return ToPyUUID(GContext->itemRegistry->lastContainerAdded);
 	}
@@ -2628,7 +3235,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	last_root(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		return ToPyUUID(GContext->itemRegistry->lastRootAdded);
 	}
@@ -2641,7 +3248,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["push_container_stack"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2669,7 +3276,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["set_primary_window"], args, kwargs, __FUNCTION__, &itemraw, &value))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2702,7 +3309,7 @@ namespace Marvel {
 	mv_internal mv_python_function
 	get_active_window(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		return ToPyUUID(GContext->itemRegistry->activeWindow);
 	}
@@ -2719,7 +3326,7 @@ namespace Marvel {
 			&itemraw, &parentraw, &beforeraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID parent = GetIDFromPyObject(parentraw);
@@ -2741,7 +3348,19 @@ namespace Marvel {
 		if (!Parse((GetParsers())["delete_item"], args, kwargs, __FUNCTION__, &itemraw, &childrenOnly, &slot))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			Py_XINCREF(itemraw);
+			mvSubmitCommand([itemraw, childrenOnly, slot]()
+				{
+					mvUUID item = GetIDFromPyObject(itemraw);
+					DeleteItem((*GContext->itemRegistry), item, childrenOnly, slot);
+					Py_XDECREF(itemraw);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2760,7 +3379,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["does_item_exist"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2778,7 +3397,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["move_item_up"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2797,7 +3416,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["move_item_down"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2818,7 +3437,7 @@ namespace Marvel {
 			&containerraw, &slot, &new_order))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		auto anew_order = ToUUIDVect(new_order);
 		mvUUID container = GetIDFromPyObject(containerraw);
@@ -2843,6 +3462,7 @@ namespace Marvel {
 			}
 		}
 		children = newchildren;
+		parent->onChildrenReordered();
 		return GetPyNone();
 	}
 
@@ -2855,7 +3475,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["unstage"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2876,10 +3496,7 @@ namespace Marvel {
 		}
 
 		if (item_found)
-		{
-			CleanUpItem(*GContext->itemRegistry, item);
 			return GetPyNone();
-		}
 
 		mvThrowPythonError(mvErrorCode::mvItemNotFound, "unstage",
 			"Stage not found: " + std::to_string(item), nullptr);
@@ -2897,7 +3514,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["show_item_debug"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -2957,7 +3574,7 @@ namespace Marvel {
 	get_all_items(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		std::vector<mvUUID> childList;
 
@@ -2982,7 +3599,7 @@ namespace Marvel {
 	show_imgui_demo(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		GContext->itemRegistry->showImGuiDebug = true;
 		return GetPyNone();
@@ -2992,7 +3609,7 @@ namespace Marvel {
 	show_implot_demo(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		GContext->itemRegistry->showImPlotDebug = true;
 		return GetPyNone();
@@ -3002,7 +3619,7 @@ namespace Marvel {
 	get_windows(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		std::vector<mvUUID> childList;
 		for (auto& root : GContext->itemRegistry->colormapRoots) childList.emplace_back(root->_uuid);
@@ -3032,7 +3649,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["add_alias"], args, kwargs, __FUNCTION__, &alias, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3051,7 +3668,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["remove_alias"], args, kwargs, __FUNCTION__, &alias))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		RemoveAlias((*GContext->itemRegistry), alias);
 
@@ -3068,7 +3685,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["does_alias_exist"], args, kwargs, __FUNCTION__, &alias))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		bool result = GContext->itemRegistry->aliases.count(alias) != 0;
 
@@ -3084,7 +3701,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_alias_id"], args, kwargs, __FUNCTION__, &alias))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID result = GetIdFromAlias((*GContext->itemRegistry), alias);
 
@@ -3095,7 +3712,7 @@ namespace Marvel {
 	get_aliases(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		std::vector<std::string> aliases;
 
@@ -3115,7 +3732,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3146,7 +3763,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["focus_item"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 
@@ -3216,7 +3833,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_item_info"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3279,6 +3896,8 @@ namespace Marvel {
 			PyDict_SetItemString(pdict, "toggled_open_handler_applicable", mvPyObject(ToPyBool(applicableState & MV_STATE_TOGGLED_OPEN)));
 			PyDict_SetItemString(pdict, "resized_handler_applicable", mvPyObject(ToPyBool(applicableState & MV_STATE_RECT_SIZE)));
 
+			appitem->getSpecificInfo(pdict);
+
 		}
 
 		else
@@ -3296,7 +3915,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_item_configuration"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3384,7 +4003,7 @@ namespace Marvel {
 			&itemraw, &sourceraw, &slot))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID source = GetIDFromPyObject(sourceraw);
@@ -3455,7 +4074,7 @@ namespace Marvel {
 			&itemraw, &fontraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID font = GetIDFromPyObject(fontraw);
@@ -3498,7 +4117,7 @@ namespace Marvel {
 			&itemraw, &themeraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID theme = GetIDFromPyObject(themeraw);
@@ -3541,7 +4160,7 @@ namespace Marvel {
 			&itemraw, &regraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvUUID reg = GetIDFromPyObject(regraw);
@@ -3583,7 +4202,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3605,7 +4224,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_item_state"], args, kwargs, __FUNCTION__, &itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3613,7 +4232,10 @@ namespace Marvel {
 		PyObject* pdict = PyDict_New();
 
 		if (appitem)
+		{
+			RequestAppItemState(appitem->_state);
 			FillAppItemState(pdict, appitem->_state, GetApplicableState(appitem->_type));
+		}
 		else
 			mvThrowPythonError(mvErrorCode::mvItemNotFound, "get_item_state",
 				"Item not found: " + std::to_string(item), nullptr);
@@ -3625,7 +4247,7 @@ namespace Marvel {
 	get_item_types(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		PyObject* pdict = PyDict_New();
 		#define X(el) PyDict_SetItemString(pdict, #el, PyLong_FromLong((int)mvAppItemType::el));
@@ -3639,7 +4261,30 @@ namespace Marvel {
 	configure_item(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			PyObject* itemraw = PyTuple_GetItem(args, 0);
+			Py_XINCREF(itemraw);
+			Py_XINCREF(kwargs);
+			mvSubmitCommand([itemraw, kwargs]()
+				{
+					mvUUID item = GetIDFromPyObject(itemraw);
+					mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
+					if (appitem)
+					{
+						appitem->handleKeywordArgs(kwargs, GetEntityCommand(appitem->_type));
+						InvalidateTableSort(appitem);
+					}
+					else
+						mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_item",
+							"Item not found: " + std::to_string(item), nullptr);
+					Py_XDECREF(kwargs);
+					Py_XDECREF(itemraw);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(PyTuple_GetItem(args, 0));
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3648,6 +4293,7 @@ namespace Marvel {
 		{
 			//appitem->checkArgs(args, kwargs);
 			appitem->handleKeywordArgs(kwargs, GetEntityCommand(appitem->_type));
+			InvalidateTableSort(appitem);
 		}
 		else
 			mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_item",
@@ -3656,6 +4302,107 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	mv_internal void
+	ConfigureItems(const std::vector<mvUUID>& items, PyObject* configs, PyObject* kwargs)
+	{
+
+		if (configs && configs != Py_None)
+		{
+			if (!PyList_Check(configs) && !PyTuple_Check(configs))
+			{
+				mvThrowPythonError(mvErrorCode::mvWrongType, "configure_items",
+					"configs must be a list or tuple of dicts", nullptr);
+				return;
+			}
+
+			b8 isList = PyList_Check(configs);
+			Py_ssize_t count = isList ? PyList_Size(configs) : PyTuple_Size(configs);
+			if (count != (Py_ssize_t)items.size())
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "configure_items",
+					"items and configs must have the same length", nullptr);
+				return;
+			}
+
+			// checked up front so a bad entry doesn't leave the list half applied
+			for (Py_ssize_t i = 0; i < count; i++)
+			{
+				PyObject* config = isList ? PyList_GetItem(configs, i) : PyTuple_GetItem(configs, i);
+				if (!PyDict_Check(config))
+				{
+					mvThrowPythonError(mvErrorCode::mvWrongType, "configure_items",
+						"configs[" + std::to_string(i) + "] must be a dict", nullptr);
+					return;
+				}
+			}
+
+			// keywords are shared by every item, configs[i] overrides them
+			b8 shared = kwargs && PyDict_Size(kwargs) > 0;
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				PyObject* config = isList ? PyList_GetItem(configs, i) : PyTuple_GetItem(configs, i);
+				mvAppItem* appitem = GetItem((*GContext->itemRegistry), items[i]);
+				if (appitem)
+				{
+					if (shared)
+					{
+						mvPyObject merged(PyDict_Copy(kwargs));
+						PyDict_Update(merged, config);
+						appitem->handleKeywordArgs(merged, GetEntityCommand(appitem->_type));
+					}
+					else
+						appitem->handleKeywordArgs(config, GetEntityCommand(appitem->_type));
+				}
+				else
+					mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_items",
+						"Item not found: " + std::to_string(items[i]), nullptr);
+			}
+			return;
+		}
+
+		for (auto item : items)
+		{
+			mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
+			if (appitem)
+				appitem->handleKeywordArgs(kwargs, GetEntityCommand(appitem->_type));
+			else
+				mvThrowPythonError(mvErrorCode::mvItemNotFound, "configure_items",
+					"Item not found: " + std::to_string(item), nullptr);
+		}
+	}
+
+	mv_internal mv_python_function
+	configure_items(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+
+		// configure_items(items, **kwargs) applies the same keywords to every item
+		// configure_items(items, configs) applies configs[i] to items[i], on top
+		// of any keywords
+		PyObject* itemsraw = PyTuple_GetItem(args, 0);
+		PyObject* configs = PyTuple_Size(args) > 1 ? PyTuple_GetItem(args, 1) : nullptr;
+
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			Py_XINCREF(itemsraw);
+			Py_XINCREF(configs);
+			Py_XINCREF(kwargs);
+			mvSubmitCommand([itemsraw, configs, kwargs]()
+				{
+					ConfigureItems(ToUUIDVect(itemsraw), configs, kwargs);
+					Py_XDECREF(kwargs);
+					Py_XDECREF(configs);
+					Py_XDECREF(itemsraw);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		ConfigureItems(ToUUIDVect(itemsraw), configs, kwargs);
+
+		return GetPyNone();
+	}
+
 	mv_internal mv_python_function
 	get_value(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -3664,7 +4411,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_value"], args, kwargs, __FUNCTION__, &nameraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID name = GetIDFromPyObject(nameraw);
 		mvAppItem* item = GetItem(*GContext->itemRegistry, name);
@@ -3682,7 +4429,7 @@ namespace Marvel {
 		if (!Parse((GetParsers())["get_values"], args, kwargs, __FUNCTION__, &items))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		auto aitems = ToUUIDVect(items);
 		PyObject* pyvalues = PyList_New(aitems.size());
@@ -3703,6 +4450,103 @@ namespace Marvel {
 		return pyvalues;
 	}
 
+	mv_internal b8
+	SetScalarValue(mvAppItem* item, f64 value)
+	{
+		// writes straight into the value storage for widgets whose
+		// setPyValue is a plain assignment (input widgets also track
+		// _last_value so they go through setPyValue)
+		switch (item->_type)
+		{
+		case mvAppItemType::mvIntValue:
+		case mvAppItemType::mvSliderInt:
+		case mvAppItemType::mvDragInt:
+			**static_cast<mvRef<i32>*>(item->getValue()) = (i32)value;
+			return true;
+
+		case mvAppItemType::mvFloatValue:
+		case mvAppItemType::mvProgressBar:
+		case mvAppItemType::mvKnobFloat:
+		case mvAppItemType::mvColorMapSlider:
+		case mvAppItemType::mvSliderFloat:
+		case mvAppItemType::mvDragFloat:
+			**static_cast<mvRef<f32>*>(item->getValue()) = (f32)value;
+			return true;
+
+		case mvAppItemType::mvDoubleValue:
+		case mvAppItemType::mvDragLine:
+			**static_cast<mvRef<f64>*>(item->getValue()) = value;
+			return true;
+
+		case mvAppItemType::mvBoolValue:
+		case mvAppItemType::mvCheckbox:
+		case mvAppItemType::mvSelectable:
+		case mvAppItemType::mvMenuItem:
+			**static_cast<mvRef<b8>*>(item->getValue()) = value != 0.0;
+			return true;
+
+		default:
+			return false;
+		}
+	}
+
+	mv_internal void
+	SetValues(const std::vector<mvUUID>& items, PyObject* values)
+	{
+
+		if (PyList_Check(values) || PyTuple_Check(values))
+		{
+			b8 isList = PyList_Check(values);
+			Py_ssize_t count = isList ? PyList_Size(values) : PyTuple_Size(values);
+			if (count != (Py_ssize_t)items.size())
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "set_values",
+					"items and values must have the same length", nullptr);
+				return;
+			}
+
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				PyObject* value = isList ? PyList_GetItem(values, i) : PyTuple_GetItem(values, i);
+				mvAppItem* item = GetItem(*GContext->itemRegistry, items[i]);
+				if (item)
+					item->setPyValue(value);
+				else
+					mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_values",
+						"Item not found: " + std::to_string(items[i]), nullptr);
+			}
+		}
+
+		else if (PyObject_CheckBuffer(values))
+		{
+			std::vector<f64> scalars = ToDoubleVect(values);
+			if (scalars.size() != items.size())
+			{
+				mvThrowPythonError(mvErrorCode::mvNone, "set_values",
+					"items and values must have the same length", nullptr);
+				return;
+			}
+
+			for (size_t i = 0; i < items.size(); i++)
+			{
+				mvAppItem* item = GetItem(*GContext->itemRegistry, items[i]);
+				if (item == nullptr)
+				{
+					mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_values",
+						"Item not found: " + std::to_string(items[i]), nullptr);
+					continue;
+				}
+
+				if (!SetScalarValue(item, scalars[i]))
+					item->setPyValue(mvPyObject(ToPyDouble(scalars[i])));
+			}
+		}
+
+		else
+			mvThrowPythonError(mvErrorCode::mvWrongType, "set_values",
+				"values must be a list, tuple or buffer", nullptr);
+	}
+
 	mv_internal mv_python_function
 	set_value(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -3715,13 +4559,37 @@ namespace Marvel {
 		if (value)
 			Py_XINCREF(value);
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			Py_XINCREF(nameraw);
+			mvSubmitCommand([nameraw, value]()
+				{
+					mvUUID name = GetIDFromPyObject(nameraw);
+					mvAppItem* item = GetItem(*GContext->itemRegistry, name);
+					if (item)
+					{
+						item->setPyValue(value);
+						InvalidateTableSort(item);
+					}
+					else
+						mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_value",
+							"Item not found: " + std::to_string(name), nullptr);
+					Py_XDECREF(value);
+					Py_XDECREF(nameraw);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID name = GetIDFromPyObject(nameraw);
 
 		mvAppItem* item = GetItem(*GContext->itemRegistry, name);
 		if (item)
+		{
 			item->setPyValue(value);
+			InvalidateTableSort(item);
+		}
 		else
 		{
 			mvThrowPythonError(mvErrorCode::mvItemNotFound, "set_value",
@@ -3733,6 +4601,35 @@ namespace Marvel {
 		return GetPyNone();
 	}
 
+	mv_internal mv_python_function
+	set_values(PyObject* self, PyObject* args, PyObject* kwargs)
+	{
+		PyObject* itemsraw;
+		PyObject* values;
+
+		if (!Parse((GetParsers())["set_values"], args, kwargs, __FUNCTION__, &itemsraw, &values))
+			return GetPyNone();
+
+		if (GContext->IO.deferredUpdates && GContext->started)
+		{
+			Py_XINCREF(itemsraw);
+			Py_XINCREF(values);
+			mvSubmitCommand([itemsraw, values]()
+				{
+					SetValues(ToUUIDVect(itemsraw), values);
+					Py_XDECREF(values);
+					Py_XDECREF(itemsraw);
+				});
+			return GetPyNone();
+		}
+
+		mvPySafeLockGuard lk(GContext->mutex);
+
+		SetValues(ToUUIDVect(itemsraw), values);
+
+		return GetPyNone();
+	}
+
 	mv_internal mv_python_function
 	set_item_alias(PyObject* self, PyObject* args, PyObject* kwargs)
 	{
@@ -3743,7 +4640,7 @@ namespace Marvel {
 			&itemraw, &alias))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3761,7 +4658,7 @@ namespace Marvel {
 			&itemraw))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		mvUUID item = GetIDFromPyObject(itemraw);
 		mvAppItem* appitem = GetItem((*GContext->itemRegistry), item);
@@ -3779,7 +4676,7 @@ namespace Marvel {
 			&callable))
 			return GetPyNone();
 
-		if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
+		mvPySafeLockGuard lk(GContext->mutex);
 
 		if (GContext->itemRegistry->captureCallback)
 			Py_XDECREF(GContext->itemRegistry->captureCallback);
@@ -238,6 +238,33 @@ namespace Marvel {
 			parsers.insert({ "is_table_cell_highlighted", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUID, "table" });
+			args.push_back({ mvPyDataType::ListAny, "columns", mvArgType::REQUIRED_ARG, "", "One buffer, list of numbers or list of strings per column. An empty list unbinds the data." });
+			args.push_back({ mvPyDataType::StringList, "formats", mvArgType::KEYWORD_ARG, "[]", "printf style format per numeric column (e.g. '%.3f'). Defaults to '%g', or '%.0f' for integers." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Binds columnar data to a table. Rows are drawn straight from the data (only the visible ones are formatted) instead of from table rows, so tables with millions of rows stay cheap to create and draw.";
+			setup.category = { "Tables", "App Item Operations" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "set_table_data", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUID, "table" });
+
+			mvPythonParserSetup setup;
+			setup.about = "Returns the cells of the data bound with set_table_data as they are drawn, one list of strings per column.";
+			setup.category = { "Tables", "App Item Operations" };
+			setup.returnType = mvPyDataType::ListStrList;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "get_table_data", parser });
+		}
+
 		//-----------------------------------------------------------------------------
 		// plots
 		//-----------------------------------------------------------------------------
@@ -331,6 +358,20 @@ namespace Marvel {
 			parsers.insert({ "reset_axis_ticks", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUID, "series" });
+			args.push_back({ mvPyDataType::Object, "x", mvArgType::REQUIRED_ARG, "", "Single value, list or buffer of x values." });
+			args.push_back({ mvPyDataType::Object, "y", mvArgType::REQUIRED_ARG, "", "Single value, list or buffer of y values." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Appends samples to a line, scatter or stair series. If the series has a capacity, the oldest samples are overwritten once it is full.";
+			setup.category = { "Plotting", "App Item Operations" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "append_series_data", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 			args.push_back({ mvPyDataType::UUID, "axis" });
@@ -468,6 +509,45 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		// context
 		//-----------------------------------------------------------------------------
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::Bool, "reset", mvArgType::KEYWORD_ARG, "False", "Starts counting again after returning." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Returns the callbacks run so far, the GIL acquisitions it took (batches), their latency from being queued to being called in seconds, the callbacks queued now (queue_depth) and those coalesced into a newer one or dropped by the queue limit.";
+			setup.category = { "General" };
+			setup.returnType = mvPyDataType::Dict;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "get_callback_statistics", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUID, "item" });
+			args.push_back({ mvPyDataType::String, "lane", mvArgType::KEYWORD_ARG, "''", "Callbacks of items sharing a lane run one at a time, in order. Empty runs them on the callback thread again." });
+			args.push_back({ mvPyDataType::Bool, "parallel", mvArgType::KEYWORD_ARG, "False", "Runs the item's callbacks on any worker, with no ordering. They must be thread safe." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Routes the callbacks of an item (widget or handler) to the callback workers set with configure_app(callback_workers=...). Other callbacks keep their order on the callback thread. Workers still take turns holding the GIL, so only callbacks releasing it (I/O, sleeping, native code) or free-threaded builds overlap.";
+			setup.category = { "General" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "set_callback_lane", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::Object, "loop" });
+
+			mvPythonParserSetup setup;
+			setup.about = "Sets the asyncio event loop coroutine callbacks (async def) are scheduled on as tasks. None stops accepting them.";
+			setup.category = { "General" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "set_callback_event_loop", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 
@@ -482,7 +562,7 @@ namespace Marvel {
 
 		{
 			std::vector<mvPythonDataElement> args;
-			args.reserve(11);
+			args.reserve(19);
 			args.push_back({ mvPyDataType::Bool, "docking", mvArgType::KEYWORD_ARG, "False", "Enables docking support." });
 			args.push_back({ mvPyDataType::Bool, "docking_space", mvArgType::KEYWORD_ARG, "False", "add explicit dockspace over viewport" });
 			args.push_back({ mvPyDataType::String, "load_init_file", mvArgType::KEYWORD_ARG, "''", "Load .ini file." });
@@ -496,6 +576,13 @@ namespace Marvel {
 			args.push_back({ mvPyDataType::Bool, "skip_positional_args", mvArgType::KEYWORD_ARG, "False" });
 			args.push_back({ mvPyDataType::Bool, "skip_keyword_args", mvArgType::KEYWORD_ARG, "False" });
 			args.push_back({ mvPyDataType::Bool, "wait_for_input", mvArgType::KEYWORD_ARG, "False", "New in 1.1. Only update when user input occurs" });
+			args.push_back({ mvPyDataType::Bool, "deferred_updates", mvArgType::KEYWORD_ARG, "False", "set_value, configure_item and delete_item are queued and applied by the render thread at the start of the next frame." });
+			args.push_back({ mvPyDataType::Integer, "decode_threads", mvArgType::KEYWORD_ARG, "2", "Image files (load_image_async, static textures with a file) decoded at the same time." });
+			args.push_back({ mvPyDataType::Integer, "callback_batch", mvArgType::KEYWORD_ARG, "64", "Queued callbacks run per acquisition of the GIL by the callback thread (1 releases it after every callback)." });
+			args.push_back({ mvPyDataType::Integer, "callback_queue_limit", mvArgType::KEYWORD_ARG, "0", "Queued callbacks past which new ones are dropped (0 never drops)." });
+			args.push_back({ mvPyDataType::Bool, "callback_coalescing", mvArgType::KEYWORD_ARG, "True", "Value changes while dragging or typing, mouse moves, held keys and buttons, hover, active and visible handlers keep only their newest queued callback." });
+			args.push_back({ mvPyDataType::Bool, "lazy_item_state", mvArgType::KEYWORD_ARG, "False", "Hovered, active, clicked and similar item state is only captured for items with a handler registry or queried with get_item_state (is_item_*) in the last 60 frames, so the first query of an item reports it as idle." });
+			args.push_back({ mvPyDataType::Integer, "callback_workers", mvArgType::KEYWORD_ARG, "0", "Threads running the callbacks of items given a lane with set_callback_lane (0 runs everything on the callback thread)." });
 
 			mvPythonParserSetup setup;
 			setup.about = "Configures app.";
@@ -521,7 +608,7 @@ namespace Marvel {
 
 		{
 			std::vector<mvPythonDataElement> args;
-			args.push_back({ mvPyDataType::Integer, "delay", mvArgType::KEYWORD_ARG, "32", "Minimal delay in in milliseconds" });
+			args.push_back({ mvPyDataType::Integer, "delay", mvArgType::KEYWORD_ARG, "32", "Unused, the render loop wakes the caller when the frame ends." });
 
 			mvPythonParserSetup setup;
 			setup.about = "Waits one frame.";
@@ -531,6 +618,31 @@ namespace Marvel {
 			parsers.insert({ "split_frame", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::Integer, "frame", mvArgType::KEYWORD_ARG, "-1", "Frame to wait for, -1 is the next one. Frames already rendered return right away." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Blocks, without holding the GIL, until a frame has rendered. Returns the last rendered frame, -1 once the context is destroyed.";
+			setup.category = { "General" };
+			setup.returnType = mvPyDataType::Integer;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "wait_for_frame", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+
+			mvPythonParserSetup setup;
+			setup.about = "Returns a file descriptor that becomes readable after every rendered frame (eventfd or pipe, drain it after waking up), for event loops to wait on. -1 where unsupported (Windows).";
+			setup.category = { "General" };
+			setup.returnType = mvPyDataType::Integer;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "get_frame_wakeup_fd", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 
@@ -545,10 +657,11 @@ namespace Marvel {
 
 		{
 			std::vector<mvPythonDataElement> args;
-			args.reserve(3);
+			args.reserve(4);
 			args.push_back({ mvPyDataType::String, "file" });
 			args.push_back({ mvPyDataType::Float, "gamma", mvArgType::KEYWORD_ARG, "1.0", "Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading." });
 			args.push_back({ mvPyDataType::Float, "gamma_scale_factor", mvArgType::KEYWORD_ARG, "1.0", "Gamma scale factor." });
+			args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray." });
 
 			mvPythonParserSetup setup;
 			setup.about = "Loads an image. Returns width, height, channels, mvBuffer";
@@ -559,6 +672,71 @@ namespace Marvel {
 			parsers.insert({ "load_image", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.reserve(6);
+			args.push_back({ mvPyDataType::String, "file" });
+			args.push_back({ mvPyDataType::Callable, "callback", mvArgType::REQUIRED_ARG, "", "Called with (sender, (width, height, channels, data), user_data) once decoded, app_data is None if the file couldn't be loaded." });
+			args.push_back({ mvPyDataType::Float, "gamma", mvArgType::KEYWORD_ARG, "1.0", "Gamma correction factor. (default is 1.0 to avoid automatic gamma correction on loading." });
+			args.push_back({ mvPyDataType::Float, "gamma_scale_factor", mvArgType::KEYWORD_ARG, "1.0", "Gamma scale factor." });
+			args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "mvFormat_Float_rgba returns floats in an mvBuffer, the byte formats return the 8 bit pixels in a bytearray." });
+			args.push_back({ mvPyDataType::Object, "user_data", mvArgType::KEYWORD_ARG, "None", "User data for the callback." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Loads an image on a worker thread (see configure_app decode_threads) and passes it to the callback. Returns the id used as the callback's sender.";
+			setup.category = { "Textures", "Utilities" };
+			setup.returnType = mvPyDataType::UUID;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "load_image_async", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.reserve(6);
+			args.push_back({ mvPyDataType::UUID, "texture" });
+			args.push_back({ mvPyDataType::Integer, "x" });
+			args.push_back({ mvPyDataType::Integer, "y" });
+			args.push_back({ mvPyDataType::Integer, "width" });
+			args.push_back({ mvPyDataType::Integer, "height" });
+			args.push_back({ mvPyDataType::Object, "data", mvArgType::KEYWORD_ARG, "None", "width*height pixels in the texture's format. Raw textures can leave it out to upload what was written to their buffer." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Updates a rectangle of a dynamic or raw texture. Only the rectangle is uploaded on the next frame.";
+			setup.category = { "Textures", "App Item Operations" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "set_texture_region", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.reserve(2);
+			args.push_back({ mvPyDataType::UUID, "texture" });
+			args.push_back({ mvPyDataType::Object, "data", mvArgType::REQUIRED_ARG, "", "Whole rows in the texture's format." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Writes rows at a cursor that wraps around the texture (spectrograms, waterfalls). Images of the texture scroll so the newest row is at the bottom.";
+			setup.category = { "Textures", "App Item Operations" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "push_texture_rows", parser });
+		}
+
+		{
+			std::vector<mvPythonDataElement> args;
+			args.reserve(1);
+			args.push_back({ mvPyDataType::UUID, "texture" });
+
+			mvPythonParserSetup setup;
+			setup.about = "Reads back what the gpu holds for a dynamic or raw texture (in the texture's format) or for the image of a heat series drawn with use_texture (float rgba). Call it from the thread rendering frames.";
+			setup.category = { "Textures", "App Item Operations" };
+			setup.returnType = mvPyDataType::Any;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "get_texture_pixels", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 
@@ -1365,6 +1543,21 @@ namespace Marvel {
 			parsers.insert({ "configure_item", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUIDList, "items" });
+			args.push_back({ mvPyDataType::Object, "configs", mvArgType::POSITIONAL_ARG, "None", "List of dicts, configs[i] is applied to items[i] over the shared keywords." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Configures a list of items in one call, either with the same keywords or a config dict per item.";
+			setup.category = { "App Item Operations" };
+			setup.unspecifiedKwargs = true;
+			setup.internal = true;
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "configure_items", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 			args.push_back({ mvPyDataType::UUID, "item" });
@@ -1404,6 +1597,19 @@ namespace Marvel {
 			parsers.insert({ "set_value", parser });
 		}
 
+		{
+			std::vector<mvPythonDataElement> args;
+			args.push_back({ mvPyDataType::UUIDList, "items" });
+			args.push_back({ mvPyDataType::Object, "values", mvArgType::REQUIRED_ARG, "...", "List of values or a buffer of numbers (same length as items)." });
+
+			mvPythonParserSetup setup;
+			setup.about = "Set's the values of a list of items.";
+			setup.category = { "App Item Operations" };
+
+			mvPythonParser parser = FinalizeParser(setup, args);
+			parsers.insert({ "set_values", parser });
+		}
+
 		{
 			std::vector<mvPythonDataElement> args;
 			args.push_back({ mvPyDataType::UUID, "item" });
@@ -17,34 +17,65 @@ extern id <MTLDevice> gdevice;
 
 namespace Marvel {
     
-    mv_impl void*
-    LoadTextureFromArray(unsigned width, unsigned height, float* data)
+    mv_internal MTLPixelFormat
+    GetMetalTextureFormat(int format)
     {
+        switch (format)
+        {
+        case mvTextureFormat_Byte_rgba: return MTLPixelFormatRGBA8Unorm;
+        case mvTextureFormat_Byte_r:    return MTLPixelFormatR8Unorm;
+        case mvTextureFormat_Byte_rg:   return MTLPixelFormatRG8Unorm;
+        case mvTextureFormat_Half_rgba: return MTLPixelFormatRGBA16Float;
+        default:                        return MTLPixelFormatRGBA32Float;
+        }
+    }
 
-        MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA32Float width:width height:height mipmapped:NO];
-
-        textureDescriptor.usage = MTLTextureUsageShaderRead;
-        textureDescriptor.storageMode = MTLStorageModeManaged;
-
-        id <MTLTexture> texture = [gdevice newTextureWithDescriptor:textureDescriptor];
-        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4 * 4];
+    // metal has no three channel float format, rgb is padded to rgba
+    mv_internal void
+    ReplaceTextureRegion(id <MTLTexture> texture, unsigned width, const void* data, int format, unsigned x, unsigned y, unsigned regionWidth, unsigned regionHeight)
+    {
+        const char* first = (const char*)data + GetTextureFormatBytes(width, y, format) + GetTextureFormatBytes(x, 1, format);
 
-        g_textures.push_back({texture, texture});
+        if (format == mvTextureFormat_Float_rgb)
+        {
+            std::vector<float> rgba((size_t)regionWidth * regionHeight * 4, 1.0f);
+            for (size_t row = 0; row < regionHeight; row++)
+            {
+                const float* rgb = (const float*)(first + GetTextureFormatBytes(width, (unsigned)row, format));
+                for (size_t i = 0; i < regionWidth; i++)
+                {
+                    rgba[(row * regionWidth + i) * 4 + 0] = rgb[i * 3 + 0];
+                    rgba[(row * regionWidth + i) * 4 + 1] = rgb[i * 3 + 1];
+                    rgba[(row * regionWidth + i) * 4 + 2] = rgb[i * 3 + 2];
+                }
+            }
+            [texture replaceRegion:MTLRegionMake2D(x, y, regionWidth, regionHeight) mipmapLevel:0 withBytes:rgba.data() bytesPerRow:regionWidth * 4 * 4];
+            return;
+        }
 
-        return (__bridge void*)g_textures.back().second;
+        [texture replaceRegion:MTLRegionMake2D(x, y, regionWidth, regionHeight) mipmapLevel:0 withBytes:first bytesPerRow:GetTextureFormatBytes(width, 1, format)];
     }
 
-    mv_impl void*
-    LoadTextureFromArrayDynamic(unsigned width, unsigned height, float* data)
+    mv_internal void*
+    CreateArrayTexture(unsigned width, unsigned height, const void* data, int format)
     {
 
-        MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA32Float width:width height:height mipmapped:NO];
+        MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:GetMetalTextureFormat(format) width:width height:height mipmapped:NO];
 
         textureDescriptor.usage = MTLTextureUsageShaderRead;
         textureDescriptor.storageMode = MTLStorageModeManaged;
 
+        // one and two channel textures display as gray and gray + alpha
+        if (@available(macOS 10.15, *))
+        {
+            if (format == mvTextureFormat_Byte_r)
+                textureDescriptor.swizzle = MTLTextureSwizzleChannelsMake(MTLTextureSwizzleRed, MTLTextureSwizzleRed, MTLTextureSwizzleRed, MTLTextureSwizzleOne);
+            else if (format == mvTextureFormat_Byte_rg)
+                textureDescriptor.swizzle = MTLTextureSwizzleChannelsMake(MTLTextureSwizzleRed, MTLTextureSwizzleRed, MTLTextureSwizzleRed, MTLTextureSwizzleGreen);
+        }
+
         id <MTLTexture> texture = [gdevice newTextureWithDescriptor:textureDescriptor];
-        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4 * 4];
+        ReplaceTextureRegion(texture, width, data, format, 0, 0, width, height);
 
         g_textures.push_back({texture, texture});
 
@@ -52,19 +83,22 @@ namespace Marvel {
     }
 
     mv_impl void*
-    LoadTextureFromArrayRaw(unsigned width, unsigned height, float* data, int components)
+    LoadTextureFromArray(unsigned width, unsigned height, const void* data, int format)
     {
-        MTLTextureDescriptor *textureDescriptor = [MTLTextureDescriptor texture2DDescriptorWithPixelFormat:MTLPixelFormatRGBA32Float width:width height:height mipmapped:NO];
-
-        textureDescriptor.usage = MTLTextureUsageShaderRead;
-        textureDescriptor.storageMode = MTLStorageModeManaged;
-
-        id <MTLTexture> texture = [gdevice newTextureWithDescriptor:textureDescriptor];
-        [texture replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * 4 * 4];
+        return CreateArrayTexture(width, height, data, format);
+    }
 
-        g_textures.push_back({texture, texture});
+    mv_impl void*
+    LoadTextureFromArrayDynamic(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
+    {
+        // replaceRegion copies on the cpu, no pixel buffers to keep
+        return CreateArrayTexture(width, height, data, format);
+    }
 
-        return (__bridge void*)g_textures.back().second;
+    mv_impl void*
+    LoadTextureFromArrayRaw(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
+    {
+        return CreateArrayTexture(width, height, data, format);
     }
 
     mv_impl void*
@@ -113,16 +147,49 @@ namespace Marvel {
     }
 
     mv_impl void
-    UpdateTexture(void* texture, unsigned width, unsigned height, std::vector<float>& data)
+    UpdateTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
     {
         id <MTLTexture> out_srv = (__bridge id <MTLTexture>)texture;
-        [out_srv replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data.data() bytesPerRow:width * 4 * 4];
+        ReplaceTextureRegion(out_srv, width, data, format, 0, 0, width, height);
     }
 
-        void UpdateRawTexture(void* texture, unsigned width, unsigned height, float* data, int components)
+    mv_impl void
+    UpdateRawTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
+    {
+        UpdateTexture(texture, width, height, data, format);
+    }
+
+    mv_impl void
+    UpdateTextureRegion(void* texture, unsigned width, unsigned height, const void* data, int format, unsigned x, unsigned y, unsigned regionWidth, unsigned regionHeight)
+    {
+        id <MTLTexture> out_srv = (__bridge id <MTLTexture>)texture;
+        ReplaceTextureRegion(out_srv, width, data, format, x, y, regionWidth, regionHeight);
+    }
+
+    mv_impl b8
+    ReadTexturePixels(void* texture, unsigned width, unsigned height, int format, void* data)
     {
         id <MTLTexture> out_srv = (__bridge id <MTLTexture>)texture;
-        [out_srv replaceRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0 withBytes:data bytesPerRow:width * components * 4];
+
+        // managed textures only written by the cpu (replaceRegion), so no
+        // blit synchronization is needed
+        if (format != mvTextureFormat_Float_rgb)
+        {
+            [out_srv getBytes:data bytesPerRow:GetTextureFormatBytes(width, 1, format) fromRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0];
+            return true;
+        }
+
+        // rgb was padded to rgba
+        std::vector<float> rgba((size_t)width * height * 4);
+        [out_srv getBytes:rgba.data() bytesPerRow:width * 4 * 4 fromRegion:MTLRegionMake2D(0, 0, width, height) mipmapLevel:0];
+        float* rgb = (float*)data;
+        for (size_t i = 0; i < (size_t)width * height; i++)
+        {
+            rgb[i * 3 + 0] = rgba[i * 4 + 0];
+            rgb[i * 3 + 1] = rgba[i * 4 + 1];
+            rgb[i * 3 + 2] = rgba[i * 4 + 2];
+        }
+        return true;
     }
 
 }
@@ -2,35 +2,65 @@
 #define STB_IMAGE_IMPLEMENTATION
 #include <stb_image.h>
 #include <string>
+#include <cstring>
 #include <vector>
+#include <algorithm>
 #include <unordered_map>
 #include <GL/gl3w.h>
 #include <GLFW/glfw3.h>
 #include "mvContext.h"
 
-static std::unordered_map<GLuint, GLuint> PBO_ids;
-
 namespace Marvel {
 
-    mv_internal void
-    UpdatePixels(GLubyte* dst, const float* data, int size)
+    // streaming textures cycle through several pixel buffers, a fence marks
+    // when the upload reading a buffer has finished so it can be refilled
+    // without stalling on the gpu
+    struct mvPixelBufferRing
     {
+        GLuint buffers[MaxPixelBuffers] = {};
+        GLsync fences[MaxPixelBuffers] = {};
+        u32    count = 1u;
+        u32    next = 0u;
+    };
 
-        if(!dst)
-            return;
+    mv_global std::unordered_map<GLuint, mvPixelBufferRing> PBO_rings;
 
-        auto ptr = (float*)dst;
+    struct mvGLTextureFormat
+    {
+        GLint  internalFormat;
+        GLenum format;
+        GLenum type;
+    };
 
-        for(int i = 0; i < size; ++i)
+    mv_internal mvGLTextureFormat
+    GetGLTextureFormat(int format)
+    {
+        switch(format)
         {
-            ptr[i] = data[i];
+        case mvTextureFormat_Float_rgb: return { GL_RGB, GL_RGB, GL_FLOAT };
+        case mvTextureFormat_Byte_rgba: return { GL_RGBA8, GL_RGBA, GL_UNSIGNED_BYTE };
+        case mvTextureFormat_Byte_r:    return { GL_R8, GL_RED, GL_UNSIGNED_BYTE };
+        case mvTextureFormat_Byte_rg:   return { GL_RG8, GL_RG, GL_UNSIGNED_BYTE };
+        case mvTextureFormat_Half_rgba: return { GL_RGBA16F, GL_RGBA, GL_HALF_FLOAT };
+        default:                        return { GL_RGBA, GL_RGBA, GL_FLOAT };
         }
     }
 
-    mv_impl void*
-    LoadTextureFromArray(unsigned width, unsigned height, float* data)
+    mv_internal void
+    UpdatePixels(GLubyte* dst, const void* data, size_t size)
     {
 
+        if(!dst)
+            return;
+
+        memcpy(dst, data, size);
+    }
+
+    mv_internal GLuint
+    CreateArrayTexture(unsigned width, unsigned height, const void* data, int format)
+    {
+        mvGLTextureFormat glformat = GetGLTextureFormat(format);
+
         // Create a OpenGL texture identifier
         GLuint image_texture;
         glGenTextures(1, &image_texture);
@@ -40,67 +70,179 @@ namespace Marvel {
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
         glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
 
-        // Upload pixels into texture
+        // one and two channel textures display as gray and gray + alpha
+        if(format == mvTextureFormat_Byte_r)
+        {
+            GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_ONE };
+            glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+        else if(format == mvTextureFormat_Byte_rg)
+        {
+            GLint swizzle[] = { GL_RED, GL_RED, GL_RED, GL_GREEN };
+            glTexParameteriv(GL_TEXTURE_2D, GL_TEXTURE_SWIZZLE_RGBA, swizzle);
+        }
+
+        // Upload pixels into texture (byte rows aren't 4 byte aligned)
         glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_FLOAT, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexImage2D(GL_TEXTURE_2D, 0, glformat.internalFormat, width, height, 0, glformat.format, glformat.type, data);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
 
-        return reinterpret_cast<void *>(image_texture);
+        return image_texture;
     }
 
-    mv_impl void*
-    LoadTextureFromArrayDynamic(unsigned width, unsigned height, float* data)
+    mv_internal void
+    CreatePixelBuffer(GLuint texture, unsigned width, unsigned height, int format, unsigned pixelBuffers)
     {
+        mvPixelBufferRing ring;
 
-        // Create a OpenGL texture identifier
-        GLuint image_texture;
-        glGenTextures(1, &image_texture);
-        glBindTexture(GL_TEXTURE_2D, image_texture);
+        // fences need GL 3.2 or ARB_sync, otherwise a single orphaned buffer
+        ring.count = glFenceSync ? std::min(std::max(pixelBuffers, 1u), MaxPixelBuffers) : 1u;
 
-        // Setup filtering parameters for display
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        glGenBuffers(ring.count, ring.buffers);
+        for(u32 i = 0; i < ring.count; i++)
+        {
+            glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.buffers[i]);
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, GetTextureFormatBytes(width, height, format), 0, GL_STREAM_DRAW);
+        }
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        PBO_rings[texture] = ring;
+    }
 
-        // Upload pixels into texture
-        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_FLOAT, data);
+    mv_internal void
+    FreePixelBuffer(GLuint texture)
+    {
+        auto found = PBO_rings.find(texture);
+        if(found == PBO_rings.end())
+            return;
 
-        GLuint pboid;
-        glGenBuffers(1, &pboid);
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pboid);
-        glBufferData(GL_PIXEL_UNPACK_BUFFER, width*height*4*sizeof(float), 0, GL_STREAM_DRAW);
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
-        PBO_ids[image_texture] = pboid;
+        mvPixelBufferRing& ring = found->second;
+        for(u32 i = 0; i < ring.count; i++)
+        {
+            if(ring.fences[i])
+                glDeleteSync(ring.fences[i]);
+        }
+        glDeleteBuffers(ring.count, ring.buffers);
+        PBO_rings.erase(found);
+    }
 
-        return reinterpret_cast<void *>(image_texture);
+    mv_internal GLubyte*
+    MapPixelBuffer(mvPixelBufferRing& ring, size_t size)
+    {
+
+        // bind PBO to update pixel values
+        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, ring.buffers[ring.next]);
+
+        if(ring.count == 1u)
+        {
+            // map the buffer object into client's memory
+            // Note that glMapBuffer() causes sync issue.
+            // If GPU is working with this buffer, glMapBuffer() will wait(stall)
+            // for GPU to finish its job. To avoid waiting (stall), you can call
+            // first glBufferData() with NULL pointer before glMapBuffer().
+            // If you do that, the previous data in PBO will be discarded and
+            // glMapBuffer() returns a new allocated pointer immediately
+            // even if GPU is still working with the previous data.
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+            return (GLubyte*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
+        }
+
+        // the upload that last read this buffer was queued count - 1 updates
+        // ago, so it is normally done and this doesn't wait
+        b8 signaled = true;
+        if(GLsync fence = ring.fences[ring.next])
+        {
+            GLenum result = glClientWaitSync(fence, GL_SYNC_FLUSH_COMMANDS_BIT, PixelBufferTimeout);
+            signaled = result == GL_ALREADY_SIGNALED || result == GL_CONDITION_SATISFIED;
+            glDeleteSync(fence);
+            ring.fences[ring.next] = nullptr;
+        }
+
+        // the gpu may still read it: orphan the storage, the driver hands
+        // out fresh memory instead of the buffer being written under it
+        if(!signaled)
+        {
+            glBufferData(GL_PIXEL_UNPACK_BUFFER, size, 0, GL_STREAM_DRAW);
+            return (GLubyte*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+                GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT);
+        }
+
+        // fenced, so the driver doesn't need to synchronize or rename
+        return (GLubyte*)glMapBufferRange(GL_PIXEL_UNPACK_BUFFER, 0, size,
+            GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_BUFFER_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
     }
 
-    mv_impl void*
-    LoadTextureFromArrayRaw(unsigned width, unsigned height, float* data, int components)
+    mv_internal void
+    UpdatePixelBuffer(void* texture, unsigned width, unsigned height, const void* data, int format)
     {
+        auto textureId = (GLuint)(size_t)texture;
+        mvGLTextureFormat glformat = GetGLTextureFormat(format);
+        size_t size = GetTextureFormatBytes(width, height, format);
 
-        // Create a OpenGL texture identifier
-        GLuint image_texture;
-        glGenTextures(1, &image_texture);
-        glBindTexture(GL_TEXTURE_2D, image_texture);
+        auto found = PBO_rings.find(textureId);
+        if(found == PBO_rings.end())
+            return;
+        mvPixelBufferRing& ring = found->second;
 
-        // Setup filtering parameters for display
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MIN_FILTER, GL_LINEAR);
-        glTexParameteri(GL_TEXTURE_2D, GL_TEXTURE_MAG_FILTER, GL_LINEAR);
+        // start to modify pixel values ///////////////////
 
-        // Upload pixels into texture
-        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
-        if(components == 4)
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGBA, width, height, 0, GL_RGBA, GL_FLOAT, data);
-        else
-            glTexImage2D(GL_TEXTURE_2D, 0, GL_RGB, width, height, 0, GL_RGB, GL_FLOAT, data);
-
-        GLuint pboid;
-        glGenBuffers(1, &pboid);
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, pboid);
-        glBufferData(GL_PIXEL_UNPACK_BUFFER, width * height * components * sizeof(float), 0, GL_STREAM_DRAW);
+        GLubyte* ptr = MapPixelBuffer(ring, size);
+        if(ptr)
+        {
+            // update data directly on the mapped buffer
+            UpdatePixels(ptr, data, size);
+
+            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);  // release pointer to mapping buffer
+        }
+
+        ///////////////////////////////////////////////////
+
+        // start to copy from PBO to texture object ///////
+
+        // the data written above, textures only upload on changes so the
+        // copy can't lag a frame behind
+        glBindTexture(GL_TEXTURE_2D, textureId);
+
+        // copy pixels from PBO to texture object
+        // Use offset instead of ponter.
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, glformat.format, glformat.type, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+
+        // the buffer can be refilled once the copy has finished
+        if(ring.count > 1u)
+        {
+            ring.fences[ring.next] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+            ring.next = (ring.next + 1u) % ring.count;
+        }
+
+        ///////////////////////////////////////////////////
+
+        // it is good idea to release PBOs with ID 0 after use.
+        // Once bound with 0, all pixel operations behave normal ways.
         glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
-        PBO_ids[image_texture] = pboid;
+    }
+
+    mv_impl void*
+    LoadTextureFromArray(unsigned width, unsigned height, const void* data, int format)
+    {
+        GLuint image_texture = CreateArrayTexture(width, height, data, format);
+        return reinterpret_cast<void *>(image_texture);
+    }
 
+    mv_impl void*
+    LoadTextureFromArrayDynamic(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
+    {
+        GLuint image_texture = CreateArrayTexture(width, height, data, format);
+        CreatePixelBuffer(image_texture, width, height, format, pixelBuffers);
+        return reinterpret_cast<void *>(image_texture);
+    }
+
+    mv_impl void*
+    LoadTextureFromArrayRaw(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
+    {
+        GLuint image_texture = CreateArrayTexture(width, height, data, format);
+        CreatePixelBuffer(image_texture, width, height, format, pixelBuffers);
         return reinterpret_cast<void*>(image_texture);
     }
 
@@ -147,107 +289,52 @@ namespace Marvel {
     {
         auto out_srv = (GLuint)(size_t)texture;
 
-        if(PBO_ids.count(out_srv) != 0)
-            PBO_ids.erase(out_srv);
+        FreePixelBuffer(out_srv);
 
         glDeleteTextures(1, &out_srv);
     }
 
     mv_impl void
-    UpdateTexture(void* texture, unsigned width, unsigned height, std::vector<float>& data)
+    UpdateTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
     {
-        auto textureId = (GLuint)(size_t)texture;
-
-        // start to copy from PBO to texture object ///////
-
-        // bind the texture and PBO
-        glBindTexture(GL_TEXTURE_2D, textureId);
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, PBO_ids[textureId]);
-
-        // copy pixels from PBO to texture object
-        // Use offset instead of ponter.
-        glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_FLOAT, 0);
-
-        ///////////////////////////////////////////////////
-
-        // start to modify pixel values ///////////////////
-
-        // bind PBO to update pixel values
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, PBO_ids[textureId]);
-
-        // map the buffer object into client's memory
-        // Note that glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall)
-        // for GPU to finish its job. To avoid waiting (stall), you can call
-        // first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and
-        // glMapBuffer() returns a new allocated pointer immediately
-        // even if GPU is still working with the previous data.
-        glBufferData(GL_PIXEL_UNPACK_BUFFER, width*height*4*sizeof(float), 0, GL_STREAM_DRAW);
-        GLubyte* ptr = (GLubyte*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
-        if(ptr)
-        {
-            // update data directly on the mapped buffer
-            UpdatePixels(ptr, data.data(), data.size());
-
-            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);  // release pointer to mapping buffer
-        }
-
-        ///////////////////////////////////////////////////
+        UpdatePixelBuffer(texture, width, height, data, format);
+    }
 
-        // it is good idea to release PBOs with ID 0 after use.
-        // Once bound with 0, all pixel operations behave normal ways.
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+    mv_impl void
+    UpdateRawTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
+    {
+        UpdatePixelBuffer(texture, width, height, data, format);
     }
 
     mv_impl void
-    UpdateRawTexture(void* texture, unsigned width, unsigned height, float* data, int components)
+    UpdateTextureRegion(void* texture, unsigned width, unsigned height, const void* data, int format, unsigned x, unsigned y, unsigned regionWidth, unsigned regionHeight)
     {
         auto textureId = (GLuint)(size_t)texture;
+        mvGLTextureFormat glformat = GetGLTextureFormat(format);
+        const GLubyte* first = (const GLubyte*)data + GetTextureFormatBytes(width, y, format) + GetTextureFormatBytes(x, 1, format);
 
-        // start to copy from PBO to texture object ///////
-
-        // bind the texture and PBO
+        // straight from the surface, the row length skips the rest of each row
         glBindTexture(GL_TEXTURE_2D, textureId);
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, PBO_ids[textureId]);
-
-        // copy pixels from PBO to texture object
-        // Use offset instead of ponter.
-        if(components == 4)
-            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGBA, GL_FLOAT, 0);
-        else
-            glTexSubImage2D(GL_TEXTURE_2D, 0, 0, 0, width, height, GL_RGB, GL_FLOAT, 0);
-
-        ///////////////////////////////////////////////////
-
-        // start to modify pixel values ///////////////////
-
-        // bind PBO to update pixel values
-        glBindBuffer(GL_PIXEL_UNPACK_BUFFER, PBO_ids[textureId]);
-
-        // map the buffer object into client's memory
-        // Note that glMapBuffer() causes sync issue.
-        // If GPU is working with this buffer, glMapBuffer() will wait(stall)
-        // for GPU to finish its job. To avoid waiting (stall), you can call
-        // first glBufferData() with NULL pointer before glMapBuffer().
-        // If you do that, the previous data in PBO will be discarded and
-        // glMapBuffer() returns a new allocated pointer immediately
-        // even if GPU is still working with the previous data.
-        glBufferData(GL_PIXEL_UNPACK_BUFFER, width * height * components * sizeof(float), 0, GL_STREAM_DRAW);
-        GLubyte* ptr = (GLubyte*)glMapBuffer(GL_PIXEL_UNPACK_BUFFER, GL_WRITE_ONLY);
-        if (ptr)
-        {
-            // update data directly on the mapped buffer
-            UpdatePixels(ptr, data, width*height*components);
-
-            glUnmapBuffer(GL_PIXEL_UNPACK_BUFFER);  // release pointer to mapping buffer
-        }
-
-        ///////////////////////////////////////////////////
-
-        // it is good idea to release PBOs with ID 0 after use.
-        // Once bound with 0, all pixel operations behave normal ways.
         glBindBuffer(GL_PIXEL_UNPACK_BUFFER, 0);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, width);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 1);
+        glTexSubImage2D(GL_TEXTURE_2D, 0, x, y, regionWidth, regionHeight, glformat.format, glformat.type, first);
+        glPixelStorei(GL_UNPACK_ROW_LENGTH, 0);
+        glPixelStorei(GL_UNPACK_ALIGNMENT, 4);
+    }
+
+    mv_impl b8
+    ReadTexturePixels(void* texture, unsigned width, unsigned height, int format, void* data)
+    {
+        mvGLTextureFormat glformat = GetGLTextureFormat(format);
+
+        // waits for the uploads queued before it
+        while(glGetError() != GL_NO_ERROR) {}
+        glBindTexture(GL_TEXTURE_2D, (GLuint)(size_t)texture);
+        glPixelStorei(GL_PACK_ALIGNMENT, 1);
+        glGetTexImage(GL_TEXTURE_2D, 0, glformat.format, glformat.type, data);
+        glPixelStorei(GL_PACK_ALIGNMENT, 4);
+        return glGetError() == GL_NO_ERROR;
     }
 
 }
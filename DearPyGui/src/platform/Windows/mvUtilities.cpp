@@ -8,6 +8,7 @@
 #include <windows.h>
 #include <atlbase.h> // Contains the declaration of CComPtr.
 #include <array>
+#include <vector>
 #include <codecvt>
 #include <sstream>
 #include <filesystem>
@@ -20,95 +21,177 @@ extern ID3D11DeviceContext* gdeviceContext;
 
 namespace Marvel {
 
-    mv_impl void*
-    LoadTextureFromFile(const char* filename, int& width, int& height)
+    mv_internal DXGI_FORMAT
+    GetDXGITextureFormat(int format)
     {
+        switch (format)
+        {
+        case mvTextureFormat_Float_rgb: return DXGI_FORMAT_R32G32B32_FLOAT;
+        case mvTextureFormat_Byte_rgba: return DXGI_FORMAT_R8G8B8A8_UNORM;
+        // no view swizzles in d3d11, one and two channel data is expanded
+        // to gray and gray + alpha while uploading
+        case mvTextureFormat_Byte_r:
+        case mvTextureFormat_Byte_rg:   return DXGI_FORMAT_R8G8B8A8_UNORM;
+        case mvTextureFormat_Half_rgba: return DXGI_FORMAT_R16G16B16A16_FLOAT;
+        default:                        return DXGI_FORMAT_R32G32B32A32_FLOAT;
+        }
+    }
 
-        //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
-        ID3D11ShaderResourceView* out_srv = nullptr;
+    mv_internal void
+    ExpandGrayRow(BYTE* dst, const BYTE* src, unsigned width, int components)
+    {
+        for (unsigned i = 0; i < width; ++i)
+        {
+            dst[0] = dst[1] = dst[2] = src[0];
+            dst[3] = components == 2 ? src[1] : 255;
+            dst += 4;
+            src += components;
+        }
+    }
 
-        // Load from disk into a raw RGBA buffer
-        int image_width = 0;
-        int image_height = 0;
-        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, NULL, 4);
-        if (image_data == NULL)
-            return nullptr;
+    // copies rows into a mapped or staging surface of the view format
+    mv_internal void
+    CopyTextureRows(BYTE* dst, UINT dstPitch, const void* data, unsigned width, unsigned height, int format)
+    {
+        const BYTE* src = reinterpret_cast<const BYTE*>(data);
+        size_t srcPitch = (size_t)width * GetTextureFormatComponents(format) * GetTextureFormatComponentSize(format);
+        for (UINT i = 0; i < height; ++i)
+        {
+            if (format == mvTextureFormat_Byte_r || format == mvTextureFormat_Byte_rg)
+                ExpandGrayRow(dst, src, width, GetTextureFormatComponents(format));
+            else
+                memcpy(dst, src, srcPitch);
+            dst += dstPitch;
+            src += srcPitch;
+        }
+    }
+
+    mv_internal ID3D11ShaderResourceView*
+    CreateArrayTexture(unsigned width, unsigned height, const void* data, int format, bool dynamic)
+    {
+        ID3D11ShaderResourceView* out_srv = nullptr;
 
         // Create texture
         D3D11_TEXTURE2D_DESC desc;
         ZeroMemory(&desc, sizeof(desc));
-        desc.Width = image_width;
-        desc.Height = image_height;
+        desc.Width = width;
+        desc.Height = height;
         desc.MipLevels = 1;
         desc.ArraySize = 1;
-        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
         desc.SampleDesc.Count = 1;
-        desc.Usage = D3D11_USAGE_DEFAULT;
+        desc.Usage = dynamic ? D3D11_USAGE_DYNAMIC : D3D11_USAGE_DEFAULT;
         desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-        desc.CPUAccessFlags = 0;
+        desc.CPUAccessFlags = dynamic ? D3D11_CPU_ACCESS_WRITE : 0;
+        desc.Format = GetDXGITextureFormat(format);
+
+        // gray data needs expanding first
+        std::vector<BYTE> expanded;
+        UINT pitch = width * GetTextureFormatComponents(format) * GetTextureFormatComponentSize(format);
+        if (format == mvTextureFormat_Byte_r || format == mvTextureFormat_Byte_rg)
+        {
+            expanded.resize((size_t)width * height * 4);
+            CopyTextureRows(expanded.data(), width * 4, data, width, height, format);
+            data = expanded.data();
+            pitch = width * 4;
+        }
 
         ID3D11Texture2D* pTexture = NULL;
         D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = image_data;
-        subResource.SysMemPitch = desc.Width * 4;
+        subResource.pSysMem = data;
+        subResource.SysMemPitch = pitch;
         subResource.SysMemSlicePitch = 0;
         gdevice->CreateTexture2D(&desc, &subResource, &pTexture);
 
         // Create texture view
         D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
         ZeroMemory(&srvDesc, sizeof(srvDesc));
-        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
+        srvDesc.Format = desc.Format;
         srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MipLevels = desc.MipLevels;
         srvDesc.Texture2D.MostDetailedMip = 0;
         gdevice->CreateShaderResourceView(pTexture, &srvDesc, &out_srv);
         pTexture->Release();
 
-        width = image_width;
-        height = image_height;
-        stbi_image_free(image_data);
-
         return out_srv;
     }
 
+    mv_internal void
+    MapTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
+    {
+        ID3D11ShaderResourceView* view = (ID3D11ShaderResourceView*)texture;
+        D3D11_MAPPED_SUBRESOURCE mappedResource;
+        ZeroMemory(&mappedResource, sizeof(D3D11_MAPPED_SUBRESOURCE));
+
+        //  Disable GPU access to the vertex buffer data.
+        ID3D11Resource* resource;
+        view->GetResource(&resource);
+        gdeviceContext->Map(resource, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
+
+        CopyTextureRows(reinterpret_cast<BYTE*>(mappedResource.pData), mappedResource.RowPitch, data, width, height, format);
+
+        //  Reenable GPU access to the vertex buffer data.
+        gdeviceContext->Unmap(resource, 0);
+
+        resource->Release();
+    }
+
     mv_impl void*
-    LoadTextureFromArray(unsigned width, unsigned height, float* data)
+    LoadTextureFromFile(const char* filename, int& width, int& height)
     {
+
+        //auto out_srv = static_cast<ID3D11ShaderResourceView**>(storage.texture);
         ID3D11ShaderResourceView* out_srv = nullptr;
 
+        // Load from disk into a raw RGBA buffer
+        int image_width = 0;
+        int image_height = 0;
+        unsigned char* image_data = stbi_load(filename, &image_width, &image_height, NULL, 4);
+        if (image_data == NULL)
+            return nullptr;
+
         // Create texture
         D3D11_TEXTURE2D_DESC desc;
         ZeroMemory(&desc, sizeof(desc));
-        desc.Width = width;
-        desc.Height = height;
+        desc.Width = image_width;
+        desc.Height = image_height;
         desc.MipLevels = 1;
         desc.ArraySize = 1;
+        desc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
         desc.SampleDesc.Count = 1;
         desc.Usage = D3D11_USAGE_DEFAULT;
         desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
         desc.CPUAccessFlags = 0;
-        desc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
 
         ID3D11Texture2D* pTexture = NULL;
         D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = data;
-        subResource.SysMemPitch = desc.Width * 4 * sizeof(float);
+        subResource.pSysMem = image_data;
+        subResource.SysMemPitch = desc.Width * 4;
         subResource.SysMemSlicePitch = 0;
         gdevice->CreateTexture2D(&desc, &subResource, &pTexture);
 
         // Create texture view
         D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
         ZeroMemory(&srvDesc, sizeof(srvDesc));
-        srvDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
+        srvDesc.Format = DXGI_FORMAT_R8G8B8A8_UNORM;
         srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
         srvDesc.Texture2D.MipLevels = desc.MipLevels;
         srvDesc.Texture2D.MostDetailedMip = 0;
         gdevice->CreateShaderResourceView(pTexture, &srvDesc, &out_srv);
         pTexture->Release();
 
+        width = image_width;
+        height = image_height;
+        stbi_image_free(image_data);
+
         return out_srv;
     }
 
+    mv_impl void*
+    LoadTextureFromArray(unsigned width, unsigned height, const void* data, int format)
+    {
+        return CreateArrayTexture(width, height, data, format, false);
+    }
+
     mv_impl void*
     LoadTextureFromArray(unsigned width, unsigned height, int* data)
     {
@@ -148,41 +231,11 @@ namespace Marvel {
     }
 
     mv_impl void*
-    LoadTextureFromArrayDynamic(unsigned width, unsigned height, float* data)
+    LoadTextureFromArrayDynamic(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
     {
-        ID3D11ShaderResourceView* out_srv = nullptr;
-
-        // Create texture
-        D3D11_TEXTURE2D_DESC desc;
-        ZeroMemory(&desc, sizeof(desc));
-        desc.Width = width;
-        desc.Height = height;
-        desc.MipLevels = 1;
-        desc.ArraySize = 1;
-        desc.SampleDesc.Count = 1;
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        desc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-
-        ID3D11Texture2D* pTexture = NULL;
-        D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = data;
-        subResource.SysMemPitch = desc.Width * 4 * 4;
-        subResource.SysMemSlicePitch = 0;
-        gdevice->CreateTexture2D(&desc, &subResource, &pTexture);
-
-        // Create texture view
-        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
-        ZeroMemory(&srvDesc, sizeof(srvDesc));
-        srvDesc.Format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MipLevels = desc.MipLevels;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        gdevice->CreateShaderResourceView(pTexture, &srvDesc, &out_srv);
-        pTexture->Release();
-
-        return out_srv;
+        // mapping with WRITE_DISCARD already renames the texture, so there
+        // is no ring of buffers to keep
+        return CreateArrayTexture(width, height, data, format, true);
     }
 
     mv_impl void*
@@ -224,31 +277,9 @@ namespace Marvel {
     }
 
     mv_impl void
-    UpdateTexture(void* texture, unsigned width, unsigned height, std::vector<float>& data)
+    UpdateTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
     {
-        ID3D11ShaderResourceView* view = (ID3D11ShaderResourceView*)texture;
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        ZeroMemory(&mappedResource, sizeof(D3D11_MAPPED_SUBRESOURCE));
-
-        //  Disable GPU access to the vertex buffer data.
-        ID3D11Resource* resource;
-        view->GetResource(&resource);
-        gdeviceContext->Map(resource, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-
-        BYTE* mappedData = reinterpret_cast<BYTE*>(mappedResource.pData);
-        BYTE* buffer = reinterpret_cast<BYTE*>(data.data());
-        for (UINT i = 0; i < height; ++i)
-        {
-            memcpy(mappedData, buffer, width * 4 * sizeof(float));
-            mappedData += mappedResource.RowPitch;
-            buffer += width * 4 * sizeof(float);
-        }
-        //  Update the vertex buffer here.
-        //memcpy(mappedResource.pData, data.data(), data.size()*sizeof(float));
-        //  Reenable GPU access to the vertex buffer data.
-        gdeviceContext->Unmap(resource, 0);
-
-        resource->Release();
+        MapTexture(texture, width, height, data, format);
     }
 
     mv_impl void
@@ -280,83 +311,23 @@ namespace Marvel {
     }
 
     mv_impl void
-    UpdateRawTexture(void* texture, unsigned width, unsigned height, float* data, int components)
+    UpdateRawTexture(void* texture, unsigned width, unsigned height, const void* data, int format)
     {
-        ID3D11ShaderResourceView* view = (ID3D11ShaderResourceView*)texture;
-        D3D11_MAPPED_SUBRESOURCE mappedResource;
-        ZeroMemory(&mappedResource, sizeof(D3D11_MAPPED_SUBRESOURCE));
-
-        //  Disable GPU access to the vertex buffer data.
-        ID3D11Resource* resource;
-        view->GetResource(&resource);
-        gdeviceContext->Map(resource, 0, D3D11_MAP_WRITE_DISCARD, 0, &mappedResource);
-
-        BYTE* mappedData = reinterpret_cast<BYTE*>(mappedResource.pData);
-        BYTE* buffer = reinterpret_cast<BYTE*>(data);
-        for (UINT i = 0; i < height; ++i)
-        {
-            memcpy(mappedData, buffer, width * components * sizeof(float));
-            mappedData += mappedResource.RowPitch;
-            buffer += width * components * sizeof(float);
-        }
-        //  Update the vertex buffer here.
-        //memcpy(mappedResource.pData, data.data(), data.size()*sizeof(float));
-        //  Reenable GPU access to the vertex buffer data.
-        gdeviceContext->Unmap(resource, 0);
+        MapTexture(texture, width, height, data, format);
+    }
 
-        resource->Release();
+    mv_impl void
+    UpdateTextureRegion(void* texture, unsigned width, unsigned height, const void* data, int format, unsigned x, unsigned y, unsigned regionWidth, unsigned regionHeight)
+    {
+        // dynamic textures can only be mapped with WRITE_DISCARD, which
+        // drops the old contents, so the whole surface is written
+        MapTexture(texture, width, height, data, format);
     }
 
     mv_impl void*
-    LoadTextureFromArrayRaw(unsigned width, unsigned height, float* data, int components)
+    LoadTextureFromArrayRaw(unsigned width, unsigned height, const void* data, int format, unsigned pixelBuffers)
     {
-        ID3D11ShaderResourceView* out_srv = nullptr;
-
-        DXGI_FORMAT format = DXGI_FORMAT_UNKNOWN;
-
-        switch (components)
-        {
-        case(3):
-            format = DXGI_FORMAT_R32G32B32_FLOAT;
-            break;
-        case(4):
-            format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-            break;
-        default:
-            format = DXGI_FORMAT_R32G32B32A32_FLOAT;
-        }
-
-        // Create texture
-        D3D11_TEXTURE2D_DESC desc;
-        ZeroMemory(&desc, sizeof(desc));
-        desc.Width = width;
-        desc.Height = height;
-        desc.MipLevels = 1;
-        desc.ArraySize = 1;
-        desc.SampleDesc.Count = 1;
-        desc.Usage = D3D11_USAGE_DYNAMIC;
-        desc.BindFlags = D3D11_BIND_SHADER_RESOURCE;
-        desc.CPUAccessFlags = D3D11_CPU_ACCESS_WRITE;
-        desc.Format = format;
-
-        ID3D11Texture2D* pTexture = NULL;
-        D3D11_SUBRESOURCE_DATA subResource;
-        subResource.pSysMem = data;
-        subResource.SysMemPitch = desc.Width * components * sizeof(float);
-        subResource.SysMemSlicePitch = 0;
-        gdevice->CreateTexture2D(&desc, &subResource, &pTexture);
-
-        // Create texture view
-        D3D11_SHADER_RESOURCE_VIEW_DESC srvDesc;
-        ZeroMemory(&srvDesc, sizeof(srvDesc));
-        srvDesc.Format = format;
-        srvDesc.ViewDimension = D3D11_SRV_DIMENSION_TEXTURE2D;
-        srvDesc.Texture2D.MipLevels = desc.MipLevels;
-        srvDesc.Texture2D.MostDetailedMip = 0;
-        gdevice->CreateShaderResourceView(pTexture, &srvDesc, &out_srv);
-        pTexture->Release();
-
-        return out_srv;
+        return CreateArrayTexture(width, height, data, format, true);
     }
 
     mv_impl void
@@ -376,4 +347,62 @@ namespace Marvel {
         return true;
     }
 
+    mv_impl b8
+    ReadTexturePixels(void* texture, unsigned width, unsigned height, int format, void* data)
+    {
+        ID3D11ShaderResourceView* view = (ID3D11ShaderResourceView*)texture;
+        ID3D11Resource* resource;
+        view->GetResource(&resource);
+
+        // dynamic textures can't be mapped for reading, copy to a staging one
+        D3D11_TEXTURE2D_DESC desc;
+        static_cast<ID3D11Texture2D*>(resource)->GetDesc(&desc);
+        desc.Usage = D3D11_USAGE_STAGING;
+        desc.BindFlags = 0;
+        desc.CPUAccessFlags = D3D11_CPU_ACCESS_READ;
+        desc.MiscFlags = 0;
+
+        ID3D11Texture2D* staging = nullptr;
+        if (FAILED(gdevice->CreateTexture2D(&desc, nullptr, &staging)))
+        {
+            resource->Release();
+            return false;
+        }
+        gdeviceContext->CopyResource(staging, resource);
+        resource->Release();
+
+        D3D11_MAPPED_SUBRESOURCE mappedResource;
+        if (FAILED(gdeviceContext->Map(staging, 0, D3D11_MAP_READ, 0, &mappedResource)))
+        {
+            staging->Release();
+            return false;
+        }
+
+        // gray data was expanded to rgba while uploading
+        i32 components = GetTextureFormatComponents(format);
+        size_t pitch = (size_t)width * components * GetTextureFormatComponentSize(format);
+        const BYTE* src = reinterpret_cast<const BYTE*>(mappedResource.pData);
+        BYTE* dst = reinterpret_cast<BYTE*>(data);
+        for (UINT i = 0; i < height; ++i)
+        {
+            if (format == mvTextureFormat_Byte_r || format == mvTextureFormat_Byte_rg)
+            {
+                for (unsigned j = 0; j < width; ++j)
+                {
+                    dst[j * components] = src[j * 4];
+                    if (components == 2)
+                        dst[j * components + 1] = src[j * 4 + 3];
+                }
+            }
+            else
+                memcpy(dst, src, pitch);
+            dst += pitch;
+            src += mappedResource.RowPitch;
+        }
+
+        gdeviceContext->Unmap(staging, 0);
+        staging->Release();
+        return true;
+    }
+
 }
\ No newline at end of file
@@ -3,6 +3,8 @@
 #include "mvPythonTypeChecker.h"
 #include "mvContext.h"
 #include "mvItemRegistry.h"
+#include <cstring>
+#include <type_traits>
 
 #define PY_SSIZE_T_CLEAN
 #include <Python.h>
@@ -574,92 +576,83 @@ namespace Marvel {
 
     }
 
-    mv_internal std::function<float(Py_buffer&, Py_ssize_t index)> 
-    BufferViewFunctionsFloat(Py_buffer& bufferView)
+    //-----------------------------------------------------------------------------
+    // buffer conversion
+    //     - the element type is resolved once per buffer, then a typed loop
+    //       converts the whole buffer (memcpy when the types already match).
+    //       The loops are kept trivial so compilers vectorize the widening
+    //       and narrowing conversions.
+    //-----------------------------------------------------------------------------
+
+    // exact floats skip the number protocol
+    mv_internal inline double
+    ToSequenceDouble(PyObject* item)
     {
-        if (strcmp(bufferView.format, "f") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return *((float*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "d") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((double*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "i") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((int*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "I") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned int*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "l") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "L") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((long long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "k") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "K") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned long long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "B") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((unsigned char*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "b") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((signed char*)bufferView.buf + index); };
+        return PyFloat_CheckExact(item) ? PyFloat_AS_DOUBLE(item) : PyFloat_AsDouble(item);
+    }
 
-        else if (strcmp(bufferView.format, "c") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (float)*((char*)bufferView.buf + index); };
+    template<typename Out, typename In>
+    mv_internal void
+    ConvertBufferKernel(const void* data, Py_ssize_t count, Out* out)
+    {
+        if constexpr (std::is_same<Out, In>::value)
+            memcpy(out, data, count * sizeof(Out));
         else
         {
-            mvThrowPythonError(mvErrorCode::mvWrongType, "Unknown buffer type.");
-            mvThrowPythonError(mvErrorCode::mvWrongType, bufferView.format);
-            mvThrowPythonError(mvErrorCode::mvWrongType, "Currently supported buffer types f, d, l, B");
-            return nullptr;
+            const In* in = static_cast<const In*>(data);
+            for (Py_ssize_t i = 0; i < count; ++i)
+                out[i] = (Out)in[i];
         }
     }
 
-    mv_internal std::function<int(Py_buffer&, Py_ssize_t index)> 
-    BufferViewFunctionsInt(Py_buffer& bufferView)
+    template<typename Out>
+    mv_internal bool
+    ConvertBuffer(const Py_buffer& bufferView, std::vector<Out>& items)
     {
-        if (strcmp(bufferView.format, "f") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((float*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "d") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((double*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "i") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((int*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "I") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned int*)bufferView.buf + index); };
+        const char* format = bufferView.format ? bufferView.format : "B";
 
-        else if (strcmp(bufferView.format, "l") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((long*)bufferView.buf + index); };
+        // native or little endian only, sizes are taken from itemsize
+        if (*format == '@' || *format == '=' || *format == '<')
+            format++;
 
-        else if (strcmp(bufferView.format, "L") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((long long*)bufferView.buf + index); };
+        const Py_ssize_t size = bufferView.itemsize;
+        const Py_ssize_t count = size > 0 ? bufferView.len / size : 0;
+        const void* data = bufferView.buf;
 
-        else if (strcmp(bufferView.format, "k") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "K") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned long long*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "B") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((unsigned char*)bufferView.buf + index); };
-
-        else if (strcmp(bufferView.format, "b") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((signed char*)bufferView.buf + index); };
+        void (*kernel)(const void*, Py_ssize_t, Out*) = nullptr;
+        if (format[0] != 0 && format[1] == 0)
+        {
+            switch (format[0])
+            {
+            case 'f': kernel = ConvertBufferKernel<Out, f32>; break;
+            case 'd': kernel = ConvertBufferKernel<Out, f64>; break;
+            case 'c': kernel = ConvertBufferKernel<Out, char>; break;
+            case 'b': kernel = ConvertBufferKernel<Out, i8>; break;
+            case 'B':
+            case '?': kernel = ConvertBufferKernel<Out, u8>; break;
+            case 'h': kernel = ConvertBufferKernel<Out, i16>; break;
+            case 'H': kernel = ConvertBufferKernel<Out, u16>; break;
+            case 'i':
+            case 'l':
+            case 'q': kernel = size == 8 ? ConvertBufferKernel<Out, i64> : (size == 4 ? ConvertBufferKernel<Out, i32> : nullptr); break;
+            case 'I':
+            case 'L':
+            case 'Q': kernel = size == 8 ? ConvertBufferKernel<Out, u64> : (size == 4 ? ConvertBufferKernel<Out, u32> : nullptr); break;
+            default: break;
+            }
+        }
 
-        else if (strcmp(bufferView.format, "c") == 0)
-            return [](Py_buffer& bufferView, Py_ssize_t index) {return (int)*((char*)bufferView.buf + index); };
-        else
+        if (kernel == nullptr)
         {
             mvThrowPythonError(mvErrorCode::mvWrongType, "Unknown buffer type.");
-            mvThrowPythonError(mvErrorCode::mvWrongType, bufferView.format);
-            mvThrowPythonError(mvErrorCode::mvWrongType, "Currently supported buffer types f, d, l, B");
-            return nullptr;
+            mvThrowPythonError(mvErrorCode::mvWrongType, bufferView.format ? bufferView.format : "");
+            mvThrowPythonError(mvErrorCode::mvWrongType, "Currently supported buffer types f, d, c, b, B, ?, h, H, i, I, l, L, q, Q");
+            return false;
         }
+
+        items.resize(count);
+        kernel(data, count, items.data());
+        return true;
     }
 
     std::vector<int> 
@@ -671,42 +664,25 @@ namespace Marvel {
             return items;
          
 
-        if (PyTuple_Check(value))
+        if (PyTuple_Check(value) || PyList_Check(value))
         {
-            items.resize(PyTuple_Size(value));
-            for (Py_ssize_t i = 0; i < PyTuple_Size(value); ++i)
-            {
-                items[i] = PyLong_AsLong(PyTuple_GetItem(value, i));
-            }
-        }
-
-        else if (PyList_Check(value))
-        {
-            items.resize(PyList_Size(value));
-            for (Py_ssize_t i = 0; i < PyList_Size(value); ++i)
-            {
-                items[i] = PyLong_AsLong(PyList_GetItem(value, i));
-            }
+            Py_ssize_t count = PySequence_Fast_GET_SIZE(value);
+            PyObject** pyitems = PySequence_Fast_ITEMS(value);
+            items.resize(count);
+            for (Py_ssize_t i = 0; i < count; ++i)
+                items[i] = PyLong_AsLong(pyitems[i]);
         }
 
         else if (PyObject_CheckBuffer(value))
         {
-            
-
             Py_buffer buffer_info;
 
             if (!PyObject_GetBuffer(value, &buffer_info,
                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
             {
-                auto BufferViewer = BufferViewFunctionsInt(buffer_info);
-
-                for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-                {
-                    items.emplace_back(BufferViewer(buffer_info, i));
-                }
+                ConvertBuffer(buffer_info, items);
+                PyBuffer_Release(&buffer_info);
             }
-
-            PyBuffer_Release(&buffer_info);
         }
 
         else
@@ -767,20 +743,13 @@ namespace Marvel {
             return items;
          
 
-        if (PyTuple_Check(value))
-        {
-            for (Py_ssize_t i = 0; i < PyTuple_Size(value); ++i)
-            {
-                items.emplace_back((float)PyFloat_AsDouble(PyTuple_GetItem(value, i)));
-            }
-        }
-
-        else if (PyList_Check(value))
+        if (PyTuple_Check(value) || PyList_Check(value))
         {
-            for (Py_ssize_t i = 0; i < PyList_Size(value); ++i)
-            {
-                items.emplace_back((float)PyFloat_AsDouble(PyList_GetItem(value, i)));
-            }
+            Py_ssize_t count = PySequence_Fast_GET_SIZE(value);
+            PyObject** pyitems = PySequence_Fast_ITEMS(value);
+            items.resize(count);
+            for (Py_ssize_t i = 0; i < count; ++i)
+                items[i] = (float)ToSequenceDouble(pyitems[i]);
         }
 
         else if (PyObject_CheckBuffer(value))
@@ -790,16 +759,9 @@ namespace Marvel {
             if (!PyObject_GetBuffer(value, &buffer_info,
                 PyBUF_CONTIG_RO | PyBUF_FORMAT)) 
             {
-
-                auto BufferViewer = BufferViewFunctionsFloat(buffer_info);
-                items.reserve(buffer_info.len / buffer_info.itemsize);
-
-                for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-                {
-                    items.emplace_back(BufferViewer(buffer_info, i));
-                }
+                ConvertBuffer(buffer_info, items);
+                PyBuffer_Release(&buffer_info);
             }
-            PyBuffer_Release(&buffer_info);
         }
 
         else
@@ -818,20 +780,13 @@ namespace Marvel {
             return items;
 
 
-        if (PyTuple_Check(value))
-        {
-            for (Py_ssize_t i = 0; i < PyTuple_Size(value); ++i)
-            {
-                items.emplace_back(PyFloat_AsDouble(PyTuple_GetItem(value, i)));
-            }
-        }
-
-        else if (PyList_Check(value))
+        if (PyTuple_Check(value) || PyList_Check(value))
         {
-            for (Py_ssize_t i = 0; i < PyList_Size(value); ++i)
-            {
-                items.emplace_back(PyFloat_AsDouble(PyList_GetItem(value, i)));
-            }
+            Py_ssize_t count = PySequence_Fast_GET_SIZE(value);
+            PyObject** pyitems = PySequence_Fast_ITEMS(value);
+            items.resize(count);
+            for (Py_ssize_t i = 0; i < count; ++i)
+                items[i] = ToSequenceDouble(pyitems[i]);
         }
 
         else if (PyObject_CheckBuffer(value))
@@ -841,15 +796,9 @@ namespace Marvel {
             if (!PyObject_GetBuffer(value, &buffer_info,
                 PyBUF_CONTIG_RO | PyBUF_FORMAT))
             {
-
-                auto BufferViewer = BufferViewFunctionsFloat(buffer_info);
-
-                for (Py_ssize_t i = 0; i < buffer_info.len / buffer_info.itemsize; ++i)
-                {
-                    items.emplace_back(BufferViewer(buffer_info, i));
-                }
+                ConvertBuffer(buffer_info, items);
+                PyBuffer_Release(&buffer_info);
             }
-            PyBuffer_Release(&buffer_info);
         }
 
         else
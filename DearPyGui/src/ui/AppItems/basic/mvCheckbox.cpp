@@ -80,14 +80,7 @@ namespace Marvel {
 			{
 				bool value = *_value;
 
-				if(_alias.empty())
-					mvSubmitCallback([=]() {
-						mvAddCallback(getCallback(false), _uuid, ToPyBool(value), _user_data);
-						});
-				else
-					mvSubmitCallback([=]() {
-					mvAddCallback(getCallback(false), _alias, ToPyBool(value), _user_data);
-						});
+				mvSubmitCallbackRecord(mvItemCallbackRecord(this, mvCallbackData_Bool, value));
 			}
 		}
 
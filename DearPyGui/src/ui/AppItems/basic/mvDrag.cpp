@@ -148,14 +148,7 @@ namespace Marvel {
             if (activated)
             {
                 auto value = *_value;
-                if (_alias.empty())
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _uuid, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-                        });
-                else
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _alias, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-                        });
+                mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_FloatList, value.data(), (i32)value.size()));
             }
         }
         //-----------------------------------------------------------------------------
@@ -414,14 +407,7 @@ namespace Marvel {
             if (activated)
             {
                 auto value = *_value;
-                if (_alias.empty())
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _uuid, ToPyIntList(value.data(), (int)value.size()), _user_data);
-                        });
-                else
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _alias, ToPyIntList(value.data(), (int)value.size()), _user_data);
-                        });
+                mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_IntList, value.data(), (i32)value.size()));
             }
         }
 
@@ -648,14 +634,7 @@ namespace Marvel {
             {
                 auto value = *_value;
 
-                if (_alias.empty())
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _uuid, ToPyFloat(value), _user_data);
-                        });
-                else
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _alias, ToPyFloat(value), _user_data);
-                        });
+                mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Float, &value, 1));
             }
         }
 
@@ -816,14 +795,7 @@ namespace Marvel {
             if (ImGui::DragInt(_internalLabel.c_str(), _enabled ? _value.get() : &_disabled_value, _speed, _min, _max, _format.c_str(), _flags))
             {
                 auto value = *_value;
-                if (_alias.empty())
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _uuid, ToPyInt(value), _user_data);
-                        });
-                else
-                    mvSubmitCallback([=]() {
-                    mvAddCallback(getCallback(false), _alias, ToPyInt(value), _user_data);
-                        });
+                mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Int, value));
             }
         }
 
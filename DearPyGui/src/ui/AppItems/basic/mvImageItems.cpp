@@ -5,6 +5,8 @@
 #include "AppItems/fonts/mvFont.h"
 #include "AppItems/themes/mvTheme.h"
 #include "AppItems/containers/mvDragPayload.h"
+#include "AppItems/textures/mvTextureRegions.h"
+#include "AppItems/textures/mvTextureAtlas.h"
 
 namespace Marvel {
 
@@ -101,7 +103,13 @@ namespace Marvel {
 				else
 					texture = static_cast<mvDynamicTexture*>(_texture.get())->getRawTexture();
 
-				ImGui::Image(texture, ImVec2((float)_width, (float)_height), ImVec2(_uv_min.x, _uv_min.y), ImVec2(_uv_max.x, _uv_max.y),
+				// rows pushed to the texture wrap around, starting at its cursor,
+				// atlas textures are a rect of their page
+				f32 scroll = GetTextureScroll(_texture.get());
+				mvVec2 uv_min = GetAtlasUV(_texture.get(), { _uv_min.x, _uv_min.y + scroll });
+				mvVec2 uv_max = GetAtlasUV(_texture.get(), { _uv_max.x, _uv_max.y + scroll });
+
+				ImGui::Image(texture, ImVec2((float)_width, (float)_height), uv_min, uv_max,
 					ImVec4((float)_tintColor.r, (float)_tintColor.g, (float)_tintColor.b, (float)_tintColor.a),
 					ImVec4((float)_borderColor.r, (float)_borderColor.g, (float)_borderColor.b, (float)_borderColor.a));
 
@@ -337,9 +345,13 @@ namespace Marvel {
 				else
 					texture = static_cast<mvDynamicTexture*>(_texture.get())->getRawTexture();
 
+				f32 scroll = GetTextureScroll(_texture.get());
+				mvVec2 uv_min = GetAtlasUV(_texture.get(), { _uv_min.x, _uv_min.y + scroll });
+				mvVec2 uv_max = GetAtlasUV(_texture.get(), { _uv_max.x, _uv_max.y + scroll });
+
 				ImGui::PushID(_uuid);
 				if (ImGui::ImageButton(texture, ImVec2((float)_width, (float)_height),
-					ImVec2(_uv_min.x, _uv_min.y), ImVec2(_uv_max.x, _uv_max.y), _framePadding,
+					uv_min, uv_max, _framePadding,
 					_backgroundColor, _tintColor))
 				{
 					if (_alias.empty())
@@ -132,11 +132,11 @@ namespace Marvel {
             {
                 auto value = *_value;
                 if (_alias.empty())
-                    mvSubmitCallback([=]() {
+                    mvSubmitCoalescedCallback(_uuid, 0, [=]() {
                     mvAddCallback(getCallback(false), _uuid, ToPyString(value), _user_data);
                         });
                 else
-                    mvSubmitCallback([=]() {
+                    mvSubmitCoalescedCallback(_uuid, 0, [=]() {
                     mvAddCallback(getCallback(false), _alias, ToPyString(value), _user_data);
                         });
             }
@@ -429,14 +429,7 @@ namespace Marvel {
 
                     auto value = *_value;
 
-                    if(_alias.empty())
-                        mvSubmitCallback([=]() {
-                            mvAddCallback(getCallback(false), _uuid, ToPyIntList(value.data(), (int)value.size()), _user_data);
-                            });
-                    else
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _alias, ToPyIntList(value.data(), (int)value.size()), _user_data);
-                            });
+                    mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_IntList, value.data(), (i32)value.size()));
                 }
             }
         }
@@ -663,14 +656,7 @@ namespace Marvel {
                     _last_value = *_value;
                     auto value = *_value;
 
-                    if(_alias.empty())
-                        mvSubmitCallback([=]() {
-                            mvAddCallback(getCallback(false), _uuid, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-                            });
-                    else
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _alias, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-                            });
+                    mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_FloatList, value.data(), (i32)value.size()));
                 }
             }
 
@@ -991,14 +977,7 @@ namespace Marvel {
                     _last_value = *_value;
                     auto value = *_value;
 
-                    if (_alias.empty())
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _uuid, ToPyInt(value), _user_data);
-                            });
-                    else
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _alias, ToPyInt(value), _user_data);
-                            });
+                    mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Int, value));
                 }
             }
 
@@ -1190,14 +1169,7 @@ namespace Marvel {
                     _last_value = *_value;
                     auto value = *_value;
 
-                    if (_alias.empty())
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _uuid, ToPyFloat(value), _user_data);
-                            });
-                    else
-                        mvSubmitCallback([=]() {
-                        mvAddCallback(getCallback(false), _alias, ToPyFloat(value), _user_data);
-                            });
+                    mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Float, &value, 1));
                 }
             }
         }
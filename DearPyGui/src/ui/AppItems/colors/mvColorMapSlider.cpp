@@ -78,14 +78,7 @@ namespace Marvel {
 
 			if (ImPlot::ColormapSlider(_internalLabel.c_str(), _value.get(), &_color, "", _colormap))
 			{
-				if(_alias.empty())
-					mvSubmitCallback([=]() {
-						mvAddCallback(getCallback(false), _uuid, ToPyFloat(*_value), _user_data);
-						});
-				else
-					mvSubmitCallback([=]() {
-						mvAddCallback(getCallback(false), _alias, ToPyFloat(*_value), _user_data);
-						});
+				mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Float, _value.get(), 1));
 			}
 		}
 
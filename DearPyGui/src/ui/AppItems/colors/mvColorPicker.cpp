@@ -87,16 +87,7 @@ namespace Marvel {
 			if (ImGui::ColorPicker4(_internalLabel.c_str(), _enabled ? _value->data() : &_disabled_value[0], _flags))
 			{
 				auto value = *_value;
-				mvColor color = mvColor(value[0], value[1], value[2], value[3]);
-
-				if(_alias.empty())
-					mvSubmitCallback([=]() {
-						mvAddCallback(getCallback(false), _uuid, ToPyColor(color), _user_data);
-						});
-				else
-					mvSubmitCallback([=]() {
-						mvAddCallback(getCallback(false), _alias, ToPyColor(color), _user_data);
-						});
+				mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_FloatList, value.data(), 4));
 			}
 		}
 
@@ -78,12 +78,7 @@ namespace Marvel {
         if (KnobFloat(_specifiedLabel.c_str(), _value.get(), _min, _max, _step))
         {
             auto value = *_value;
-            mvSubmitCallback([=]() {
-                if(_alias.empty())
-                    mvAddCallback(getCallback(false), _uuid, ToPyFloat(value), _user_data);
-                else
-                    mvAddCallback(getCallback(false), _alias, ToPyFloat(value), _user_data);
-                });
+            mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_Float, &value, 1));
         }
         }
 
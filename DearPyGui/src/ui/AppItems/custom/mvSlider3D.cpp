@@ -421,13 +421,7 @@ namespace Marvel {
 			if(SliderScalar3D(_specifiedLabel.c_str(), &(*_value)[0], &(*_value)[1], &(*_value)[2], _minX, _maxX, _minY, _maxY, _minZ, _maxZ, _scale))
 			{
 				auto value = *_value;
-				mvSubmitCallback([=]() {
-
-					if(_alias.empty())
-						mvAddCallback(getCallback(false), _uuid, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-					else
-						mvAddCallback(getCallback(false), _alias, ToPyFloatList(value.data(), (int)value.size()), _user_data);
-					});
+				mvSubmitCoalescedCallbackRecord(_uuid, 0, mvItemCallbackRecord(this, mvCallbackData_FloatList, value.data(), (i32)value.size()));
 			}
 		}
 
@@ -3,6 +3,8 @@
 #include "mvItemRegistry.h"
 #include "mvContext.h"
 #include "mvPythonExceptions.h"
+#include "AppItems/textures/mvTextureRegions.h"
+#include "AppItems/textures/mvTextureAtlas.h"
 
 namespace Marvel {
 
@@ -44,6 +46,12 @@ namespace Marvel {
 			else
 				texture = static_cast<mvDynamicTexture*>(_texture.get())->getRawTexture();
 
+			// rows pushed to the texture wrap around, starting at its cursor,
+			// atlas textures are a rect of their page
+			f32 scroll = GetTextureScroll(_texture.get());
+			mvVec2 uv_min = GetAtlasUV(_texture.get(), { _uv_min.x, _uv_min.y + scroll });
+			mvVec2 uv_max = GetAtlasUV(_texture.get(), { _uv_max.x, _uv_max.y + scroll });
+
 			mvVec4  tpmin = _transform * _pmin;
 			mvVec4  tpmax = _transform * _pmax;
 
@@ -66,11 +74,11 @@ namespace Marvel {
 			}
 
 			if (ImPlot::GetCurrentContext()->CurrentPlot)
-				drawlist->AddImage(texture, ImPlot::PlotToPixels(tpmin), ImPlot::PlotToPixels(tpmax), _uv_min, _uv_max, _color);
+				drawlist->AddImage(texture, ImPlot::PlotToPixels(tpmin), ImPlot::PlotToPixels(tpmax), uv_min, uv_max, _color);
 			else
 			{
 				mvVec2 start = { x, y };
-				drawlist->AddImage(texture, tpmin + start, tpmax + start, _uv_min, _uv_max, _color);
+				drawlist->AddImage(texture, tpmin + start, tpmax + start, uv_min, uv_max, _color);
 			}
 		}
 	}
@@ -3,6 +3,8 @@
 #include "mvItemRegistry.h"
 #include "mvContext.h"
 #include "mvPythonExceptions.h"
+#include "AppItems/textures/mvTextureRegions.h"
+#include "AppItems/textures/mvTextureAtlas.h"
 
 namespace Marvel {
 
@@ -48,6 +50,14 @@ namespace Marvel {
 			else
 				texture = static_cast<mvDynamicTexture*>(_texture.get())->getRawTexture();
 
+			// rows pushed to the texture wrap around, starting at its cursor,
+			// atlas textures are a rect of their page
+			f32 scroll = GetTextureScroll(_texture.get());
+			mvVec2 uv1 = GetAtlasUV(_texture.get(), { _uv1.x, _uv1.y + scroll });
+			mvVec2 uv2 = GetAtlasUV(_texture.get(), { _uv2.x, _uv2.y + scroll });
+			mvVec2 uv3 = GetAtlasUV(_texture.get(), { _uv3.x, _uv3.y + scroll });
+			mvVec2 uv4 = GetAtlasUV(_texture.get(), { _uv4.x, _uv4.y + scroll });
+
 			mvVec4  tp1 = _transform * _p1;
 			mvVec4  tp2 = _transform * _p2;
 			mvVec4  tp3 = _transform * _p3;
@@ -82,11 +92,11 @@ namespace Marvel {
 			if (ImPlot::GetCurrentContext()->CurrentPlot)
 				drawlist->AddImageQuad(texture, ImPlot::PlotToPixels(tp1), 
 					ImPlot::PlotToPixels(tp2), ImPlot::PlotToPixels(tp3), ImPlot::PlotToPixels(tp4), 
-					_uv1, _uv2, _uv3, _uv4, _color);
+					uv1, uv2, uv3, uv4, _color);
 			else
 			{
 				mvVec2 start = { x, y };
-				drawlist->AddImageQuad(texture, tp1 + start, tp2 + start, tp3.xy(), tp4.xy(), _uv1, _uv2, _uv3, _uv4, _color);
+				drawlist->AddImageQuad(texture, tp1 + start, tp2 + start, tp3.xy(), tp4.xy(), uv1, uv2, uv3, uv4, _color);
 			}
 		}
 	}
@@ -38,8 +38,6 @@ namespace Marvel {
             item->_clipViewport[4] = _clipViewport[4];
             item->_clipViewport[5] = _clipViewport[5];
             item->draw(drawlist, x, y);
-
-            UpdateAppItemState(item->_state);
         }
 	}
 
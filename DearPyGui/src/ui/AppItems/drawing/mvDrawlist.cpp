@@ -40,8 +40,6 @@ namespace Marvel {
 				continue;
 
 			item->draw(internal_drawlist, _startx, _starty);
-
-			UpdateAppItemState(item->_state);
 		}
 
 		ImGui::PopClipRect();
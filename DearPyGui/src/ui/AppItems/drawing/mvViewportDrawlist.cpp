@@ -31,8 +31,6 @@ namespace Marvel {
 				continue;
 
 			item->draw(internal_drawlist, 0.0f, 0.0f);
-
-			UpdateAppItemState(item->_state);
 		}
 
 	}
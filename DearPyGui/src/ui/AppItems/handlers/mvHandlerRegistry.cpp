@@ -1,20 +1,150 @@
 #include "mvHandlerRegistry.h"
 #include "mvPythonExceptions.h"
 #include "mvLog.h"
+#include "mvKeyDownHandler.h"
+#include "mvKeyPressHandler.h"
+#include "mvKeyReleaseHandler.h"
+#include "mvMouseClickHandler.h"
+#include "mvMouseDoubleClickHandler.h"
+#include "mvMouseDownHandler.h"
+#include "mvMouseDragHandler.h"
+#include "mvMouseReleaseHandler.h"
 
 namespace Marvel {
 
+	mv_internal mvInputDelta InputDelta;
+
+	void
+	UpdateInputDelta()
+	{
+		for (auto& codes : InputDelta.codes)
+			codes.clear();
+
+		ImGuiIO& io = ImGui::GetIO();
+
+		for (i32 i = 0; i < IM_ARRAYSIZE(io.KeysDown); i++)
+		{
+			if (io.KeysDown[i])
+			{
+				InputDelta.codes[mvInputEvent_KeyDown].push_back(i);
+				if (ImGui::IsKeyPressed(i))
+					InputDelta.codes[mvInputEvent_KeyPress].push_back(i);
+			}
+			else if (io.KeysDownDurationPrev[i] >= 0.0f)
+				InputDelta.codes[mvInputEvent_KeyRelease].push_back(i);
+		}
+
+		for (i32 i = 0; i < IM_ARRAYSIZE(io.MouseDown); i++)
+		{
+			b8 released = ImGui::IsMouseReleased(i);
+			if (io.MouseDown[i])
+				InputDelta.codes[mvInputEvent_MouseDown].push_back(i);
+			if (io.MouseDown[i] || released)
+				InputDelta.codes[mvInputEvent_MouseDrag].push_back(i);
+			if (ImGui::IsMouseClicked(i))
+				InputDelta.codes[mvInputEvent_MouseClick].push_back(i);
+			if (ImGui::IsMouseDoubleClicked(i))
+				InputDelta.codes[mvInputEvent_MouseDoubleClick].push_back(i);
+			if (released)
+				InputDelta.codes[mvInputEvent_MouseRelease].push_back(i);
+		}
+
+		ImVec2 mousepos = ImGui::GetMousePos();
+		if (ImGui::IsMousePosValid(&mousepos) && (InputDelta.mousePos.x != mousepos.x || InputDelta.mousePos.y != mousepos.y))
+		{
+			InputDelta.mousePos = { mousepos.x, mousepos.y };
+			InputDelta.codes[mvInputEvent_MouseMove].push_back(0);
+		}
+
+		if (i32 wheel = (i32)io.MouseWheel)
+			InputDelta.codes[mvInputEvent_MouseWheel].push_back(wheel);
+	}
+
+	const mvInputDelta&
+	GetInputDelta()
+	{
+		return InputDelta;
+	}
+
+	void
+	InvalidateHandlerIndex(mvAppItem* handler)
+	{
+		if (handler->_parentPtr && handler->_parentPtr->_type == mvAppItemType::mvHandlerRegistry)
+			static_cast<mvHandlerRegistry*>(handler->_parentPtr)->invalidateIndex();
+	}
+
 	mvHandlerRegistry::mvHandlerRegistry(mvUUID uuid)
 		:
 		mvAppItem(uuid)
 	{
 	}
 
-	void mvHandlerRegistry::draw(ImDrawList* drawlist, float x, float y)
+	void mvHandlerRegistry::buildIndex()
 	{
+		for (auto& index : _index)
+		{
+			index.any.clear();
+			index.codes.clear();
+		}
+		_polled.clear();
 
 		for (auto& item : _children[1])
-			item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
+		{
+			i32 event = -1;
+			i32 code = -1;
+
+			switch (item->_type)
+			{
+			case mvAppItemType::mvKeyDownHandler:          event = mvInputEvent_KeyDown; code = static_cast<mvKeyDownHandler*>(item.get())->getKey(); break;
+			case mvAppItemType::mvKeyPressHandler:         event = mvInputEvent_KeyPress; code = static_cast<mvKeyPressHandler*>(item.get())->getKey(); break;
+			case mvAppItemType::mvKeyReleaseHandler:       event = mvInputEvent_KeyRelease; code = static_cast<mvKeyReleaseHandler*>(item.get())->getKey(); break;
+			case mvAppItemType::mvMouseDownHandler:        event = mvInputEvent_MouseDown; code = static_cast<mvMouseDownHandler*>(item.get())->getButton(); break;
+			case mvAppItemType::mvMouseClickHandler:       event = mvInputEvent_MouseClick; code = static_cast<mvMouseClickHandler*>(item.get())->getButton(); break;
+			case mvAppItemType::mvMouseDoubleClickHandler: event = mvInputEvent_MouseDoubleClick; code = static_cast<mvMouseDoubleClickHandler*>(item.get())->getButton(); break;
+			case mvAppItemType::mvMouseReleaseHandler:     event = mvInputEvent_MouseRelease; code = static_cast<mvMouseReleaseHandler*>(item.get())->getButton(); break;
+			case mvAppItemType::mvMouseDragHandler:        event = mvInputEvent_MouseDrag; code = static_cast<mvMouseDragHandler*>(item.get())->getButton(); break;
+			case mvAppItemType::mvMouseMoveHandler:        event = mvInputEvent_MouseMove; break;
+			case mvAppItemType::mvMouseWheelHandler:       event = mvInputEvent_MouseWheel; break;
+			default: break;
+			}
+
+			if (event == -1)
+				_polled.push_back(item.get());
+			else if (code == -1)
+				_index[event].any.push_back(item.get());
+			else
+				_index[event].codes[code].push_back(item.get());
+		}
+
+		_indexDirty = false;
+	}
 
+	void mvHandlerRegistry::draw(ImDrawList* drawlist, float x, float y)
+	{
+		if (_indexDirty)
+			buildIndex();
+
+		const mvInputDelta& delta = GetInputDelta();
+		for (i32 event = 0; event < mvInputEvent_Count; event++)
+		{
+			const mvHandlerIndex& index = _index[event];
+			if (index.any.empty() && index.codes.empty())
+				continue;
+
+			for (i32 code : delta.codes[event])
+			{
+				for (auto item : index.any)
+					item->customAction(&code);
+
+				auto found = index.codes.find(code);
+				if (found == index.codes.end())
+					continue;
+				for (auto item : found->second)
+					item->customAction(&code);
+			}
+		}
+
+		for (auto item : _polled)
+			item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 	}
-}
\ No newline at end of file
+}
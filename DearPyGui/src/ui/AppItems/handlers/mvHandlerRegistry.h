@@ -1,5 +1,6 @@
 #pragma once
 
+#include <unordered_map>
 #include "mvAppItem.h"
 #include "mvItemRegistry.h"
 #include "dearpygui.h"
@@ -7,6 +8,47 @@
 
 namespace Marvel {
 
+    //-----------------------------------------------------------------------------
+    // mvHandlerRegistry
+    //     - global handlers are indexed by the input event they listen to and
+    //       their key/button, instead of each one polling every frame
+    //     - the frame's input delta is gathered once (UpdateInputDelta) and
+    //       dispatched to matching handlers through customAction, with the
+    //       key, button or wheel amount as data
+    //     - frames without input don't touch any handler
+    //-----------------------------------------------------------------------------
+
+    enum mvInputEvent
+    {
+        mvInputEvent_KeyDown = 0,
+        mvInputEvent_KeyPress,
+        mvInputEvent_KeyRelease,
+        mvInputEvent_MouseDown,
+        mvInputEvent_MouseClick,
+        mvInputEvent_MouseDoubleClick,
+        mvInputEvent_MouseRelease,
+        mvInputEvent_MouseDrag,  // buttons held or released, handlers check their threshold
+        mvInputEvent_MouseMove,  // code 0
+        mvInputEvent_MouseWheel, // code is the wheel amount
+        mvInputEvent_Count
+    };
+
+    struct mvInputDelta
+    {
+        std::vector<i32> codes[mvInputEvent_Count]; // keys or buttons per event
+        mvVec2           mousePos = { 0.0f, 0.0f };
+    };
+
+    struct mvHandlerIndex
+    {
+        std::vector<mvAppItem*>                          any;   // key or button -1, move and wheel
+        std::unordered_map<i32, std::vector<mvAppItem*>> codes;
+    };
+
+    void                UpdateInputDelta(); // once per frame, before registries are drawn
+    const mvInputDelta& GetInputDelta();
+    void                InvalidateHandlerIndex(mvAppItem* handler); // a handler's key or button changed
+
     class mvHandlerRegistry : public mvAppItem
     {
 
@@ -15,6 +57,18 @@ namespace Marvel {
         explicit mvHandlerRegistry(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override;
+        void onChildAdd(mvRef<mvAppItem> item) override { _indexDirty = true; }
+        void onChildRemoved(mvRef<mvAppItem> item) override { _indexDirty = true; }
+        void onChildrenRemoved() override { _indexDirty = true; }
+        void invalidateIndex() { _indexDirty = true; }
+
+    private:
+
+        void buildIndex();
+
+        mvHandlerIndex          _index[mvInputEvent_Count];
+        std::vector<mvAppItem*> _polled; // anything else still draws every frame
+        b8             _indexDirty = true;
 
     };
 
@@ -1,4 +1,5 @@
 #include "mvKeyDownHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -21,34 +22,17 @@ namespace Marvel {
 
 	void mvKeyDownHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
+		// dispatched by mvHandlerRegistry
+	}
 
-		if (_key == -1)
-		{
-			for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
-			{
-				if (ImGui::GetIO().KeysDown[i])
-				{
-					mvSubmitCallback([=]()
-						{
-							if(_alias.empty())
-								mvRunCallback(getCallback(false), _uuid, ToPyMPair(i, ImGui::GetIO().KeysDownDuration[i]), _user_data);
-							else
-								mvRunCallback(getCallback(false), _alias, ToPyMPair(i, ImGui::GetIO().KeysDownDuration[i]), _user_data);
-						});
-				}
-			}
-		}
-
-		else if (ImGui::GetIO().KeysDown[_key])
-		{
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, ToPyMPair(_key, ImGui::GetIO().KeysDownDuration[_key]), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, ToPyMPair(_key, ImGui::GetIO().KeysDownDuration[_key]), _user_data);
-				});
-		}
+	void mvKeyDownHandler::customAction(void* data)
+	{
+		i32 key = *(i32*)data;
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_IntFloat;
+		record.code = key;
+		record.x = ImGui::GetIO().KeysDownDuration[key];
+		mvSubmitCoalescedCallbackRecord(_uuid, key, record);
 	}
 
 	void mvKeyDownHandler::handleSpecificRequiredArgs(PyObject* dict)
@@ -76,7 +60,7 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "key")) _key = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "key")) { _key = ToInt(item); InvalidateHandlerIndex(this); }
 	}
 
 	void mvKeyDownHandler::getSpecificConfiguration(PyObject* dict)
@@ -12,11 +12,14 @@ namespace Marvel {
         explicit mvKeyDownHandler(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override;
+        void customAction(void* data) override; // data is the i32 key from the input delta
         void handleSpecificRequiredArgs(PyObject* dict) override;
         void handleSpecificKeywordArgs(PyObject* dict) override;
         void getSpecificConfiguration(PyObject* dict) override;
         void applySpecificTemplate(mvAppItem* item) override;
 
+        i32 getKey() const { return _key; }
+
     private:
 
         int _key = -1;
@@ -1,4 +1,5 @@
 #include "mvKeyPressHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -21,33 +22,15 @@ namespace Marvel {
 
 	void mvKeyPressHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
-		if (_key == -1)
-		{
-			for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().KeysDown); i++)
-			{
-				if (ImGui::IsKeyPressed(i))
-				{
-					mvSubmitCallback([=]()
-						{
-							if (_alias.empty())
-								mvRunCallback(getCallback(false), _uuid, ToPyInt(i), _user_data);
-							else
-								mvRunCallback(getCallback(false), _alias, ToPyInt(i), _user_data);
-						});
-				}
-			}
-		}
+		// dispatched by mvHandlerRegistry
+	}
 
-		else if (ImGui::IsKeyPressed(_key))
-		{
-			mvSubmitCallback([=]()
-				{
-					if(_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, ToPyInt(_key), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, ToPyInt(_key), _user_data);
-				});
-		}
+	void mvKeyPressHandler::customAction(void* data)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_Int;
+		record.code = *(i32*)data;
+		mvSubmitCallbackRecord(record);
 	}
 
 	void mvKeyPressHandler::handleSpecificPositionalArgs(PyObject* dict)
@@ -75,7 +58,7 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "key")) _key = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "key")) { _key = ToInt(item); InvalidateHandlerIndex(this); }
 	}
 
 	void mvKeyPressHandler::getSpecificConfiguration(PyObject* dict)
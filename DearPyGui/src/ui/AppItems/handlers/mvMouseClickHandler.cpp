@@ -1,4 +1,5 @@
 #include "mvMouseClickHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -21,33 +22,15 @@ namespace Marvel {
 
 	void mvMouseClickHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
-		if (_button == -1)
-		{
-			for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-			{
-				if (ImGui::IsMouseClicked(i))
-				{
-					mvSubmitCallback([=]()
-						{
-							if (_alias.empty())
-								mvRunCallback(getCallback(false), _uuid, ToPyInt(i), _user_data);
-							else
-								mvRunCallback(getCallback(false), _alias, ToPyInt(i), _user_data);
-						});
-				}
-			}
-		}
+		// dispatched by mvHandlerRegistry
+	}
 
-		else if (ImGui::IsMouseClicked(_button))
-		{
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, ToPyInt(_button), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, ToPyInt(_button), _user_data);
-				});
-		}
+	void mvMouseClickHandler::customAction(void* data)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_Int;
+		record.code = *(i32*)data;
+		mvSubmitCallbackRecord(record);
 	}
 
 	void mvMouseClickHandler::handleSpecificPositionalArgs(PyObject* dict)
@@ -75,7 +58,7 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "button")) { _button = ToInt(item); InvalidateHandlerIndex(this); }
 	}
 
 	void mvMouseClickHandler::getSpecificConfiguration(PyObject* dict)
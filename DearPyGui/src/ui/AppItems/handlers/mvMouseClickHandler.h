@@ -12,11 +12,14 @@ namespace Marvel {
         explicit mvMouseClickHandler(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override;
+        void customAction(void* data) override; // data is the i32 button from the input delta
         void handleSpecificPositionalArgs(PyObject* dict) override;
         void handleSpecificKeywordArgs(PyObject* dict) override;
         void getSpecificConfiguration(PyObject* dict) override;
         void applySpecificTemplate(mvAppItem* item) override;
 
+        i32 getButton() const { return _button; }
+
     private:
 
         int _button = -1;
@@ -1,4 +1,5 @@
 #include "mvMouseDownHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -21,33 +22,17 @@ namespace Marvel {
 
 	void mvMouseDownHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
-		if (_button == -1)
-		{
-			for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-			{
-				if (ImGui::GetIO().MouseDown[i])
-				{
-					mvSubmitCallback([=]()
-						{
-							if (_alias.empty())
-								mvRunCallback(getCallback(false), _uuid, ToPyMPair(i, ImGui::GetIO().MouseDownDuration[i]), _user_data);
-							else
-								mvRunCallback(getCallback(false), _alias, ToPyMPair(i, ImGui::GetIO().MouseDownDuration[i]), _user_data);
-						});
-				}
-			}
-		}
+		// dispatched by mvHandlerRegistry
+	}
 
-		else if (ImGui::GetIO().MouseDown[_button])
-		{
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, ToPyMPair(_button, ImGui::GetIO().MouseDownDuration[_button]), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, ToPyMPair(_button, ImGui::GetIO().MouseDownDuration[_button]), _user_data);
-				});
-		}
+	void mvMouseDownHandler::customAction(void* data)
+	{
+		i32 button = *(i32*)data;
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_IntFloat;
+		record.code = button;
+		record.x = ImGui::GetIO().MouseDownDuration[button];
+		mvSubmitCoalescedCallbackRecord(_uuid, button, record);
 	}
 
 	void mvMouseDownHandler::handleSpecificPositionalArgs(PyObject* dict)
@@ -75,7 +60,7 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "button")) { _button = ToInt(item); InvalidateHandlerIndex(this); }
 	}
 
 	void mvMouseDownHandler::getSpecificConfiguration(PyObject* dict)
@@ -1,4 +1,5 @@
 #include "mvMouseDragHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -22,42 +23,25 @@ namespace Marvel {
 
 	void mvMouseDragHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
-		if (_button == -1)
-		{
-			for (int i = 0; i < IM_ARRAYSIZE(ImGui::GetIO().MouseDown); i++)
-			{
-				if (ImGui::IsMouseReleased(i))
-					ImGui::ResetMouseDragDelta(i);
-
-				if (ImGui::IsMouseDragging(i, _threshold))
-				{
-					mvSubmitCallback([=]()
-						{
-							if (_alias.empty())
-								mvRunCallback(getCallback(false), _uuid,
-									ToPyMTrip(i, ImGui::GetMouseDragDelta(i).x, ImGui::GetMouseDragDelta(i).y), _user_data);
-							else
-								mvRunCallback(getCallback(false), _alias,
-									ToPyMTrip(i, ImGui::GetMouseDragDelta(i).x, ImGui::GetMouseDragDelta(i).y), _user_data);
-						});
-				}
-			}
-		}
+		// dispatched by mvHandlerRegistry
+	}
 
-		else if (ImGui::IsMouseDragging(_button, _threshold))
-		{
-			if (ImGui::IsMouseReleased(_button))
-				ImGui::ResetMouseDragDelta(_button);
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid,
-							ToPyMTrip(_button, ImGui::GetMouseDragDelta(_button).x, ImGui::GetMouseDragDelta(_button).y), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias,
-							ToPyMTrip(_button, ImGui::GetMouseDragDelta(_button).x, ImGui::GetMouseDragDelta(_button).y), _user_data);
-				});
-		}
+	void mvMouseDragHandler::customAction(void* data)
+	{
+		i32 button = *(i32*)data;
+
+		if (ImGui::IsMouseReleased(button))
+			ImGui::ResetMouseDragDelta(button);
+
+		if (!ImGui::IsMouseDragging(button, _threshold))
+			return;
+
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_IntFloatFloat;
+		record.code = button;
+		record.x = ImGui::GetMouseDragDelta(button).x;
+		record.y = ImGui::GetMouseDragDelta(button).y;
+		mvSubmitCoalescedCallbackRecord(_uuid, button, record);
 	}
 
 	void mvMouseDragHandler::handleSpecificPositionalArgs(PyObject* dict)
@@ -88,7 +72,7 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "button")) _button = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "button")) { _button = ToInt(item); InvalidateHandlerIndex(this); }
 		if (PyObject* item = PyDict_GetItemString(dict, "threshold")) _threshold = ToFloat(item);
 	}
 
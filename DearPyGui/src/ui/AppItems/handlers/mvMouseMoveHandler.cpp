@@ -1,4 +1,5 @@
 #include "mvMouseMoveHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -15,24 +16,15 @@ namespace Marvel {
 
 	void mvMouseMoveHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
+		// dispatched by mvHandlerRegistry
+	}
 
-		// update mouse
-		// mouse move event
-		ImVec2 mousepos = ImGui::GetMousePos();
-		if (ImGui::IsMousePosValid(&mousepos))
-		{
-			if (_oldPos.x != mousepos.x || _oldPos.y != mousepos.y)
-			{
-				_oldPos = mousepos;
-
-				mvSubmitCallback([=]()
-					{
-						if(_alias.empty())
-							mvRunCallback(getCallback(false), _uuid, ToPyPair(mousepos.x, mousepos.y), _user_data);
-						else
-							mvRunCallback(getCallback(false), _alias, ToPyPair(mousepos.x, mousepos.y), _user_data);
-					});
-			}
-		}
+	void mvMouseMoveHandler::customAction(void* data)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_FloatPair;
+		record.x = GetInputDelta().mousePos.x;
+		record.y = GetInputDelta().mousePos.y;
+		mvSubmitCoalescedCallbackRecord(_uuid, 0, record);
 	}
 }
\ No newline at end of file
@@ -12,10 +12,7 @@ namespace Marvel {
         explicit mvMouseMoveHandler(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override;
-
-    private:
-
-        ImVec2 _oldPos = {};
+        void customAction(void* data) override; // data is unused, the position comes from the input delta
 
     };
 
@@ -1,4 +1,5 @@
 #include "mvMouseWheelHandler.h"
+#include "mvHandlerRegistry.h"
 #include "mvLog.h"
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
@@ -15,18 +16,14 @@ namespace Marvel {
 
 	void mvMouseWheelHandler::draw(ImDrawList* drawlist, float x, float y)
 	{
-		int wheel = (int)ImGui::GetIO().MouseWheel;
-		if (wheel)
-		{
+		// dispatched by mvHandlerRegistry
+	}
 
-			mvSubmitCallback([=]()
-			{
-				if (_alias.empty())
-					mvRunCallback(getCallback(false), _uuid, ToPyInt(wheel), _user_data);
-				else
-					mvRunCallback(getCallback(false), _alias, ToPyInt(wheel), _user_data);
-			});
-			
-		}
+	void mvMouseWheelHandler::customAction(void* data)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_Int;
+		record.code = *(i32*)data;
+		mvSubmitCallbackRecord(record);
 	}
 }
\ No newline at end of file
@@ -12,6 +12,7 @@ namespace Marvel {
         explicit mvMouseWheelHandler(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override;
+        void customAction(void* data) override; // data is the i32 wheel amount from the input delta
 
     };
 
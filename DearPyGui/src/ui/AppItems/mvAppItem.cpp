@@ -30,6 +30,7 @@ namespace Marvel {
         _uuid = uuid;
         _internalLabel = "###" + std::to_string(_uuid);
         _state.parent = this;
+        _state.lastRequested = GContext->frame; // new items report state for a while
     }
 
     mvAppItem::~mvAppItem()
@@ -55,7 +56,16 @@ namespace Marvel {
                 if (!GContext->IO.manualAliasManagement)
                     GContext->itemRegistry->aliases.erase(_alias);
             }
-            CleanUpItem(*GContext->itemRegistry, _uuid);
+
+            // uuid may already belong to a new item if this one
+            // outlived its deletion
+            mvAppItem* current = GetItem(*GContext->itemRegistry, _uuid);
+            if (current == this)
+                CleanUpItem(*GContext->itemRegistry, _uuid);
+
+            // drop the callback lane (set_callback_lane) unless the new item owns it
+            if (GContext->callbackRegistry && (current == this || current == nullptr))
+                mvSetCallbackLane(_uuid, "", false);
         }
     }
 
@@ -172,6 +182,7 @@ namespace Marvel {
                     childset[index - 1] = loweritem;
 
                     UpdateLocations(_children, 4);
+                    onChildrenReordered();
                 }
 
                 return true;
@@ -220,6 +231,7 @@ namespace Marvel {
                     childset[index + 1] = upperitem;
 
                     UpdateLocations(_children, 4);
+                    onChildrenReordered();
                 }
 
                 return true;
@@ -512,18 +524,6 @@ namespace Marvel {
         if (_uuid == uuid)
             return this;
 
-        if (_searchLast)
-        {
-            if (_searchDelayed)
-                _searchDelayed = false;
-            else
-            {
-                _searchDelayed = true;
-                DelaySearch(*GContext->itemRegistry, this);
-                return nullptr;
-            }
-        }
-
         for (auto& childset : _children)
         {
             for (auto& item : childset)
@@ -2141,6 +2141,13 @@ namespace Marvel {
         #undef X
     }
 
+    // keyword docs shared by the series parsers
+    mv_internal const char* SeriesZeroCopyDoc = "Plot directly from the x/y buffers (numpy, array, ...) instead of copying them. Buffers must be 1D, share a numeric type and stride, and stay referenced by the series.";
+    mv_internal const char* SeriesCapacityDoc = "Maximum number of samples kept when streaming with append_series_data. Older samples are overwritten in place (0 is unbounded).";
+    mv_internal const char* SeriesDownsampleDoc = "Reduces the visible data to about 2 points per pixel column before plotting. mvPlotDownsample_None, mvPlotDownsample_MinMax or mvPlotDownsample_LTTB (sorted x only).";
+    mv_internal const char* SeriesSortedXDoc = "Hint that x is sorted ascending, so only the visible range is drawn. Without it, the order is checked once after the data changes (in-place edits of zero_copy buffers are not seen).";
+    mv_internal const char* SeriesLodDoc = "Builds a min/max level of detail pyramid in the background and draws the level matching the pixel density (large series with sorted x). Ring buffer (capacity) and source series always draw every sample, wrapping shifts every index so no pyramid is kept for them.";
+
     mvPythonParser
     GetEntityParser(mvAppItemType type)
     {
@@ -3441,6 +3448,7 @@ namespace Marvel {
             args.push_back({ mvPyDataType::Bool, "scrollX", mvArgType::KEYWORD_ARG, "False", "Enable horizontal scrolling. Require 'outer_size' parameter of BeginTable() to specify the container size. Changes default sizing policy. Because this create a child window, ScrollY is currently generally recommended when using ScrollX." });
             args.push_back({ mvPyDataType::Bool, "scrollY", mvArgType::KEYWORD_ARG, "False", "Enable vertical scrolling." });
             args.push_back({ mvPyDataType::Bool, "no_saved_settings", mvArgType::KEYWORD_ARG, "False", "Never load/save settings in .ini file." });
+            args.push_back({ mvPyDataType::Bool, "native_sort", mvArgType::KEYWORD_ARG, "False", "Sort rows internally when the sort specs change instead of running the callback. Stable, multi-column, keyed per column by sort_key." });
 
             setup.about = "Adds a table.";
             setup.category = { "Tables", "Containers", "Widgets" };
@@ -3475,6 +3483,7 @@ namespace Marvel {
             args.push_back({ mvPyDataType::Bool, "prefer_sort_descending", mvArgType::KEYWORD_ARG, "False", "Make the initial sort direction Descending when first sorting on this column." });
             args.push_back({ mvPyDataType::Bool, "indent_enable", mvArgType::KEYWORD_ARG, "False", "Use current Indent value when entering cell (default for column 0)." });
             args.push_back({ mvPyDataType::Bool, "indent_disable", mvArgType::KEYWORD_ARG, "False", "Ignore current Indent value when entering cell (default for columns > 0). Indentation changes _within_ the cell will still be honored." });
+            args.push_back({ mvPyDataType::Integer, "sort_key", mvArgType::KEYWORD_ARG, "0", "How cells are compared by tables with native_sort. mvTable_SortKeyAuto (numbers for numeric values, text otherwise), mvTable_SortKeyText or mvTable_SortKeyNumber. A cell's filter_key is used as its key if set." });
 
             setup.about = "Adds a table column.";
             setup.category = { "Tables", "Widgets" };
@@ -4041,6 +4050,11 @@ namespace Marvel {
 
             args.push_back({ mvPyDataType::DoubleList, "x" });
             args.push_back({ mvPyDataType::DoubleList, "y" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Integer, "capacity", mvArgType::KEYWORD_ARG, "0", SeriesCapacityDoc });
+            args.push_back({ mvPyDataType::Integer, "downsample", mvArgType::KEYWORD_ARG, "0", SeriesDownsampleDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
+            args.push_back({ mvPyDataType::Bool, "lod", mvArgType::KEYWORD_ARG, "False", SeriesLodDoc });
 
             setup.about = "Adds a line series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4058,6 +4072,9 @@ namespace Marvel {
 
             args.push_back({ mvPyDataType::DoubleList, "x" });
             args.push_back({ mvPyDataType::DoubleList, "y" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Integer, "capacity", mvArgType::KEYWORD_ARG, "0", SeriesCapacityDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
 
             setup.about = "Adds a scatter series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4076,6 +4093,8 @@ namespace Marvel {
 
             args.push_back({ mvPyDataType::DoubleList, "x" });
             args.push_back({ mvPyDataType::DoubleList, "y" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
 
             setup.about = "Adds a stem series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4093,6 +4112,11 @@ namespace Marvel {
 
             args.push_back({ mvPyDataType::DoubleList, "x" });
             args.push_back({ mvPyDataType::DoubleList, "y" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Integer, "capacity", mvArgType::KEYWORD_ARG, "0", SeriesCapacityDoc });
+            args.push_back({ mvPyDataType::Integer, "downsample", mvArgType::KEYWORD_ARG, "0", SeriesDownsampleDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
+            args.push_back({ mvPyDataType::Bool, "lod", mvArgType::KEYWORD_ARG, "False", SeriesLodDoc });
 
             setup.about = "Adds a stair series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4112,6 +4136,7 @@ namespace Marvel {
             args.push_back({ mvPyDataType::DoubleList, "y" });
             args.push_back({ mvPyDataType::Float, "weight", mvArgType::KEYWORD_ARG, "1.0" });
             args.push_back({ mvPyDataType::Bool, "horizontal", mvArgType::KEYWORD_ARG, "False" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
 
             setup.about = "Adds a bar series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4189,6 +4214,7 @@ namespace Marvel {
             args.push_back({ mvPyDataType::DoubleList, "bounds_max", mvArgType::KEYWORD_ARG, "(1.0, 1.0)" });
             args.push_back({ mvPyDataType::String, "format", mvArgType::KEYWORD_ARG, "'%0.1f'" });
             args.push_back({ mvPyDataType::Bool, "contribute_to_bounds", mvArgType::KEYWORD_ARG, "True" });
+            args.push_back({ mvPyDataType::Bool, "use_texture", mvArgType::KEYWORD_ARG, "False", "Colorizes the matrix into a texture when the data, scale or colormap change and draws it as a single image. Much faster for large matrices (cell labels are not drawn)." });
 
             setup.about = "Adds a heat series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4251,6 +4277,9 @@ namespace Marvel {
             args.push_back({ mvPyDataType::DoubleList, "x" });
             args.push_back({ mvPyDataType::DoubleList, "y1" });
             args.push_back({ mvPyDataType::DoubleList, "y2", mvArgType::KEYWORD_ARG, "[]" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Integer, "downsample", mvArgType::KEYWORD_ARG, "0", SeriesDownsampleDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
 
             setup.about = "Adds a shade series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4363,6 +4392,9 @@ namespace Marvel {
             args.push_back({ mvPyDataType::DoubleList, "y" });
             args.push_back({ mvPyDataType::IntList, "fill", mvArgType::KEYWORD_ARG, "(0, 0, 0, -255)" });
             args.push_back({ mvPyDataType::Bool, "contribute_to_bounds", mvArgType::KEYWORD_ARG, "True" });
+            args.push_back({ mvPyDataType::Bool, "zero_copy", mvArgType::KEYWORD_ARG, "False", SeriesZeroCopyDoc });
+            args.push_back({ mvPyDataType::Integer, "downsample", mvArgType::KEYWORD_ARG, "0", SeriesDownsampleDoc });
+            args.push_back({ mvPyDataType::Bool, "sorted_x", mvArgType::KEYWORD_ARG, "False", SeriesSortedXDoc });
 
             setup.about = "Adds an area series to a plot.";
             setup.category = { "Plotting", "Containers", "Widgets" };
@@ -4501,6 +4533,8 @@ namespace Marvel {
             );
 
             args.push_back({ mvPyDataType::Bool, "show", mvArgType::KEYWORD_ARG, "False", "Attempt to render widget." });
+            args.push_back({ mvPyDataType::Bool, "atlas", mvArgType::KEYWORD_ARG, "False", "Packs static textures added afterwards into shared pages, so images of them batch into fewer draw calls." });
+            args.push_back({ mvPyDataType::Integer, "atlas_page_size", mvArgType::KEYWORD_ARG, "1024", "Width and height of new atlas pages, larger static textures get their own texture." });
 
             setup.about = "Adds a dynamic texture.";
             setup.category = { "Textures", "Registries", "Widgets" };
@@ -4516,6 +4550,8 @@ namespace Marvel {
             args.push_back({ mvPyDataType::Integer, "width" });
             args.push_back({ mvPyDataType::Integer, "height" });
             args.push_back({ mvPyDataType::FloatList, "default_value" });
+            args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is)." });
+            args.push_back({ mvPyDataType::String, "file", mvArgType::KEYWORD_ARG, "''", "Image file decoded on a worker thread, replaces width, height and default_value once loaded." });
             args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "internal_dpg.mvReservedUUID_2", "Parent to add this item to. (runtime adding)" });
 
             setup.about = "Adds a static texture.";
@@ -4531,6 +4567,8 @@ namespace Marvel {
             args.push_back({ mvPyDataType::Integer, "width" });
             args.push_back({ mvPyDataType::Integer, "height" });
             args.push_back({ mvPyDataType::FloatList, "default_value" });
+            args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "Data format, mvFormat_Float_rgba/rgb take floats, mvFormat_Byte_rgba/r/rg take 0-255 values (uint8 buffers are copied as is) and mvFormat_Half_rgba takes floats (float16 buffers are copied as is)." });
+            args.push_back({ mvPyDataType::Bool, "streaming", mvArgType::KEYWORD_ARG, "False", "Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory." });
             args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "internal_dpg.mvReservedUUID_2", "Parent to add this item to. (runtime adding)" });
 
             setup.about = "Adds a dynamic texture.";
@@ -5280,7 +5318,9 @@ namespace Marvel {
             args.push_back({ mvPyDataType::Integer, "width" });
             args.push_back({ mvPyDataType::Integer, "height" });
             args.push_back({ mvPyDataType::FloatList, "default_value" });
-            args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "Data format." });
+            args.push_back({ mvPyDataType::Integer, "format", mvArgType::KEYWORD_ARG, "internal_dpg.mvFormat_Float_rgba", "Data format, the buffer is uploaded as is so it must match (float32, uint8 for the byte formats, float16 for mvFormat_Half_rgba)." });
+            args.push_back({ mvPyDataType::Bool, "full_upload", mvArgType::KEYWORD_ARG, "True", "Uploads the whole buffer every frame. Turn off to upload only the regions reported with set_texture_region/push_texture_rows." });
+            args.push_back({ mvPyDataType::Bool, "streaming", mvArgType::KEYWORD_ARG, "False", "Uploads through a ring of pixel buffers (OpenGL) so updating every frame doesn't wait on the previous upload. Uses more memory." });
             args.push_back({ mvPyDataType::UUID, "parent", mvArgType::KEYWORD_ARG, "internal_dpg.mvReservedUUID_2", "Parent to add this item to. (runtime adding)" });
 
             setup.about = "Adds a raw texture.";
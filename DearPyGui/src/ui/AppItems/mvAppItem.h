@@ -126,6 +126,7 @@ namespace Marvel {
         virtual void handleSpecificPositionalArgs(PyObject* args)  {}
         virtual void handleSpecificKeywordArgs   (PyObject* dict)  {} // called by handleKeywordArgs
         virtual void getSpecificConfiguration    (PyObject* dict)  {}
+        virtual void getSpecificInfo             (PyObject* dict)  {} // read only state for get_item_info
         virtual void applySpecificTemplate       (mvAppItem* item) {}
 
         //-----------------------------------------------------------------------------
@@ -135,6 +136,7 @@ namespace Marvel {
         virtual void onChildAdd    (mvRef<mvAppItem> item) {}
         virtual void onChildRemoved(mvRef<mvAppItem> item) {}
         virtual void onChildrenRemoved() {}
+        virtual void onChildrenReordered() {} // move_item_up/down, reorder_items
         virtual void onBind(mvAppItem* item) {}
 
         //-----------------------------------------------------------------------------
@@ -221,8 +223,7 @@ namespace Marvel {
         PyObject*   _user_data = nullptr;
         b8          _tracked = false;
         f32         _trackOffset = 0.5f; // 0.0f:top, 0.5f:center, 1.0f:bottom
-        b8          _searchLast = false;
-        b8          _searchDelayed = false;
+        b8          _searchLast = false; // delay_search, kept for compatibility (lookups use the registry index)
         b8          _useInternalLabel = true; // when false, will use specificed label
         std::string _alias;
 
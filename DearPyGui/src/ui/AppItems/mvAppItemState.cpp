@@ -24,22 +24,27 @@ namespace Marvel {
         state.mvRectSizeResized = false;
     }
 
+    mv_internal constexpr i32 StateRequestFrames = 60; // frames an item keeps capturing after a query
+
+    mv_internal b8
+    IsAppItemStateDemanded(mvAppItemState& state)
+    {
+        if (!GContext->IO.lazyItemState || state.parent == nullptr)
+            return true;
+        return state.parent->_handlerRegistry != nullptr || GContext->frame - state.lastRequested <= StateRequestFrames;
+    }
+
+    void
+    RequestAppItemState(mvAppItemState& state)
+    {
+        state.lastRequested = GContext->frame;
+    }
+
     void
     UpdateAppItemState(mvAppItemState& state)
     {
         state.lastFrameUpdate = GContext->frame;
-        state.hovered = ImGui::IsItemHovered();
-        state.active = ImGui::IsItemActive();
-        state.focused = ImGui::IsItemFocused();
-        state.leftclicked = ImGui::IsItemClicked();
-        state.rightclicked = ImGui::IsItemClicked(1);
-        state.middleclicked = ImGui::IsItemClicked(2);
         state.visible = ImGui::IsItemVisible();
-        state.edited = ImGui::IsItemEdited();
-        state.activated = ImGui::IsItemActivated();
-        state.deactivated = ImGui::IsItemDeactivated();
-        state.deactivatedAfterEdit = ImGui::IsItemDeactivatedAfterEdit();
-        state.toggledOpen = ImGui::IsItemToggledOpen();
         state.rectMin = { ImGui::GetItemRectMin().x, ImGui::GetItemRectMin().y };
         state.rectMax = { ImGui::GetItemRectMax().x, ImGui::GetItemRectMax().y };
         state.rectSize = { ImGui::GetItemRectSize().x, ImGui::GetItemRectSize().y };
@@ -48,6 +53,38 @@ namespace Marvel {
         if (state.mvPrevRectSize.x != state.rectSize.x || state.mvPrevRectSize.y != state.rectSize.y) { state.mvRectSizeResized = true; }
         else state.mvRectSizeResized = false;
         state.mvPrevRectSize = state.rectSize;
+
+        // interaction queries only for items with handlers or queried lately,
+        // and only the ones applicable to the item type
+        if (!IsAppItemStateDemanded(state))
+        {
+            state.hovered = false;
+            state.active = false;
+            state.focused = false;
+            state.leftclicked = false;
+            state.rightclicked = false;
+            state.middleclicked = false;
+            state.edited = false;
+            state.activated = false;
+            state.deactivated = false;
+            state.deactivatedAfterEdit = false;
+            state.toggledOpen = false;
+            return;
+        }
+
+        i32 applicable = state.parent ? GetApplicableState(state.parent->_type) : MV_STATE_ALL;
+        b8 clickable = applicable & MV_STATE_CLICKED;
+        state.hovered = (applicable & MV_STATE_HOVER) && ImGui::IsItemHovered();
+        state.active = (applicable & MV_STATE_ACTIVE) && ImGui::IsItemActive();
+        state.focused = (applicable & MV_STATE_FOCUSED) && ImGui::IsItemFocused();
+        state.leftclicked = clickable && ImGui::IsItemClicked();
+        state.rightclicked = clickable && ImGui::IsItemClicked(1);
+        state.middleclicked = clickable && ImGui::IsItemClicked(2);
+        state.edited = (applicable & MV_STATE_EDITED) && ImGui::IsItemEdited();
+        state.activated = (applicable & MV_STATE_ACTIVATED) && ImGui::IsItemActivated();
+        state.deactivated = (applicable & MV_STATE_DEACTIVATED) && ImGui::IsItemDeactivated();
+        state.deactivatedAfterEdit = (applicable & MV_STATE_DEACTIVATEDAE) && ImGui::IsItemDeactivatedAfterEdit();
+        state.toggledOpen = (applicable & MV_STATE_TOGGLED_OPEN) && ImGui::IsItemToggledOpen();
     }
 
     void 
@@ -43,6 +43,7 @@ namespace Marvel {
     void FillAppItemState  (PyObject* dict, mvAppItemState& state, i32 applicableState); // fills python dict with applicable state values
     void ResetAppItemState (mvAppItemState& state);                                      // reset values to false
     void UpdateAppItemState(mvAppItemState& state);                                      // standard imgui update
+    void RequestAppItemState(mvAppItemState& state);                                     // keeps interaction state captured for a while
 
     // return actual value if frame is active
     b8 IsItemHovered             (mvAppItemState& state, i32 frameDelay = 0);
@@ -82,6 +83,7 @@ namespace Marvel {
         mvVec2     contextRegionAvail   = { 0.0f, 0.0f };
         b8         ok                   = true;
         i32        lastFrameUpdate      = 0; // last frame update occured
+        i32        lastRequested        = 0; // last frame the state was queried
         mvAppItem* parent               = nullptr; // hacky, but quick fix for widget handlers
     };
 
@@ -14,18 +14,6 @@
 
 namespace Marvel {
 
-    mvItemRegistry::mvItemRegistry()
-    {
-        // prefill cached containers
-        for (i32 i = 0; i < CachedContainerCount; i++)
-        {
-            cachedContainersID[i] = 0;
-            cachedContainersPTR[i] = nullptr;
-            cachedItemsID[i] = 0;
-            cachedItemsPTR[i] = nullptr;
-        }
-    }
-
     mv_internal b8
     DoesAliasExist(mvItemRegistry& registry, const std::string& alias)
     {
@@ -56,22 +44,32 @@ namespace Marvel {
     }
 
     mv_internal void
-    CacheItem(mvItemRegistry& registry, mvAppItem* item)
+    IndexItem(mvItemRegistry& registry, mvAppItem* item)
     {
-        if (GetEntityDesciptionFlags(item->_type) & MV_ITEM_DESC_CONTAINER)
+        registry.itemIndex[item->_uuid] = item;
+
+        for (auto& childset : item->_children)
         {
-            registry.cachedContainersID[registry.cachedContainerIndex] = item->_uuid;
-            registry.cachedContainersPTR[registry.cachedContainerIndex] = item;
-            registry.cachedContainerIndex++;
-            if (registry.cachedContainerIndex == registry.CachedContainerCount)
-                registry.cachedContainerIndex = 0;
+            for (auto& child : childset)
+                IndexItem(registry, child.get());
         }
+    }
 
-        registry.cachedItemsID[registry.cachedItemsIndex] = item->_uuid;
-        registry.cachedItemsPTR[registry.cachedItemsIndex] = item;
-        registry.cachedItemsIndex++;
-        if (registry.cachedItemsIndex == registry.CachedContainerCount)
-            registry.cachedItemsIndex = 0;
+    mv_internal void
+    UnindexItem(mvItemRegistry& registry, mvAppItem* item)
+    {
+        registry.itemIndex.erase(item->_uuid);
+
+        // children that were re-parented elsewhere (i.e. unstaged items)
+        // are still shared with this item but are no longer owned by it
+        for (auto& childset : item->_children)
+        {
+            for (auto& child : childset)
+            {
+                if (child->_parentPtr == item)
+                    UnindexItem(registry, child.get());
+            }
+        }
     }
 
     mv_internal b8
@@ -263,29 +261,6 @@ namespace Marvel {
         return true;
     }
 
-    mv_internal mvAppItem*
-    GetItemRoot(mvItemRegistry& registry, std::vector<mvRef<mvAppItem>>& roots, mvUUID uuid)
-    {
-        for (auto& root : roots)
-        {
-            if (root->_uuid == uuid)
-            {
-                CacheItem(registry, root.get());
-                return root.get();
-            }
-
-            mvAppItem* child = root->getChild(uuid);
-            if (child)
-            {
-                CacheItem(registry, child);
-                registry.delayedSearch.clear();
-                return child;
-            }
-        }
-
-        return nullptr;
-    }
-
     mv_internal mvRef<mvAppItem>
     GetRefItemRoot(std::vector<mvRef<mvAppItem>>& roots, mvUUID uuid)
     {
@@ -372,8 +347,6 @@ namespace Marvel {
 
         MV_ITEM_REGISTRY_TRACE("Attempting to delete: " + std::to_string(uuid));
 
-        CleanUpItem(registry, uuid);
-
         // delete item's children only
         if(childrenOnly)
         {
@@ -382,6 +355,11 @@ namespace Marvel {
             {
                 if (slot > -1 && slot < 4)
                 {
+                    for (auto& child : item->_children[slot])
+                    {
+                        if (child->_parentPtr == item)
+                            UnindexItem(registry, child.get());
+                    }
                     item->_children[slot].clear();
                     item->_children[slot].shrink_to_fit();
                 }
@@ -389,6 +367,11 @@ namespace Marvel {
                 {
                     for(size_t i = 0; i < 4; i++)
                     {
+                        for (auto& child : item->_children[i])
+                        {
+                            if (child->_parentPtr == item)
+                                UnindexItem(registry, child.get());
+                        }
                         item->_children[i].clear();
                         item->_children[i].shrink_to_fit();
                     }
@@ -400,6 +383,12 @@ namespace Marvel {
             }
         }
 
+        // items may outlive their removal (i.e. bound themes/fonts)
+        // so the index can't rely on destructors alone
+        if (mvAppItem* item = GetItem(registry, uuid))
+            UnindexItem(registry, item);
+        CleanUpItem(registry, uuid);
+
         bool deletedItem = false;
 
         if (DeleteRoot(registry.colormapRoots, uuid)) deletedItem = true;
@@ -476,7 +465,12 @@ namespace Marvel {
         }
 
         if (child)
-            AddRuntimeItem(registry, parent, before, child);
+        {
+            if (AddRuntimeItem(registry, parent, before, child))
+                IndexItem(registry, child.get());
+            else
+                UnindexItem(registry, child.get());
+        }
 
         return movedItem;
     }
@@ -553,12 +547,6 @@ namespace Marvel {
     RenderItemRegistry(mvItemRegistry& registry)
     {
 
-        // TODO: figure out why delayedSearch can
-        //       still have values (sometimes).
-        //       It should be empty after every search.
-        if(!registry.delayedSearch.empty())
-            registry.delayedSearch.clear();
-
         MV_PROFILE_SCOPE("Rendering")
 
         if(registry.showImGuiDebug)
@@ -599,6 +587,9 @@ namespace Marvel {
             mvToolManager::GetFontManager()._newDefault = false;
         }
 
+        if (!registry.handlerRegistryRoots.empty())
+            UpdateInputDelta();
+
         for (auto& root : registry.handlerRegistryRoots)
         {
             if (root->_show)
@@ -689,6 +680,7 @@ namespace Marvel {
             DebugItem("Handlers Bound:", root->_handlerRegistry ? ts : fs);
 
             i32 applicableState = GetApplicableState(root->_type);
+            RequestAppItemState(root->_state);
             ImGui::Spacing();
             ImGui::Spacing();
             ImGui::Spacing();
@@ -729,12 +721,6 @@ namespace Marvel {
             root->_show = false;
     }
 
-    void 
-    DelaySearch(mvItemRegistry& registry, mvAppItem* item)
-    {
-        registry.delayedSearch.push_back(item);
-    }
-
     mvAppItem* 
     GetItem(mvItemRegistry& registry, mvUUID uuid)
     {
@@ -746,42 +732,9 @@ namespace Marvel {
                 return registry.capturedItem.get();
         }
 
-        // check cache
-        for (i32 i = 0; i < registry.CachedContainerCount; i++)
-        {
-            if (registry.cachedContainersID[i] == uuid)
-                return registry.cachedContainersPTR[i];
-            if (registry.cachedItemsID[i] == uuid)
-                return registry.cachedItemsPTR[i];
-        }
-
-        if (auto foundItem = GetItemRoot(registry, registry.colormapRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.colormapRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.filedialogRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.stagingRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.viewportMenubarRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.fontRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.handlerRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.textureRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.valueRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.windowRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.themeRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.itemTemplatesRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.itemHandlerRegistryRoots, uuid)) return foundItem;
-        if (auto foundItem = GetItemRoot(registry, registry.viewportDrawlistRoots, uuid)) return foundItem;
-
-        for (auto delayedItem : registry.delayedSearch)
-        {
-            mvAppItem* child = delayedItem->getChild(uuid);
-            if (child)
-            {
-                CacheItem(registry, child);
-                registry.delayedSearch.clear();
-                return child;
-            }
-        }
-
-        registry.delayedSearch.clear();
+        auto foundItem = registry.itemIndex.find(uuid);
+        if (foundItem != registry.itemIndex.end())
+            return foundItem->second;
 
         return nullptr;
     }
@@ -796,6 +749,24 @@ namespace Marvel {
             if(registry.capturedItem->_uuid == uuid)
                 return registry.capturedItem;
         }
+
+        mvAppItem* item = GetItem(registry, uuid);
+        if (item == nullptr)
+            return nullptr;
+
+        // owning reference lives in the parent's slot
+        if (mvAppItem* parent = item->_parentPtr)
+        {
+            auto& childset = parent->_children[GetEntityTargetSlot(item->_type)];
+            if (item->_location > -1 && item->_location < (i32)childset.size() && childset[item->_location].get() == item)
+                return childset[item->_location];
+
+            for (auto& child : childset)
+            {
+                if (child.get() == item)
+                    return child;
+            }
+        }
         
         if (auto foundItem = GetRefItemRoot(registry.colormapRoots, uuid)) return foundItem;
         else if (auto foundItem = GetRefItemRoot(registry.filedialogRoots, uuid)) return foundItem;
@@ -849,25 +820,13 @@ namespace Marvel {
         registry.itemTemplatesRoots.clear();
         registry.itemHandlerRegistryRoots.clear();
         registry.viewportDrawlistRoots.clear();
+        registry.itemIndex.clear();
     }
 
     void 
     CleanUpItem(mvItemRegistry& registry, mvUUID uuid)
     {
-        for (i32 i = 0; i < registry.CachedContainerCount; i++)
-        {
-            if (registry.cachedContainersID[i] == uuid)
-            {
-                registry.cachedContainersID[i] = 0;
-                registry.cachedContainersPTR[i] = nullptr;
-            }
-
-            if (registry.cachedItemsID[i] == uuid)
-            {
-                registry.cachedItemsID[i] = 0;
-                registry.cachedItemsPTR[i] = nullptr;
-            }
-        }
+        registry.itemIndex.erase(uuid);
     }
 
     b8
@@ -908,8 +867,6 @@ namespace Marvel {
 
         registry.lastItemAdded = item->_uuid;
 
-        CacheItem(registry, item.get());
-
         //---------------------------------------------------------------------------
         // STEP 1: check if an item with this name exists (NO LONGER NEEDED)
         //---------------------------------------------------------------------------
@@ -927,20 +884,15 @@ namespace Marvel {
         };
         AddTechnique technique = AddTechnique::NONE;
 
-        if (!GContext->manualMutexControl) std::lock_guard<std::mutex> lk(GContext->mutex);
-
         //---------------------------------------------------------------------------
         // STEP 2: handle root case
         //---------------------------------------------------------------------------
         if (GetEntityDesciptionFlags(item->_type) & MV_ITEM_DESC_ROOT)
         {
 
-            if (GContext->started)
-            {
-                AddRoot(registry, item);
-                return true;
-            }
-            return AddRoot(registry, item);
+            AddRoot(registry, item);
+            IndexItem(registry, item.get());
+            return true;
         }
 
         //---------------------------------------------------------------------------
@@ -1073,21 +1025,30 @@ namespace Marvel {
         //---------------------------------------------------------------------------
         // STEP 7: add items who require "after" adding (tooltip)
         //---------------------------------------------------------------------------
+        b8 added = false;
         if (item->_type == mvAppItemType::mvTooltip)
-            return AddItemAfter(registry, parent, item);
+            added = AddItemAfter(registry, parent, item);
 
         //---------------------------------------------------------------------------
         // STEP 8: handle "before" and "after" style adding
         //---------------------------------------------------------------------------
-        if (technique == AddTechnique::BEFORE || technique == AddTechnique::PARENT)
-            return parentPtr->addRuntimeChild(parent, before, item); // same for run/compile time
+        else if (technique == AddTechnique::BEFORE || technique == AddTechnique::PARENT)
+            added = parentPtr->addRuntimeChild(parent, before, item); // same for run/compile time
 
         //---------------------------------------------------------------------------
         // STEP 9: handle "stack" style adding
         //---------------------------------------------------------------------------
-        if(GContext->started)
-            return parentPtr->addRuntimeChild(parentPtr->_uuid, 0, item);
-        return AddItem(registry, item);
+        else if(GContext->started)
+            added = parentPtr->addRuntimeChild(parentPtr->_uuid, 0, item);
+        else
+            added = AddItem(registry, item);
+
+        //---------------------------------------------------------------------------
+        // STEP 10: make item available for lookups
+        //---------------------------------------------------------------------------
+        if (added)
+            IndexItem(registry, item.get());
+        return added;
     }
 
     void 
@@ -48,7 +48,6 @@ namespace Marvel {
     mvAppItem*       GetItemRoot    (mvItemRegistry& registry, mvUUID uuid);
 
     // item operations
-    void             DelaySearch             (mvItemRegistry& registry, mvAppItem* item);
     b8               AddItemWithRuntimeChecks(mvItemRegistry& registry, mvRef<mvAppItem> item, mvUUID parent, mvUUID before);
     void             ResetTheme              (mvItemRegistry& registry);
 
@@ -59,32 +58,26 @@ namespace Marvel {
     //         * keeping up with the active window 
     //         * managing the parent deduction system (parent stack) 
     //         * acts as the interface for accessing widgets
+    //         * maintains the uuid -> item index used for lookups
     //         * creates the "standard" windows on startup (debug, about, etc.)
     //-----------------------------------------------------------------------------
 
-
-
     struct mvItemRegistry
     {
 
-        static constexpr i32 CachedContainerCount = 25;
-
         // caching
         mvUUID     lastItemAdded = 0;
         mvUUID     lastContainerAdded = 0;
         mvUUID     lastRootAdded = 0;
-        i32        cachedContainerIndex = 0;
-        i32        cachedItemsIndex = 0;
-        mvUUID     cachedItemsID[CachedContainerCount];
-        mvAppItem* cachedItemsPTR[CachedContainerCount];
-        mvUUID     cachedContainersID[CachedContainerCount];
-        mvAppItem* cachedContainersPTR[CachedContainerCount];
+
+        // every item currently attached to a root (must be declared
+        // before the roots so it outlives their destructors)
+        std::unordered_map<mvUUID, mvAppItem*> itemIndex;
 
         // misc
         std::stack<mvAppItem*>                  containers;      // parent stack, top of stack becomes widget's parent
         std::unordered_map<std::string, mvUUID> aliases;
         mvUUID                                  activeWindow = 0;
-        std::vector<mvAppItem*>                 delayedSearch;
         b8                                      showImGuiDebug = false;
         b8                                      showImPlotDebug = false;
         mvRef<mvAppItem>                        boundedTemplateRegistry;
@@ -106,8 +99,6 @@ namespace Marvel {
         std::vector<mvRef<mvAppItem>> themeRegistryRoots;
         std::vector<mvRef<mvAppItem>> itemTemplatesRoots;
         std::vector<mvRef<mvAppItem>> viewportDrawlistRoots;
-
-        mvItemRegistry();
     };
 
 }
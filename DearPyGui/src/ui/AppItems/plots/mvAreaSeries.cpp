@@ -10,22 +10,43 @@
 
 namespace Marvel {
 
-	void mvAreaSeries::drawPolygon()
+	void mvAreaSeries::drawPolygon(i32 first, i32 count)
 	{
 
-		static const std::vector<double>* xptr;
-		static const std::vector<double>* yptr;
-
-		xptr = &(*_value.get())[0];
-		yptr = &(*_value.get())[1];
-
 		std::vector<ImVec2> points;
-		for (unsigned i = 0; i < xptr->size(); i++)
+		if (_decimation.active)
 		{
-			auto p = ImPlot::PlotToPixels({ (*xptr)[i], (*yptr)[i] });
-			points.push_back(p);
+			// fill the same (downsampled) outline that was drawn
+			const auto& values = _decimation.values;
+			for (size_t i = 0; i < values[0].size(); i++)
+				points.push_back(ImPlot::PlotToPixels({ values[0][i], values[1][i] }));
+		}
+		else if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+		{
+			for (i32 i = first; i < first + count; i++)
+			{
+				auto p = ImPlot::PlotToPixels({ GetSeriesBufferValue(_buffers[0], i), GetSeriesBufferValue(_buffers[1], i) });
+				points.push_back(p);
+			}
+		}
+		else
+		{
+			static const std::vector<double>* xptr;
+			static const std::vector<double>* yptr;
+
+			xptr = &(*_value.get())[0];
+			yptr = &(*_value.get())[1];
+
+			for (i32 i = first; i < first + count; i++)
+			{
+				auto p = ImPlot::PlotToPixels({ (*xptr)[i], (*yptr)[i] });
+				points.push_back(p);
+			}
 		}
 
+		if (points.empty())
+			return;
+
 		if (_fill.r > 0.0f)
 		{
 			size_t i;
@@ -115,14 +136,21 @@ namespace Marvel {
 	{
 	}
 
+	mvAreaSeries::~mvAreaSeries()
+	{
+		ReleaseSeriesBuffers(_buffers, 2);
+	}
+
 	PyObject* mvAreaSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 2);
 	}
 
 	void mvAreaSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 2, value);
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvAreaSeries::setDataSource(mvUUID dataSource)
@@ -144,6 +172,8 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvAreaSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -178,17 +208,40 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* yptr;
+			mvSeriesChannel channels[] = { GetSeriesChannel(_buffers[0], (*_value)[0]), GetSeriesChannel(_buffers[1], (*_value)[1]) };
 
-			xptr = &(*_value.get())[0];
-			yptr = &(*_value.get())[1];
+			// sorted x only needs the visible range
+			i32 first = 0;
+			i32 visible = std::min(channels[0].count, channels[1].count);
+			if (IsSeriesSorted(_order, channels[0]))
+				GetVisibleRange(channels[0], first, visible);
+
+			if (DecimateSeries(_decimation, _downsample, channels, 2, first, visible))
+			{
+				const auto& values = _decimation.values;
+				ImPlot::PlotLine(_internalLabel.c_str(), values[0].data(), values[1].data(), (int)values[0].size());
+			}
+			else if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+					{
+						ImPlot::PlotLine(_internalLabel.c_str(), xs, ys, count, 0, stride);
+					}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible));
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* yptr;
 
-			ImPlot::PlotLine(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+				xptr = &(*_value.get())[0];
+				yptr = &(*_value.get())[1];
+
+				ImPlot::PlotLine(_internalLabel.c_str(), xptr->data() + first, yptr->data() + first, visible);
+			}
 
 			ImPlot::PushPlotClipRect();
 			ImPlot::RegisterOrGetItem(_internalLabel.c_str());
-			drawPolygon();
+			drawPolygon(first, visible);
 			ImPlot::PopPlotClipRect();
 
 			// Begin a popup for a legend entry.
@@ -247,11 +300,11 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
 				break;
 
 			default:
@@ -267,9 +320,16 @@ namespace Marvel {
 
 		if (PyObject* item = PyDict_GetItemString(dict, "fill")) _fill = ToColor(item);
 
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y")) { (*_value)[1] = ToDoubleVect(item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sorted_x")) _order.hint = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "downsample")) _downsample = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y")) { SetSeriesChannel(_buffers[1], (*_value)[1], item); }
 
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, 2);
+
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvAreaSeries::getSpecificConfiguration(PyObject* dict)
@@ -277,6 +337,10 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+		PyDict_SetItemString(dict, "sorted_x", mvPyObject(ToPyBool(_order.hint)));
+		PyDict_SetItemString(dict, "downsample", mvPyObject(ToPyInt(_downsample)));
+
 		mvPyObject py_fill = ToPyColor(_fill);
 
 		PyDict_SetItemString(dict, "fill", py_fill);
@@ -287,6 +351,9 @@ namespace Marvel {
 	{
 		auto titem = static_cast<mvAreaSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
+		_order.hint = titem->_order.hint;
+		_downsample = titem->_downsample;
 		_fill = titem->_fill;
 	}
 
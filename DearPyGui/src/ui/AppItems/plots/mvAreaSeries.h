@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
 
 namespace Marvel {
 
@@ -10,6 +12,7 @@ namespace Marvel {
     public:
 
         explicit mvAreaSeries(mvUUID uuid);
+        ~mvAreaSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
@@ -25,7 +28,7 @@ namespace Marvel {
 
     private:
 
-        void drawPolygon();
+        void drawPolygon(i32 first, i32 count);
 
     private:
 
@@ -36,6 +39,12 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{},
             std::vector<double>{} });
+
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+        i32            _downsample = mvPlotDownsample_None;
+        mvSeriesDecimation _decimation; // cached downsampled data
+        mvSeriesOrder  _order;
     };
 
 }
@@ -16,14 +16,19 @@ namespace Marvel {
 	{
 	}
 
+	mvBarSeries::~mvBarSeries()
+	{
+		ReleaseSeriesBuffers(_buffers, 2);
+	}
+
 	PyObject* mvBarSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 2);
 	}
 
 	void mvBarSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 2, value);
 	}
 
 	void mvBarSeries::setDataSource(mvUUID dataSource)
@@ -79,16 +84,29 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* yptr;
+			if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+					{
+						if (_horizontal)
+							ImPlot::PlotBarsH(_internalLabel.c_str(), xs, ys, count, _weight, 0, stride);
+						else
+							ImPlot::PlotBars(_internalLabel.c_str(), xs, ys, count, _weight, 0, stride);
+					}, _buffers[0], _buffers[1]);
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* yptr;
 
-			xptr = &(*_value.get())[0];
-			yptr = &(*_value.get())[1];
+				xptr = &(*_value.get())[0];
+				yptr = &(*_value.get())[1];
 
-			if (_horizontal)
-				ImPlot::PlotBarsH(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _weight);
-			else
-				ImPlot::PlotBars(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _weight);
+				if (_horizontal)
+					ImPlot::PlotBarsH(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _weight);
+				else
+					ImPlot::PlotBars(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _weight);
+			}
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -145,11 +163,11 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
 				break;
 
 			default:
@@ -166,8 +184,11 @@ namespace Marvel {
 		if (PyObject* item = PyDict_GetItemString(dict, "horizontal")) _horizontal= ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(dict, "weight")) _weight= ToFloat(item);
 
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y")) { (*_value)[1] = ToDoubleVect(item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y")) { SetSeriesChannel(_buffers[1], (*_value)[1], item); }
+
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, 2);
 
 	}
 
@@ -176,6 +197,8 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+
 		mvPyObject py_horizontal = ToPyBool(_horizontal);
 		mvPyObject py_weight = ToPyFloat(_weight);
 
@@ -187,6 +210,7 @@ namespace Marvel {
 	{
 		auto titem = static_cast<mvBarSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
 		_horizontal = titem->_horizontal;
 		_weight = titem->_weight;
 	}
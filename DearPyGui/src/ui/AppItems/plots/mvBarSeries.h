@@ -1,6 +1,7 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
 
 namespace Marvel {
 
@@ -10,6 +11,7 @@ namespace Marvel {
     public:
 
         explicit mvBarSeries(mvUUID uuid);
+        ~mvBarSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
@@ -34,6 +36,9 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+
     };
 
 }
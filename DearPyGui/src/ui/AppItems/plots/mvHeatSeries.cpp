@@ -1,4 +1,5 @@
 #include <utility>
+#include <algorithm>
 #include "mvHeatSeries.h"
 #include "mvCore.h"
 #include "mvContext.h"
@@ -8,14 +9,44 @@
 #include "AppItems/themes/mvTheme.h"
 #include "AppItems/containers/mvDragPayload.h"
 #include "mvPyObject.h"
+#include "mvUtilities.h"
+#include "mvThreadPool.h"
+#include <implot_internal.h>
 
 namespace Marvel {
 
+	mv_internal void
+	ColorizeHeatmapRows(const double* values, i32 cols, i32 firstRow, i32 lastRow, double scaleMin, double scaleMax,
+		const std::vector<f32>& table, b8 qualitative, f32* texels)
+	{
+		// same lookup as ImPlot's heatmap (ImPlotColormapData::LerpTable)
+		const i32 size = (i32)table.size() / 4;
+		const double scale = scaleMax != scaleMin ? 1.0 / (scaleMax - scaleMin) : 0.0;
+		for (size_t i = (size_t)firstRow * cols; i < (size_t)lastRow * cols; i++)
+		{
+			f32 t = (f32)((values[i] - scaleMin) * scale);
+			t = t > 0.0f ? (t < 1.0f ? t : 1.0f) : 0.0f; // nan to 0
+			i32 index = qualitative ? ImClamp((i32)(size * t), 0, size - 1) : (i32)((size - 1) * t + 0.5f);
+			const f32* color = &table[(size_t)index * 4];
+			f32* texel = &texels[i * 4];
+			texel[0] = color[0];
+			texel[1] = color[1];
+			texel[2] = color[2];
+			texel[3] = color[3];
+		}
+	}
+
 	mvHeatSeries::mvHeatSeries(mvUUID uuid)
 		: mvAppItem(uuid)
 	{
 	}
 
+	mvHeatSeries::~mvHeatSeries()
+	{
+		if (_texture)
+			FreeTexture(_texture);
+	}
+
 	PyObject* mvHeatSeries::getPyValue()
 	{
 		return ToPyList(*_value);
@@ -24,6 +55,7 @@ namespace Marvel {
 	void mvHeatSeries::setPyValue(PyObject* value)
 	{
 		*_value = ToVectVectDouble(value);
+		_textureDirty = true;
 	}
 
 	void mvHeatSeries::setDataSource(mvUUID dataSource)
@@ -45,6 +77,89 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_textureDirty = true;
+	}
+
+	void mvHeatSeries::updateTexture(ImPlotColormap colormap)
+	{
+		const std::vector<double>& values = (*_value)[0];
+		const i32 cells = _rows * _cols;
+
+		// auto scaling and single color cases follow ImPlot's RenderHeatmap
+		double scaleMin = _scale_min;
+		double scaleMax = _scale_max;
+		if (scaleMin == 0.0 && scaleMax == 0.0 && cells > 0)
+		{
+			const auto range = std::minmax_element(values.begin(), values.begin() + cells);
+			scaleMin = *range.first;
+			scaleMax = *range.second;
+		}
+
+		std::vector<f32> table;
+		b8 qualitative = true;
+		if (scaleMin == scaleMax)
+		{
+			ImVec4 color = ImGui::ColorConvertU32ToFloat4(ImPlot::GetColormapColorU32(0, colormap));
+			table = { color.x, color.y, color.z, color.w };
+		}
+		else
+		{
+			const ImPlotColormapData& data = GImPlot->ColormapData;
+			qualitative = data.IsQual(colormap);
+			table.reserve((size_t)data.GetTableSize(colormap) * 4);
+			for (i32 i = 0; i < data.GetTableSize(colormap); i++)
+			{
+				ImVec4 color = ImGui::ColorConvertU32ToFloat4(data.GetTableColor(colormap, i));
+				table.insert(table.end(), { color.x, color.y, color.z, color.w });
+			}
+		}
+
+		_texels.resize((size_t)cells * 4);
+
+		// large matrices are split into row bands across the idle workers of
+		// the thread pool, the rest run here so the render thread never waits
+		// behind long jobs (pyramid builds)
+		const i32 bandRows = std::max(1, (1 << 16) / std::max(_cols, 1));
+		if (_rows <= bandRows)
+			ColorizeHeatmapRows(values.data(), _cols, 0, _rows, scaleMin, scaleMax, table, qualitative, _texels.data());
+		else
+		{
+			mvThreadPool& pool = GetThreadPool();
+			const size_t idle = pool.getIdleCount();
+			std::vector<std::future<void>> bands;
+			for (i32 row = 0; row < _rows; row += bandRows)
+			{
+				i32 lastRow = std::min(row + bandRows, _rows);
+				if (bands.size() < idle)
+				{
+					bands.push_back(pool.submit([&, row, lastRow]()
+						{
+							ColorizeHeatmapRows(values.data(), _cols, row, lastRow, scaleMin, scaleMax, table, qualitative, _texels.data());
+						}));
+				}
+				else
+					ColorizeHeatmapRows(values.data(), _cols, row, lastRow, scaleMin, scaleMax, table, qualitative, _texels.data());
+			}
+			for (auto& band : bands)
+				band.wait();
+		}
+
+		if (_texture == nullptr || _textureWidth != _cols || _textureHeight != _rows)
+		{
+			if (_texture)
+				FreeTexture(_texture);
+			_texture = LoadTextureFromArrayDynamic(_cols, _rows, _texels.data());
+			_textureWidth = _cols;
+			_textureHeight = _rows;
+		}
+		else
+			UpdateTexture(_texture, _cols, _rows, _texels.data());
+		GContext->textureBytes += (u64)_texels.size() * sizeof(float);
+
+		_textureDirty = false;
+		_textureColormap = colormap;
+		_textureScaleMin = _scale_min;
+		_textureScaleMax = _scale_max;
 	}
 
 	void mvHeatSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -83,9 +198,22 @@ namespace Marvel {
 
 			xptr = &(*_value.get())[0];
 
+			if (_useTexture)
+			{
+				// a source can change the data without telling this series
+				ImPlotColormap colormap = ImPlot::GetStyle().Colormap;
+				b8 changed = _textureDirty || _source != 0 || _textureColormap != colormap
+					|| _textureScaleMin != _scale_min || _textureScaleMax != _scale_max;
+
+				if (changed && _rows > 0 && _cols > 0 && xptr->size() >= (size_t)_rows * _cols)
+					updateTexture(colormap);
 
-			ImPlot::PlotHeatmap(_internalLabel.c_str(), xptr->data(), _rows, _cols, _scale_min, _scale_max,
-				_format.c_str(), { _bounds_min.x, _bounds_min.y }, { _bounds_max.x, _bounds_max.y });
+				if (_texture)
+					ImPlot::PlotImage(_internalLabel.c_str(), _texture, { _bounds_min.x, _bounds_min.y }, { _bounds_max.x, _bounds_max.y });
+			}
+			else
+				ImPlot::PlotHeatmap(_internalLabel.c_str(), xptr->data(), _rows, _cols, _scale_min, _scale_max,
+					_format.c_str(), { _bounds_min.x, _bounds_min.y }, { _bounds_max.x, _bounds_max.y });
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -175,6 +303,7 @@ namespace Marvel {
 		if (PyObject* item = PyDict_GetItemString(dict, "bounds_max")) _bounds_max = ToPoint(item);
 		if (PyObject* item = PyDict_GetItemString(dict, "scale_min")) _scale_min = ToDouble(item);
 		if (PyObject* item = PyDict_GetItemString(dict, "scale_max")) _scale_max = ToDouble(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "use_texture")) _useTexture = ToBool(item);
 
 		bool valueChanged = false;
 		if (PyObject* item = PyDict_GetItemString(dict, "x")) { valueChanged = true; (*_value)[0] = ToDoubleVect(item); }
@@ -185,6 +314,8 @@ namespace Marvel {
 			(*_value)[1].push_back(_bounds_max.y);
 		}
 
+		_textureDirty = true;
+
 	}
 
 	void mvHeatSeries::getSpecificConfiguration(PyObject* dict)
@@ -207,6 +338,7 @@ namespace Marvel {
 		PyDict_SetItemString(dict, "bounds_max", py_bounds_max);
 		PyDict_SetItemString(dict, "scale_min", py_scale_min);
 		PyDict_SetItemString(dict, "scale_max", py_scale_max);
+		PyDict_SetItemString(dict, "use_texture", mvPyObject(ToPyBool(_useTexture)));
 	}
 
 	void mvHeatSeries::applySpecificTemplate(mvAppItem* item)
@@ -220,5 +352,6 @@ namespace Marvel {
 		_format = titem->_format;
 		_bounds_min = titem->_bounds_min;
 		_bounds_max = titem->_bounds_max;
+		_useTexture = titem->_useTexture;
 	}
 }
\ No newline at end of file
@@ -10,6 +10,7 @@ namespace Marvel {
     public:
 
         explicit mvHeatSeries(mvUUID uuid);
+        ~mvHeatSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
@@ -23,6 +24,15 @@ namespace Marvel {
         PyObject* getPyValue() override;
         void setPyValue(PyObject* value) override;
 
+        // use_texture image, float rgba (get_texture_pixels)
+        void* getRawTexture() const { return _texture; }
+        i32   getTextureWidth() const { return _textureWidth; }
+        i32   getTextureHeight() const { return _textureHeight; }
+
+    private:
+
+        void updateTexture(ImPlotColormap colormap);
+
     private:
 
         int         _rows = 1;
@@ -39,6 +49,18 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        // use_texture: the matrix is colorized into a texture when the data,
+        // scale or colormap change and drawn as a single image
+        b8               _useTexture = false;
+        b8               _textureDirty = true;
+        void*            _texture = nullptr;
+        i32              _textureWidth = 0;
+        i32              _textureHeight = 0;
+        ImPlotColormap   _textureColormap = -1;
+        double           _textureScaleMin = 0.0;
+        double           _textureScaleMax = 0.0;
+        std::vector<f32> _texels;         // RGBA, reused between updates
+
     };
 
 }
@@ -7,6 +7,8 @@
 #include "AppItems/fonts/mvFont.h"
 #include "AppItems/themes/mvTheme.h"
 #include "AppItems/containers/mvDragPayload.h"
+#include "AppItems/textures/mvTextureRegions.h"
+#include "AppItems/textures/mvTextureAtlas.h"
 #include "mvPyObject.h"
 
 namespace Marvel {
@@ -96,7 +98,13 @@ namespace Marvel {
 				else
 					texture = static_cast<mvDynamicTexture*>(_texture.get())->getRawTexture();
 
-				ImPlot::PlotImage(_internalLabel.c_str(), texture, _bounds_min, _bounds_max, _uv_min, _uv_max, _tintColor);
+				// rows pushed to the texture wrap around, starting at its cursor,
+				// atlas textures are a rect of their page
+				f32 scroll = GetTextureScroll(_texture.get());
+				mvVec2 uv_min = GetAtlasUV(_texture.get(), { _uv_min.x, _uv_min.y + scroll });
+				mvVec2 uv_max = GetAtlasUV(_texture.get(), { _uv_max.x, _uv_max.y + scroll });
+
+				ImPlot::PlotImage(_internalLabel.c_str(), texture, _bounds_min, _bounds_max, uv_min, uv_max, _tintColor);
 
 				// Begin a popup for a legend entry.
 				if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
+#include "mvSeriesPyramid.h"
 
 namespace Marvel {
 
@@ -10,6 +13,7 @@ namespace Marvel {
 	public:
 
 		explicit mvLineSeries(mvUUID uuid);
+		~mvLineSeries();
 
 		void draw(ImDrawList* drawlist, float x, float y) override;
 		void setDataSource(mvUUID dataSource) override;
@@ -20,6 +24,11 @@ namespace Marvel {
 		void handleSpecificKeywordArgs(PyObject* dict) override;
 		void getSpecificConfiguration(PyObject* dict) override;
 		void applySpecificTemplate(mvAppItem* item) override;
+		void getSpecificInfo(PyObject* dict) override;
+		void renderSpecificDebugInfo() override;
+
+		// append_series_data
+		void appendData(const std::vector<f64>& x, const std::vector<f64>& y);
 
 	private:
 
@@ -30,6 +39,16 @@ namespace Marvel {
 			std::vector<double>{},
 			std::vector<double>{} });
 
+		b8             _zeroCopy = false;
+		mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+		i32            _capacity = 0;   // ring buffer size for appended data (0 = unbounded)
+		i32            _ringOffset = 0; // index of the oldest sample
+		i32            _downsample = mvPlotDownsample_None;
+		mvSeriesDecimation _decimation; // cached downsampled data
+		mvSeriesOrder  _order;
+		b8             _lod = false;
+		mvSeriesPyramid _pyramid;     // min/max levels (lod)
+
 	};
 
 }
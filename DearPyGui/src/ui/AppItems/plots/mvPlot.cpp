@@ -253,8 +253,6 @@ namespace Marvel {
                 
                 //item->draw(ImPlot::GetPlotDrawList(), ImPlot::GetPlotPos().x, ImPlot::GetPlotPos().y);
                 item->draw(ImPlot::GetPlotDrawList(), 0.0f, 0.0f);
-                
-                UpdateAppItemState(item->_state);
             }
 
             ImPlot::PopPlotClipRect();
@@ -15,20 +15,31 @@ namespace Marvel {
 	{
 	}
 
+	mvScatterSeries::~mvScatterSeries()
+	{
+		ReleaseSeriesBuffers(_buffers, 2);
+	}
+
 	void mvScatterSeries::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvScatterSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
+		_order.hint = titem->_order.hint;
+		_capacity = titem->_capacity;
 	}
 
 	PyObject* mvScatterSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 2, _ringOffset);
 	}
 
 	void mvScatterSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 2, value);
+		_ringOffset = 0;
+		SetSeriesCapacity(*_value, _capacity, _ringOffset);
+		_order.known = false;
 	}
 
 	void mvScatterSeries::setDataSource(mvUUID dataSource)
@@ -50,6 +61,7 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_order.known = false;
 	}
 
 	void mvScatterSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -84,13 +96,36 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* yptr;
+			mvSeriesChannel channels[] = { GetSeriesChannel(_buffers[0], (*_value)[0], _ringOffset), GetSeriesChannel(_buffers[1], (*_value)[1], _ringOffset) };
 
-			xptr = &(*_value.get())[0];
-			yptr = &(*_value.get())[1];
+			// sorted x only needs the visible range
+			i32 first = 0;
+			i32 visible = std::min(channels[0].count, channels[1].count);
+			if (IsSeriesSorted(_order, channels[0]))
+				GetVisibleRange(channels[0], first, visible);
 
-			ImPlot::PlotScatter(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+			if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+					{
+						ImPlot::PlotScatter(_internalLabel.c_str(), xs, ys, count, 0, stride);
+					}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible));
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* yptr;
+
+				xptr = &(*_value.get())[0];
+				yptr = &(*_value.get())[1];
+
+				// a visible range wrapping around the ring is drawn whole
+				i32 start = GetRingRangeStart(first, visible, _ringOffset, (i32)xptr->size());
+				if (start >= 0)
+					ImPlot::PlotScatter(_internalLabel.c_str(), xptr->data() + start, yptr->data() + start, visible);
+				else
+					ImPlot::PlotScatter(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _ringOffset);
+			}
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -148,11 +183,11 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
 				break;
 
 			default:
@@ -166,14 +201,38 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y")) { (*_value)[1] = ToDoubleVect(item); }
+		// unroll appended data before it is replaced or resized
+		b8 ringChanged = PyDict_GetItemString(dict, "capacity") || PyDict_GetItemString(dict, "x") || PyDict_GetItemString(dict, "y");
+		if (ringChanged) SetSeriesCapacity(*_value, 0, _ringOffset);
+
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sorted_x")) _order.hint = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "capacity")) _capacity = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y")) { SetSeriesChannel(_buffers[1], (*_value)[1], item); }
+
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, 2);
+		if (ringChanged) SetSeriesCapacity(*_value, _capacity, _ringOffset);
+
+		_order.known = false;
 	}
 
 	void mvScatterSeries::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+		PyDict_SetItemString(dict, "sorted_x", mvPyObject(ToPyBool(_order.hint)));
+		PyDict_SetItemString(dict, "capacity", mvPyObject(ToPyInt(_capacity)));
 	}
 
+
+	void mvScatterSeries::appendData(const std::vector<f64>& x, const std::vector<f64>& y)
+	{
+		// appending switches a zero copy series to owned storage
+		ResolveSeriesBuffers(false, _buffers, *_value, 2);
+		UpdateSeriesOrder(_order, GetSeriesChannel(_buffers[0], (*_value)[0], _ringOffset), x);
+		AppendSeriesData(*_value, _capacity, _ringOffset, x, y);
+	}
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
 
 namespace Marvel {
 
@@ -10,6 +12,7 @@ namespace Marvel {
     public:
 
         explicit mvScatterSeries(mvUUID uuid);
+        ~mvScatterSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void setDataSource(mvUUID dataSource) override;
@@ -21,6 +24,9 @@ namespace Marvel {
         void getSpecificConfiguration(PyObject* dict) override;
         void applySpecificTemplate(mvAppItem* item) override;
 
+        // append_series_data
+        void appendData(const std::vector<f64>& x, const std::vector<f64>& y);
+
     private:
 
         mvRef<std::vector<std::vector<double>>> _value = CreateRef<std::vector<std::vector<double>>>(
@@ -30,6 +36,12 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+        mvSeriesOrder  _order;
+        i32            _capacity = 0;   // ring buffer size for appended data (0 = unbounded)
+        i32            _ringOffset = 0; // index of the oldest sample
+
     };
 
 }
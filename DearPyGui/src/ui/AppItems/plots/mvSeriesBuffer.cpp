@@ -0,0 +1,277 @@
+#include "mvSeriesBuffer.h"
+#include <algorithm>
+#include "mvPythonTranslator.h"
+#include "mvGlobalIntepreterLock.h"
+
+namespace Marvel {
+
+	mv_internal mvSeriesBufferType
+	GetSeriesBufferType(const Py_buffer& view)
+	{
+		const char* format = view.format ? view.format : "B";
+
+		// native or little endian only
+		if (*format == '@' || *format == '=' || *format == '<')
+			format++;
+
+		if (format[0] == 0 || format[1] != 0)
+			return mvSeriesBufferType::None;
+
+		switch (format[0])
+		{
+		case 'b': return mvSeriesBufferType::S8;
+		case 'B': return mvSeriesBufferType::U8;
+		case 'h': return mvSeriesBufferType::S16;
+		case 'H': return mvSeriesBufferType::U16;
+		case 'i': return mvSeriesBufferType::S32;
+		case 'I': return mvSeriesBufferType::U32;
+		case 'l': return view.itemsize == 8 ? mvSeriesBufferType::S64 : mvSeriesBufferType::S32;
+		case 'L': return view.itemsize == 8 ? mvSeriesBufferType::U64 : mvSeriesBufferType::U32;
+		case 'q': return mvSeriesBufferType::S64;
+		case 'Q': return mvSeriesBufferType::U64;
+		case 'f': return mvSeriesBufferType::Float;
+		case 'd': return mvSeriesBufferType::Double;
+		default:  return mvSeriesBufferType::None;
+		}
+	}
+
+	b8
+	SetSeriesBuffer(mvSeriesBuffer& buffer, PyObject* value)
+	{
+		ReleaseSeriesBuffer(buffer);
+
+		if (value == nullptr || !PyObject_CheckBuffer(value))
+			return false;
+
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_STRIDES | PyBUF_FORMAT))
+		{
+			PyErr_Clear();
+			return false;
+		}
+
+		mvSeriesBufferType type = GetSeriesBufferType(view);
+		if (view.ndim != 1 || type == mvSeriesBufferType::None || view.strides[0] <= 0)
+		{
+			PyBuffer_Release(&view);
+			return false;
+		}
+
+		buffer.view = view;
+		buffer.object = view.obj;
+		buffer.type = type;
+		buffer.data = (const char*)view.buf;
+		buffer.count = (i32)view.shape[0];
+		buffer.stride = (i32)view.strides[0];
+		return true;
+	}
+
+	void
+	ReleaseSeriesBuffer(mvSeriesBuffer& buffer)
+	{
+		if (buffer.object == nullptr)
+			return;
+
+		PyBuffer_Release(&buffer.view);
+		buffer = mvSeriesBuffer();
+	}
+
+	void
+	ReleaseSeriesBuffers(mvSeriesBuffer* buffers, i32 count)
+	{
+		b8 held = false;
+		for (i32 i = 0; i < count; i++)
+			held = held || buffers[i].object != nullptr;
+		if (!held)
+			return;
+
+		mvGlobalIntepreterLock gil;
+		for (i32 i = 0; i < count; i++)
+			ReleaseSeriesBuffer(buffers[i]);
+	}
+
+	f64
+	GetSeriesBufferValue(const mvSeriesBuffer& buffer, i32 index)
+	{
+		const char* element = buffer.data + (size_t)index * buffer.stride;
+		switch (buffer.type)
+		{
+		case mvSeriesBufferType::S8:     return (f64)*(const ImS8*)element;
+		case mvSeriesBufferType::U8:     return (f64)*(const ImU8*)element;
+		case mvSeriesBufferType::S16:    return (f64)*(const ImS16*)element;
+		case mvSeriesBufferType::U16:    return (f64)*(const ImU16*)element;
+		case mvSeriesBufferType::S32:    return (f64)*(const ImS32*)element;
+		case mvSeriesBufferType::U32:    return (f64)*(const ImU32*)element;
+		case mvSeriesBufferType::S64:    return (f64)*(const ImS64*)element;
+		case mvSeriesBufferType::U64:    return (f64)*(const ImU64*)element;
+		case mvSeriesBufferType::Float:  return (f64)*(const float*)element;
+		case mvSeriesBufferType::Double: return *(const double*)element;
+		default:                         return 0.0;
+		}
+	}
+
+	b8
+	SeriesBuffersCompatible(const mvSeriesBuffer& first, const mvSeriesBuffer& second)
+	{
+		// ImPlot takes a single type and stride for all arrays of a series
+		return first.object && second.object
+			&& first.type == second.type
+			&& first.stride == second.stride;
+	}
+
+	mvSeriesBuffer
+	SliceSeriesBuffer(const mvSeriesBuffer& buffer, i32 first, i32 count)
+	{
+		mvSeriesBuffer slice = buffer;
+		slice.data = buffer.data + (size_t)first * buffer.stride;
+		slice.count = count;
+		return slice;
+	}
+
+	void
+	SetSeriesChannel(mvSeriesBuffer& buffer, std::vector<f64>& values, PyObject* value)
+	{
+		if (SetSeriesBuffer(buffer, value))
+			values.clear();
+		else
+			values = ToDoubleVect(value);
+	}
+
+	void
+	ResolveSeriesBuffers(b8 zeroCopy, mvSeriesBuffer* buffers, std::vector<std::vector<f64>>& values, i32 channelCount)
+	{
+		b8 keep = zeroCopy;
+		for (i32 i = 0; i < channelCount && keep; i++)
+			keep = SeriesBuffersCompatible(buffers[0], buffers[i]);
+
+		if (keep)
+			return;
+
+		for (i32 i = 0; i < channelCount; i++)
+		{
+			if (buffers[i].object == nullptr)
+				continue;
+
+			values[i].resize(buffers[i].count);
+			for (i32 j = 0; j < buffers[i].count; j++)
+				values[i][j] = GetSeriesBufferValue(buffers[i], j);
+			ReleaseSeriesBuffer(buffers[i]);
+		}
+	}
+
+	void
+	SetSeriesPyValue(b8 zeroCopy, mvSeriesBuffer* buffers, std::vector<std::vector<f64>>& values, i32 channelCount, PyObject* value)
+	{
+		if (!zeroCopy || !(PyList_Check(value) || PyTuple_Check(value)))
+		{
+			for (i32 i = 0; i < channelCount; i++)
+				ReleaseSeriesBuffer(buffers[i]);
+			values = ToVectVectDouble(value);
+			return;
+		}
+
+		b8 isList = PyList_Check(value);
+		Py_ssize_t count = isList ? PyList_Size(value) : PyTuple_Size(value);
+		for (i32 i = 0; i < channelCount && i < count; i++)
+		{
+			if ((size_t)i >= values.size())
+				values.emplace_back();
+			SetSeriesChannel(buffers[i], values[i], isList ? PyList_GetItem(value, i) : PyTuple_GetItem(value, i));
+		}
+		ResolveSeriesBuffers(zeroCopy, buffers, values, channelCount);
+	}
+
+	PyObject*
+	ToPyList(const mvSeriesBuffer* buffers, const std::vector<std::vector<f64>>& values, i32 channelCount, i32 offset)
+	{
+		if (offset > 0)
+		{
+			// return ring buffer contents oldest first
+			std::vector<std::vector<f64>> ordered = values;
+			SetSeriesCapacity(ordered, 0, offset);
+			return ToPyList(ordered);
+		}
+
+		if (buffers[0].object == nullptr)
+			return ToPyList(values);
+
+		// referenced buffers are returned as is
+		PyObject* result = PyList_New(values.size());
+		for (size_t i = 0; i < values.size(); i++)
+		{
+			if ((i32)i < channelCount && buffers[i].object)
+			{
+				Py_INCREF(buffers[i].object);
+				PyList_SetItem(result, i, buffers[i].object);
+			}
+			else
+				PyList_SetItem(result, i, ToPyList(values[i]));
+		}
+		return result;
+	}
+
+	void
+	AppendSeriesData(std::vector<std::vector<f64>>& values, i32 capacity, i32& offset, const std::vector<f64>& x, const std::vector<f64>& y)
+	{
+		std::vector<f64>& xs = values[0];
+		std::vector<f64>& ys = values[1];
+
+		// keep the channels aligned
+		size_t count = std::min(x.size(), y.size());
+		if (xs.size() != ys.size())
+		{
+			SetSeriesCapacity(values, 0, offset);
+			xs.resize(std::min(xs.size(), ys.size()));
+			ys.resize(xs.size());
+		}
+
+		if (capacity <= 0)
+		{
+			xs.insert(xs.end(), x.begin(), x.begin() + count);
+			ys.insert(ys.end(), y.begin(), y.begin() + count);
+			return;
+		}
+
+		// only the newest samples can survive
+		size_t start = count > (size_t)capacity ? count - (size_t)capacity : 0;
+		for (size_t i = start; i < count; i++)
+		{
+			if (xs.size() < (size_t)capacity)
+			{
+				xs.push_back(x[i]);
+				ys.push_back(y[i]);
+			}
+			else
+			{
+				xs[offset] = x[i];
+				ys[offset] = y[i];
+				offset = (offset + 1) % capacity;
+			}
+		}
+	}
+
+	void
+	SetSeriesCapacity(std::vector<std::vector<f64>>& values, i32 capacity, i32& offset)
+	{
+		std::vector<f64>& xs = values[0];
+		std::vector<f64>& ys = values[1];
+
+		if (offset > 0)
+		{
+			if ((size_t)offset < xs.size())
+				std::rotate(xs.begin(), xs.begin() + offset, xs.end());
+			if ((size_t)offset < ys.size())
+				std::rotate(ys.begin(), ys.begin() + offset, ys.end());
+			offset = 0;
+		}
+
+		if (capacity <= 0)
+			return;
+
+		if (xs.size() > (size_t)capacity)
+			xs.erase(xs.begin(), xs.end() - capacity);
+		if (ys.size() > (size_t)capacity)
+			ys.erase(ys.begin(), ys.end() - capacity);
+	}
+
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include <vector>
+#include <imgui.h>
+#include "mvContext.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvSeriesBuffer
+    //     - reference to a 1D python buffer (numpy, array, mvBuffer, ...) that
+    //       series plot from directly instead of copying (zero_copy=True)
+    //     - the buffer stays exported while referenced, so the owner can't
+    //       resize it underneath the render thread
+    //     - acquiring/releasing requires the GIL
+    //-----------------------------------------------------------------------------
+
+    enum class mvSeriesBufferType
+    {
+        None = 0,
+        S8, U8, S16, U16, S32, U32, S64, U64,
+        Float, Double
+    };
+
+    struct mvSeriesBuffer
+    {
+        PyObject*          object = nullptr;
+        Py_buffer          view   = {};
+        mvSeriesBufferType type   = mvSeriesBufferType::None;
+        const char*        data   = nullptr;
+        i32                count  = 0;
+        i32                stride = 0; // bytes
+    };
+
+    b8        SetSeriesBuffer     (mvSeriesBuffer& buffer, PyObject* value); // false if value isn't a usable buffer
+    void      ReleaseSeriesBuffer (mvSeriesBuffer& buffer);
+    void      ReleaseSeriesBuffers(mvSeriesBuffer* buffers, i32 count); // item destructors, takes the GIL only if a buffer is held
+    f64       GetSeriesBufferValue(const mvSeriesBuffer& buffer, i32 index);
+    b8        SeriesBuffersCompatible(const mvSeriesBuffer& first, const mvSeriesBuffer& second);
+    mvSeriesBuffer SliceSeriesBuffer(const mvSeriesBuffer& buffer, i32 first, i32 count); // non owning view, never release it
+
+    // sets a series channel, referencing the buffer if possible and copying otherwise
+    void      SetSeriesChannel    (mvSeriesBuffer& buffer, std::vector<f64>& values, PyObject* value);
+
+    // keeps the channel buffers only if zero copy is enabled and all channels
+    // (up to channelCount) can be plotted together, otherwise copies them
+    void      ResolveSeriesBuffers(b8 zeroCopy, mvSeriesBuffer* buffers, std::vector<std::vector<f64>>& values, i32 channelCount);
+    void      SetSeriesPyValue    (b8 zeroCopy, mvSeriesBuffer* buffers, std::vector<std::vector<f64>>& values, i32 channelCount, PyObject* value);
+    PyObject* ToPyList            (const mvSeriesBuffer* buffers, const std::vector<std::vector<f64>>& values, i32 channelCount, i32 offset = 0);
+
+    // ring buffer storage for streaming x/y data (append_series_data)
+    //   * capacity <= 0 means unbounded
+    //   * offset is the index of the oldest sample, passed to ImPlot's offset argument
+    void      AppendSeriesData    (std::vector<std::vector<f64>>& values, i32 capacity, i32& offset, const std::vector<f64>& x, const std::vector<f64>& y);
+    void      SetSeriesCapacity   (std::vector<std::vector<f64>>& values, i32 capacity, i32& offset); // unrolls and keeps the newest samples
+
+    // calls f(count, stride, const T* first, const T* rest...) with the buffers' element type
+    template<typename F, typename ...Buffers>
+    void VisitSeriesBuffers(F f, const mvSeriesBuffer& first, const Buffers&... rest)
+    {
+        i32 count = first.count;
+        ((count = rest.count < count ? rest.count : count), ...);
+
+        switch (first.type)
+        {
+        case mvSeriesBufferType::S8:     f(count, first.stride, (const ImS8*)first.data,   (const ImS8*)rest.data...);   break;
+        case mvSeriesBufferType::U8:     f(count, first.stride, (const ImU8*)first.data,   (const ImU8*)rest.data...);   break;
+        case mvSeriesBufferType::S16:    f(count, first.stride, (const ImS16*)first.data,  (const ImS16*)rest.data...);  break;
+        case mvSeriesBufferType::U16:    f(count, first.stride, (const ImU16*)first.data,  (const ImU16*)rest.data...);  break;
+        case mvSeriesBufferType::S32:    f(count, first.stride, (const ImS32*)first.data,  (const ImS32*)rest.data...);  break;
+        case mvSeriesBufferType::U32:    f(count, first.stride, (const ImU32*)first.data,  (const ImU32*)rest.data...);  break;
+        case mvSeriesBufferType::S64:    f(count, first.stride, (const ImS64*)first.data,  (const ImS64*)rest.data...);  break;
+        case mvSeriesBufferType::U64:    f(count, first.stride, (const ImU64*)first.data,  (const ImU64*)rest.data...);  break;
+        case mvSeriesBufferType::Float:  f(count, first.stride, (const float*)first.data,  (const float*)rest.data...);  break;
+        case mvSeriesBufferType::Double: f(count, first.stride, (const double*)first.data, (const double*)rest.data...); break;
+        default: break;
+        }
+    }
+
+}
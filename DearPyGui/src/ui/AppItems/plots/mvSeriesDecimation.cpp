@@ -0,0 +1,313 @@
+#include "mvSeriesDecimation.h"
+#include <algorithm>
+#include <cmath>
+#include <implot.h>
+#include <implot_internal.h>
+
+namespace Marvel {
+
+	// maps x values to pixel columns, -1 left of the plot and width right of it
+	struct mvColumnMapper
+	{
+		f64 min   = 0.0;
+		f64 scale = 0.0;
+		b8  log   = false;
+		i32 width = 0;
+
+		i32 operator()(f64 x) const
+		{
+			if (log)
+				x = x > 0.0 ? std::log10(x) : -HUGE_VAL;
+			f64 column = (x - min) * scale;
+			if (!(column >= 0.0)) // also catches nan
+				return -1;
+			if (column >= (f64)width)
+				return width;
+			return (i32)column;
+		}
+	};
+
+	mv_internal void
+	EmitSample(mvSeriesDecimation& cache, const mvSeriesChannel* channels, i32 channelCount, i32 index)
+	{
+		for (i32 i = 0; i < channelCount; i++)
+			cache.values[i].push_back(channels[i][index]);
+	}
+
+	mv_internal void
+	EmitPair(mvSeriesDecimation& cache, const mvSeriesChannel* channels, i32 channelCount, i32 first, i32 second)
+	{
+		if (first > second)
+			std::swap(first, second);
+		EmitSample(cache, channels, channelCount, first);
+		if (second != first)
+			EmitSample(cache, channels, channelCount, second);
+	}
+
+	mv_internal void
+	DecimateMinMax(mvSeriesDecimation& cache, const mvSeriesChannel* channels, i32 channelCount, i32 first, i32 count, const mvColumnMapper& columnOf)
+	{
+		const mvSeriesChannel& xs = channels[0];
+		const mvSeriesChannel& ys = channels[1];
+
+		// runs of consecutive samples landing in the same column, so unsorted
+		// data still draws correctly (just with less reduction)
+		i32 column = columnOf(xs[first]);
+		i32 runFirst = first;
+		i32 last = first;
+		i32 minIndex = first;
+		i32 maxIndex = first;
+		f64 miny = ys[first];
+		f64 maxy = ys[first];
+
+		auto flush = [&]()
+		{
+			// off screen runs only need their ends to connect to the visible part
+			if (column < 0 || column >= columnOf.width)
+				EmitPair(cache, channels, channelCount, runFirst, last);
+			else
+				EmitPair(cache, channels, channelCount, minIndex, maxIndex);
+		};
+
+		for (i32 i = first + 1; i < first + count; i++)
+		{
+			i32 nextColumn = columnOf(xs[i]);
+			f64 y = ys[i];
+
+			if (nextColumn != column)
+			{
+				flush();
+				column = nextColumn;
+				runFirst = last = minIndex = maxIndex = i;
+				miny = maxy = y;
+				continue;
+			}
+
+			last = i;
+			if (y < miny) { miny = y; minIndex = i; }
+			if (y > maxy) { maxy = y; maxIndex = i; }
+		}
+		flush();
+	}
+
+	mv_internal void
+	DecimateLTTB(mvSeriesDecimation& cache, const mvSeriesChannel* channels, i32 channelCount, i32 first, i32 count, const mvColumnMapper& columnOf)
+	{
+		const mvSeriesChannel& xs = channels[0];
+		const mvSeriesChannel& ys = channels[1];
+
+		// visible range plus one sample on each side
+		i32 start = first;
+		while (start < first + count && columnOf(xs[start]) < 0)
+			start++;
+		i32 end = first + count - 1;
+		while (end > start && columnOf(xs[end]) >= columnOf.width)
+			end--;
+		start = std::max(start - 1, first);
+		end = std::min(end + 1, first + count - 1);
+
+		i32 visible = end - start + 1;
+		i32 threshold = 2 * columnOf.width;
+		if (visible <= threshold || threshold < 3)
+		{
+			for (i32 i = start; i <= end; i++)
+				EmitSample(cache, channels, channelCount, i);
+			return;
+		}
+
+		// first and last samples are always kept, the rest is split into
+		// threshold - 2 buckets that each keep the sample forming the largest
+		// triangle with the previous pick and the next bucket's average
+		f64 bucketSize = (f64)(visible - 2) / (f64)(threshold - 2);
+		i32 a = start;
+		EmitSample(cache, channels, channelCount, a);
+
+		for (i32 bucket = 0; bucket < threshold - 2; bucket++)
+		{
+			i32 bucketStart = start + 1 + (i32)(bucket * bucketSize);
+			i32 bucketEnd = std::min(start + 1 + (i32)((bucket + 1) * bucketSize), end);
+
+			i32 nextStart = bucketEnd;
+			i32 nextEnd = std::min(start + 1 + (i32)((bucket + 2) * bucketSize), end + 1);
+			f64 avgx = 0.0;
+			f64 avgy = 0.0;
+			for (i32 i = nextStart; i < nextEnd; i++)
+			{
+				avgx += xs[i];
+				avgy += ys[i];
+			}
+			if (nextEnd > nextStart)
+			{
+				avgx /= (f64)(nextEnd - nextStart);
+				avgy /= (f64)(nextEnd - nextStart);
+			}
+
+			f64 ax = xs[a];
+			f64 ay = ys[a];
+			f64 maxArea = -1.0;
+			i32 pick = bucketStart;
+			for (i32 i = bucketStart; i < bucketEnd; i++)
+			{
+				f64 area = std::abs((ax - avgx) * (ys[i] - ay) - (ax - xs[i]) * (avgy - ay));
+				if (area > maxArea)
+				{
+					maxArea = area;
+					pick = i;
+				}
+			}
+
+			EmitSample(cache, channels, channelCount, pick);
+			a = pick;
+		}
+
+		EmitSample(cache, channels, channelCount, end);
+	}
+
+	mvSeriesChannel
+	GetSeriesChannel(const mvSeriesBuffer& buffer, const std::vector<f64>& values, i32 offset)
+	{
+		mvSeriesChannel channel;
+		if (buffer.object)
+		{
+			channel.buffer = &buffer;
+			channel.count = buffer.count;
+		}
+		else
+		{
+			channel.values = values.data();
+			channel.count = (i32)values.size();
+			channel.offset = offset;
+		}
+		return channel;
+	}
+
+	b8
+	IsSeriesSorted(mvSeriesOrder& order, const mvSeriesChannel& xs)
+	{
+		if (order.hint)
+			return true;
+
+		if (!order.known)
+		{
+			order.known = true;
+			order.sorted = true;
+			for (i32 i = 1; i < xs.count && order.sorted; i++)
+				order.sorted = xs[i - 1] <= xs[i];
+		}
+		return order.sorted;
+	}
+
+	void
+	UpdateSeriesOrder(mvSeriesOrder& order, const mvSeriesChannel& xs, const std::vector<f64>& appended)
+	{
+		if (!order.known || !order.sorted || appended.empty())
+			return;
+
+		// dropping the oldest samples can't unsort, only the new ones matter
+		b8 sorted = xs.count == 0 || xs[xs.count - 1] <= appended[0];
+		for (size_t i = 1; i < appended.size() && sorted; i++)
+			sorted = appended[i - 1] <= appended[i];
+		order.sorted = sorted;
+	}
+
+	void
+	GetVisibleRange(const mvSeriesChannel& xs, i32& first, i32& count)
+	{
+		// fitting needs every sample
+		if (count < 3 || ImPlot::FitThisFrame())
+			return;
+
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+
+		// first sample >= min and first sample > max
+		i32 low = first;
+		i32 high = first + count;
+		while (low < high)
+		{
+			i32 mid = low + (high - low) / 2;
+			if (xs[mid] < limits.X.Min) low = mid + 1; else high = mid;
+		}
+		i32 start = low;
+
+		high = first + count;
+		while (low < high)
+		{
+			i32 mid = low + (high - low) / 2;
+			if (xs[mid] <= limits.X.Max) low = mid + 1; else high = mid;
+		}
+		i32 end = low;
+
+		// one sample of margin so lines reach the plot edges
+		start = std::max(start - 1, first);
+		end = std::min(end + 1, first + count);
+		first = start;
+		count = end - start;
+	}
+
+	i32
+	GetRingRangeStart(i32 first, i32 count, i32 offset, i32 size)
+	{
+		i32 start = first + offset;
+		if (start >= size)
+			start -= size;
+		return start + count <= size ? start : -1;
+	}
+
+	b8
+	DecimateSeries(mvSeriesDecimation& cache, i32 mode, const mvSeriesChannel* channels, i32 channelCount, i32 first, i32 count)
+	{
+		if (mode == mvPlotDownsample_None)
+		{
+			cache.active = false;
+			return false;
+		}
+
+		// fitting needs every sample, recompute afterwards
+		if (ImPlot::FitThisFrame())
+		{
+			cache.active = false;
+			cache.dirty = true;
+			return false;
+		}
+
+		ImPlotLimits limits = ImPlot::GetPlotLimits();
+		i32 width = (i32)ImPlot::GetPlotSize().x;
+		const void* data = channels[0].buffer ? (const void*)channels[0].buffer->data : (const void*)channels[0].values;
+
+		if (!cache.dirty && cache.mode == mode && cache.data == data && cache.first == first && cache.count == count
+			&& cache.xmin == limits.X.Min && cache.xmax == limits.X.Max && cache.width == width)
+			return cache.active;
+
+		cache.dirty = false;
+		cache.mode = mode;
+		cache.data = data;
+		cache.first = first;
+		cache.count = count;
+		cache.xmin = limits.X.Min;
+		cache.xmax = limits.X.Max;
+		cache.width = width;
+		for (auto& values : cache.values)
+			values.clear();
+
+		// not worth it with only a few points per column
+		cache.active = width > 0 && count > 4 * width;
+		if (!cache.active)
+			return false;
+
+		mvColumnMapper columnOf;
+		columnOf.width = width;
+		columnOf.log = ImPlot::GetCurrentPlot()->XAxis.IsLog();
+		f64 min = columnOf.log ? std::log10(limits.X.Min) : limits.X.Min;
+		f64 max = columnOf.log ? std::log10(limits.X.Max) : limits.X.Max;
+		columnOf.min = min;
+		columnOf.scale = max > min ? (f64)width / (max - min) : 0.0;
+
+		if (mode == mvPlotDownsample_LTTB)
+			DecimateLTTB(cache, channels, channelCount, first, count, columnOf);
+		else
+			DecimateMinMax(cache, channels, channelCount, first, count, columnOf);
+
+		return true;
+	}
+
+}
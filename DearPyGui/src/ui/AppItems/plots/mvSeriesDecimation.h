@@ -0,0 +1,89 @@
+#pragma once
+
+#include <vector>
+#include "mvSeriesBuffer.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvSeriesDecimation
+    //     - reduces the visible part of a series to ~2 points per pixel column
+    //       before handing it to ImPlot (downsample keyword)
+    //     - computed from the current plot limits and cached until the data,
+    //       limits or plot width change
+    //     - channel 0 is x, additional y channels (shade) are sampled at the
+    //       indices picked for the first y channel
+    //     - series with sorted x only submit (and decimate) the visible range,
+    //       found with a binary search over the plot limits
+    //-----------------------------------------------------------------------------
+
+    enum mvPlotDownsample
+    {
+        mvPlotDownsample_None = 0,
+        mvPlotDownsample_MinMax,   // min and max of every pixel column
+        mvPlotDownsample_LTTB      // largest triangle three buckets (expects sorted x)
+    };
+
+    // read only view of a series channel that hides owned vs referenced
+    // storage and the ring buffer offset
+    struct mvSeriesChannel
+    {
+        const mvSeriesBuffer* buffer = nullptr;
+        const f64*            values = nullptr;
+        i32                   count  = 0;
+        i32                   offset = 0;
+
+        f64 operator[](i32 index) const
+        {
+            if (offset > 0)
+            {
+                index += offset;
+                if (index >= count)
+                    index -= count;
+            }
+            return buffer ? GetSeriesBufferValue(*buffer, index) : values[index];
+        }
+    };
+
+    // x order of a series, detected on the first draw after the data changed
+    // unless given with the sorted_x hint, and kept up to date by appends
+    struct mvSeriesOrder
+    {
+        b8 hint   = false; // sorted_x
+        b8 known  = false;
+        b8 sorted = false;
+    };
+
+    struct mvSeriesDecimation
+    {
+        std::vector<f64> values[3];     // decimated x, y (, y2)
+        b8               active = false; // values hold the series to draw
+        b8               dirty  = true;  // set by the series when its data changes
+
+        // cache key
+        i32              mode  = mvPlotDownsample_None;
+        const void*      data  = nullptr;
+        i32              first = 0;
+        i32              count = 0;
+        f64              xmin  = 0.0;
+        f64              xmax  = 0.0;
+        i32              width = 0;
+    };
+
+    mvSeriesChannel GetSeriesChannel (const mvSeriesBuffer& buffer, const std::vector<f64>& values, i32 offset = 0);
+
+    b8              IsSeriesSorted   (mvSeriesOrder& order, const mvSeriesChannel& xs);
+    void            UpdateSeriesOrder(mvSeriesOrder& order, const mvSeriesChannel& xs, const std::vector<f64>& appended); // call before appending
+
+    // narrows [first, first + count) of sorted x data to the samples inside the
+    // current plot limits plus one on each side (between BeginPlot/EndPlot)
+    void            GetVisibleRange  (const mvSeriesChannel& xs, i32& first, i32& count);
+
+    // start of a logical range in ring storage, -1 if the range wraps around
+    i32             GetRingRangeStart(i32 first, i32 count, i32 offset, i32 size);
+
+    // must be called between BeginPlot/EndPlot, returns false if the series
+    // should be drawn as is (decimation off or too few points to matter)
+    b8              DecimateSeries   (mvSeriesDecimation& cache, i32 mode, const mvSeriesChannel* channels, i32 channelCount, i32 first, i32 count);
+
+}
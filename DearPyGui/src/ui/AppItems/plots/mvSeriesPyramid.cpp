@@ -0,0 +1,209 @@
+#include "mvSeriesPyramid.h"
+#include <algorithm>
+#include <implot.h>
+#include <implot_internal.h>
+#include "mvContext.h"
+#include "mvThreadPool.h"
+
+namespace Marvel {
+
+	mv_internal constexpr i32 PyramidFanout = 8;
+	mv_internal constexpr i32 PyramidMinimumCount = 1 << 16; // smaller series are cheap enough to draw
+	mv_internal constexpr i32 PyramidTopBlocks = 256;        // no more levels once one is this small
+
+	mv_internal void
+	EmitBlock(std::vector<mvPyramidSample>& level, const mvPyramidSample& minSample, i32 minIndex, const mvPyramidSample& maxSample, i32 maxIndex)
+	{
+		// every block keeps two samples so levels can be indexed directly
+		if (minIndex <= maxIndex)
+		{
+			level.push_back(minSample);
+			level.push_back(maxSample);
+		}
+		else
+		{
+			level.push_back(maxSample);
+			level.push_back(minSample);
+		}
+	}
+
+	// (re)computes every block from the one holding sample oldCount onwards,
+	// returns false if cancelled
+	mv_internal b8
+	BuildPyramidLevels(mvPyramidLevels& levels, const mvSeriesChannel& xs, const mvSeriesChannel& ys, i32 oldCount, i32 count, const std::atomic_bool* cancel)
+	{
+		i64 blockSize = PyramidFanout;
+		for (size_t k = 0; ; k++)
+		{
+			if (k == levels.size())
+			{
+				if (k > 0 && levels[k - 1].size() <= 2 * PyramidTopBlocks)
+					break;
+				levels.emplace_back();
+			}
+
+			std::vector<mvPyramidSample>& level = levels[k];
+			i32 start = (i32)std::min((i64)oldCount / blockSize, (i64)level.size() / 2);
+			i32 blocks = (i32)(((i64)count + blockSize - 1) / blockSize);
+			level.resize((size_t)start * 2);
+			level.reserve((size_t)blocks * 2);
+
+			for (i32 block = start; block < blocks; block++)
+			{
+				if (cancel && (block & 1023) == 0 && cancel->load(std::memory_order_relaxed))
+					return false;
+
+				mvPyramidSample minSample, maxSample;
+				i32 minIndex = -1;
+				i32 maxIndex = -1;
+
+				if (k == 0)
+				{
+					i32 end = std::min(block * PyramidFanout + PyramidFanout, count);
+					for (i32 i = block * PyramidFanout; i < end; i++)
+					{
+						f64 y = ys[i];
+						if (minIndex == -1 || y < minSample.y) { minSample = { xs[i], y }; minIndex = i; }
+						if (maxIndex == -1 || y > maxSample.y) { maxSample = { xs[i], y }; maxIndex = i; }
+					}
+				}
+				else
+				{
+					// children are already in index order
+					const std::vector<mvPyramidSample>& children = levels[k - 1];
+					i32 end = std::min(block * PyramidFanout * 2 + PyramidFanout * 2, (i32)children.size());
+					for (i32 i = block * PyramidFanout * 2; i < end; i++)
+					{
+						const mvPyramidSample& sample = children[i];
+						if (minIndex == -1 || sample.y < minSample.y) { minSample = sample; minIndex = i; }
+						if (maxIndex == -1 || sample.y > maxSample.y) { maxSample = sample; maxIndex = i; }
+					}
+				}
+
+				EmitBlock(level, minSample, minIndex, maxSample, maxIndex);
+			}
+
+			blockSize *= PyramidFanout;
+		}
+		return true;
+	}
+
+	// owned values can be shared with series using this one as their source,
+	// which replace them without resetting this pyramid, so the build works
+	// on a copy; referenced buffers stay exported until this series resets
+	mv_internal mvSeriesChannel
+	SnapshotSeriesChannel(const mvSeriesChannel& channel, i32 count, std::shared_ptr<std::vector<f64>>& storage)
+	{
+		if (channel.buffer)
+			return channel;
+
+		storage = std::make_shared<std::vector<f64>>((size_t)count);
+		for (i32 i = 0; i < count; i++)
+			(*storage)[i] = channel[i];
+
+		mvSeriesChannel snapshot;
+		snapshot.values = storage->data();
+		snapshot.count = count;
+		return snapshot;
+	}
+
+	void
+	ResetSeriesPyramid(mvSeriesPyramid& pyramid)
+	{
+		if (pyramid.job.valid())
+		{
+			pyramid.cancel = true;
+			pyramid.job.wait();
+			pyramid.job = std::future<mvPyramidLevels>();
+			pyramid.cancel = false;
+		}
+		pyramid.levels.clear();
+		pyramid.levels.shrink_to_fit();
+		pyramid.count = 0;
+	}
+
+	void
+	ExtendSeriesPyramid(mvSeriesPyramid& pyramid, const mvSeriesChannel& xs, const mvSeriesChannel& ys, i32 count)
+	{
+		// a pending build may have read data that moved, start over
+		if (pyramid.job.valid())
+		{
+			ResetSeriesPyramid(pyramid);
+			return;
+		}
+
+		if (pyramid.levels.empty())
+			return;
+
+		BuildPyramidLevels(pyramid.levels, xs, ys, pyramid.count, count, nullptr);
+		pyramid.count = count;
+	}
+
+	size_t
+	GetSeriesPyramidBytes(const mvSeriesPyramid& pyramid)
+	{
+		size_t bytes = 0;
+		for (const auto& level : pyramid.levels)
+			bytes += level.capacity() * sizeof(mvPyramidSample);
+		return bytes;
+	}
+
+	b8
+	GetSeriesPyramidLevel(mvSeriesPyramid& pyramid, const mvSeriesChannel& xs, const mvSeriesChannel& ys, i32 count,
+		i32 first, i32 visible, const mvPyramidSample*& samples, i32& sampleCount)
+	{
+		if (count < PyramidMinimumCount)
+			return false;
+
+		if (pyramid.job.valid())
+		{
+			if (pyramid.job.wait_for(std::chrono::seconds(0)) != std::future_status::ready)
+				return false;
+			pyramid.levels = pyramid.job.get();
+			pyramid.count = pyramid.jobCount;
+		}
+
+		if (pyramid.levels.empty())
+		{
+			pyramid.jobCount = count;
+			std::atomic_bool* cancel = &pyramid.cancel;
+			std::shared_ptr<std::vector<f64>> xStorage, yStorage;
+			mvSeriesChannel xSnapshot = SnapshotSeriesChannel(xs, count, xStorage);
+			mvSeriesChannel ySnapshot = SnapshotSeriesChannel(ys, count, yStorage);
+			pyramid.job = GetThreadPool().submit([xSnapshot, ySnapshot, xStorage, yStorage, count, cancel]()
+				{
+					mvPyramidLevels levels;
+					if (!BuildPyramidLevels(levels, xSnapshot, ySnapshot, 0, count, cancel))
+						levels.clear();
+					return levels;
+				});
+			return false;
+		}
+
+		// fitting needs every sample
+		if (pyramid.count != count || ImPlot::FitThisFrame())
+			return false;
+
+		// coarsest level that still has a block (two samples) per pixel column
+		i64 width = std::max((i64)ImPlot::GetPlotSize().x, (i64)1);
+		i64 blockSize = PyramidFanout;
+		i32 level = -1;
+		for (size_t k = 0; k < pyramid.levels.size() && blockSize * width <= (i64)visible; k++)
+		{
+			level = (i32)k;
+			blockSize *= PyramidFanout;
+		}
+
+		if (level < 0 || visible <= 0)
+			return false;
+
+		blockSize /= PyramidFanout;
+		const std::vector<mvPyramidSample>& samplesAtLevel = pyramid.levels[level];
+		i32 firstBlock = (i32)(first / blockSize);
+		i32 lastBlock = (i32)((first + visible - 1) / blockSize);
+		samples = samplesAtLevel.data() + (size_t)firstBlock * 2;
+		sampleCount = std::min((lastBlock - firstBlock + 1) * 2, (i32)samplesAtLevel.size() - firstBlock * 2);
+		return sampleCount > 0;
+	}
+
+}
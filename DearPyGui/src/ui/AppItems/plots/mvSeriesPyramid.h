@@ -0,0 +1,54 @@
+#pragma once
+
+#include <vector>
+#include <atomic>
+#include <future>
+#include <memory>
+#include "mvSeriesDecimation.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvSeriesPyramid
+    //     - min/max level of detail pyramid over a series with sorted x
+    //       (lod keyword)
+    //     - level k splits the data into blocks of 8^(k+1) samples and keeps
+    //       the min and max sample of every block, in index order
+    //     - built on the context thread pool the first time a large series is
+    //       drawn, then extended in place by appends
+    //     - not kept for ring buffers (capacity): once wrapped every append
+    //       shifts all indices, which would rebuild the whole pyramid
+    //     - the build copies owned values (a series sourcing this one shares
+    //       them) and reads referenced buffers directly, so anything replacing
+    //       the buffers must reset the pyramid first (cancels and waits)
+    //-----------------------------------------------------------------------------
+
+    struct mvPyramidSample
+    {
+        f64 x = 0.0;
+        f64 y = 0.0;
+    };
+
+    typedef std::vector<std::vector<mvPyramidSample>> mvPyramidLevels;
+
+    struct mvSeriesPyramid
+    {
+        mvPyramidLevels              levels;
+        i32                          count = 0;      // samples covered by levels
+        std::future<mvPyramidLevels> job;            // pending build
+        i32                          jobCount = 0;   // samples covered by the pending build
+        std::atomic_bool             cancel = false;
+    };
+
+    void   ResetSeriesPyramid   (mvSeriesPyramid& pyramid);
+    void   ExtendSeriesPyramid  (mvSeriesPyramid& pyramid, const mvSeriesChannel& xs, const mvSeriesChannel& ys, i32 count); // call after appending
+    size_t GetSeriesPyramidBytes(const mvSeriesPyramid& pyramid);
+
+    // must be called between BeginPlot/EndPlot with sorted x, returns false
+    // if the series should be drawn without the pyramid (too small, still
+    // building or zoomed in past the first level), otherwise points samples
+    // at the level matching the plot's pixel density (stride of mvPyramidSample)
+    b8     GetSeriesPyramidLevel(mvSeriesPyramid& pyramid, const mvSeriesChannel& xs, const mvSeriesChannel& ys, i32 count,
+                                 i32 first, i32 visible, const mvPyramidSample*& samples, i32& sampleCount);
+
+}
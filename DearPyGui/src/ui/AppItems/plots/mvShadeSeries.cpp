@@ -15,20 +15,30 @@ namespace Marvel {
 	{
 	}
 
+	mvShadeSeries::~mvShadeSeries()
+	{
+		ReleaseSeriesBuffers(_buffers, 3);
+	}
+
 	void mvShadeSeries::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvShadeSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
+		_order.hint = titem->_order.hint;
+		_downsample = titem->_downsample;
 	}
 
 	PyObject* mvShadeSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 3);
 	}
 
 	void mvShadeSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 3, value);
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvShadeSeries::setDataSource(mvUUID dataSource)
@@ -50,6 +60,8 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvShadeSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -84,16 +96,57 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* y1ptr;
-			static const std::vector<double>* y2ptr;
+			// without a y2 channel the series is shaded down to 0
+			i32 channelCount = _buffers[2].object || !(*_value)[2].empty() ? 3 : 2;
+			mvSeriesChannel channels[] = { GetSeriesChannel(_buffers[0], (*_value)[0]), GetSeriesChannel(_buffers[1], (*_value)[1]), GetSeriesChannel(_buffers[2], (*_value)[2]) };
 
-			xptr = &(*_value.get())[0];
-			y1ptr = &(*_value.get())[1];
-			y2ptr = &(*_value.get())[2];
+			// sorted x only needs the visible range
+			i32 first = 0;
+			i32 visible = std::min(channels[0].count, channels[1].count);
+			if (channelCount == 3)
+				visible = std::min(visible, channels[2].count);
+			if (IsSeriesSorted(_order, channels[0]))
+				GetVisibleRange(channels[0], first, visible);
 
-			ImPlot::PlotShaded(_internalLabel.c_str(), xptr->data(), y1ptr->data(),
-				y2ptr->data(), (int)xptr->size());
+			if (DecimateSeries(_decimation, _downsample, channels, channelCount, first, visible))
+			{
+				const auto& values = _decimation.values;
+				if (channelCount == 3)
+					ImPlot::PlotShaded(_internalLabel.c_str(), values[0].data(), values[1].data(), values[2].data(), (int)values[0].size());
+				else
+					ImPlot::PlotShaded(_internalLabel.c_str(), values[0].data(), values[1].data(), (int)values[0].size(), 0.0);
+			}
+			else if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				// without a y2 buffer the series is shaded down to 0
+				if (_buffers[2].object)
+				{
+					VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto y1s, auto y2s)
+						{
+							ImPlot::PlotShaded(_internalLabel.c_str(), xs, y1s, y2s, count, 0, stride);
+						}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible), SliceSeriesBuffer(_buffers[2], first, visible));
+				}
+				else
+				{
+					VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+						{
+							ImPlot::PlotShaded(_internalLabel.c_str(), xs, ys, count, 0.0, 0, stride);
+						}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible));
+				}
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* y1ptr;
+				static const std::vector<double>* y2ptr;
+
+				xptr = &(*_value.get())[0];
+				y1ptr = &(*_value.get())[1];
+				y2ptr = &(*_value.get())[2];
+
+				ImPlot::PlotShaded(_internalLabel.c_str(), xptr->data() + first, y1ptr->data() + first,
+					y2ptr->data() + first, visible);
+			}
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -151,12 +204,12 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
-				(*_value)[2] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
+				(*_value)[2].resize((*_value)[1].size());
 				break;
 
 			default:
@@ -173,12 +226,19 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sorted_x")) _order.hint = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "downsample")) _downsample = ToInt(item);
+
 		bool valueChanged = false;
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { valueChanged = true; (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y1")) { valueChanged = true; (*_value)[1] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y2")) { valueChanged = true; (*_value)[2] = ToDoubleVect(item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { valueChanged = true; SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y1")) { valueChanged = true; SetSeriesChannel(_buffers[1], (*_value)[1], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y2")) { valueChanged = true; SetSeriesChannel(_buffers[2], (*_value)[2], item); }
+
+		// an empty y2 shades down to 0 so it doesn't need a buffer
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, _buffers[2].object || !(*_value)[2].empty() ? 3 : 2);
 
-		if (valueChanged)
+		if (valueChanged && _buffers[0].object == nullptr)
 		{
 			if ((*_value)[1].size() != (*_value)[2].size())
 			{
@@ -188,12 +248,19 @@ namespace Marvel {
 
 			}
 		}
+
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvShadeSeries::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+		PyDict_SetItemString(dict, "sorted_x", mvPyObject(ToPyBool(_order.hint)));
+		PyDict_SetItemString(dict, "downsample", mvPyObject(ToPyInt(_downsample)));
 	}
 
 }
\ No newline at end of file
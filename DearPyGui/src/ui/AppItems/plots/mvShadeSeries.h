@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
 
 namespace Marvel {
 
@@ -10,6 +12,7 @@ namespace Marvel {
     public:
 
         explicit mvShadeSeries(mvUUID uuid);
+        ~mvShadeSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
@@ -32,6 +35,12 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[3]; // referenced x/y1/y2 buffers (zero_copy)
+        i32            _downsample = mvPlotDownsample_None;
+        mvSeriesDecimation _decimation; // cached downsampled data
+        mvSeriesOrder  _order;
+
     };
 
 }
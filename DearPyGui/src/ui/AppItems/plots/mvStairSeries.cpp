@@ -15,20 +15,36 @@ namespace Marvel {
 	{
 	}
 
+	mvStairSeries::~mvStairSeries()
+	{
+		ResetSeriesPyramid(_pyramid);
+		ReleaseSeriesBuffers(_buffers, 2);
+	}
+
 	void mvStairSeries::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvStairSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
+		_order.hint = titem->_order.hint;
+		_downsample = titem->_downsample;
+		_capacity = titem->_capacity;
+		_lod = titem->_lod;
 	}
 
 	PyObject* mvStairSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 2, _ringOffset);
 	}
 
 	void mvStairSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		ResetSeriesPyramid(_pyramid);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 2, value);
+		_ringOffset = 0;
+		SetSeriesCapacity(*_value, _capacity, _ringOffset);
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvStairSeries::setDataSource(mvUUID dataSource)
@@ -49,7 +65,10 @@ namespace Marvel {
 				"Values types do not match: " + std::to_string(dataSource), this);
 			return;
 		}
+		ResetSeriesPyramid(_pyramid);
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvStairSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -84,13 +103,52 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* yptr;
-
-			xptr = &(*_value.get())[0];
-			yptr = &(*_value.get())[1];
-
-			ImPlot::PlotStairs(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+			mvSeriesChannel channels[] = { GetSeriesChannel(_buffers[0], (*_value)[0], _ringOffset), GetSeriesChannel(_buffers[1], (*_value)[1], _ringOffset) };
+
+			// sorted x only needs the visible range
+			i32 count = std::min(channels[0].count, channels[1].count);
+			i32 first = 0;
+			i32 visible = count;
+			b8 sorted = IsSeriesSorted(_order, channels[0]);
+			if (sorted)
+				GetVisibleRange(channels[0], first, visible);
+
+			// pyramid level matching the pixel density, once built; rings shift
+			// every index once wrapped and source values belong to another series
+			const mvPyramidSample* lodSamples = nullptr;
+			i32 lodCount = 0;
+			b8 lod = _lod && sorted && _capacity == 0 && _source == 0
+				&& GetSeriesPyramidLevel(_pyramid, channels[0], channels[1], count, first, visible, lodSamples, lodCount);
+
+			if (lod)
+				ImPlot::PlotStairs(_internalLabel.c_str(), &lodSamples->x, &lodSamples->y, lodCount, 0, sizeof(mvPyramidSample));
+			else if (DecimateSeries(_decimation, _downsample, channels, 2, first, visible))
+			{
+				const auto& values = _decimation.values;
+				ImPlot::PlotStairs(_internalLabel.c_str(), values[0].data(), values[1].data(), (int)values[0].size());
+			}
+			else if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+					{
+						ImPlot::PlotStairs(_internalLabel.c_str(), xs, ys, count, 0, stride);
+					}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible));
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* yptr;
+
+				xptr = &(*_value.get())[0];
+				yptr = &(*_value.get())[1];
+
+				// a visible range wrapping around the ring is drawn whole
+				i32 start = GetRingRangeStart(first, visible, _ringOffset, (i32)xptr->size());
+				if (start >= 0)
+					ImPlot::PlotStairs(_internalLabel.c_str(), xptr->data() + start, yptr->data() + start, visible);
+				else
+					ImPlot::PlotStairs(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size(), _ringOffset);
+			}
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -148,11 +206,11 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
 				break;
 
 			default:
@@ -166,14 +224,75 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y")) { (*_value)[1] = ToDoubleVect(item); }
+		// unroll appended data before it is replaced or resized
+		b8 ringChanged = PyDict_GetItemString(dict, "capacity") || PyDict_GetItemString(dict, "x") || PyDict_GetItemString(dict, "y");
+		if (ringChanged) SetSeriesCapacity(*_value, 0, _ringOffset);
+
+		// the pyramid reads the data about to change
+		if (ringChanged || PyDict_GetItemString(dict, "zero_copy") || PyDict_GetItemString(dict, "lod"))
+			ResetSeriesPyramid(_pyramid);
+
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sorted_x")) _order.hint = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "downsample")) _downsample = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "capacity")) _capacity = ToInt(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "lod")) _lod = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y")) { SetSeriesChannel(_buffers[1], (*_value)[1], item); }
+
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, 2);
+		if (ringChanged) SetSeriesCapacity(*_value, _capacity, _ringOffset);
+
+		_decimation.dirty = true;
+		_order.known = false;
 	}
 
 	void mvStairSeries::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+		PyDict_SetItemString(dict, "sorted_x", mvPyObject(ToPyBool(_order.hint)));
+		PyDict_SetItemString(dict, "downsample", mvPyObject(ToPyInt(_downsample)));
+		PyDict_SetItemString(dict, "capacity", mvPyObject(ToPyInt(_capacity)));
+		PyDict_SetItemString(dict, "lod", mvPyObject(ToPyBool(_lod)));
+	}
+
+	void mvStairSeries::getSpecificInfo(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		PyDict_SetItemString(dict, "lod_levels", mvPyObject(ToPyInt((i32)_pyramid.levels.size())));
+		PyDict_SetItemString(dict, "lod_memory", mvPyObject(ToPyLong((long)GetSeriesPyramidBytes(_pyramid))));
 	}
 
+	void mvStairSeries::renderSpecificDebugInfo()
+	{
+		ImGui::Text("LOD Levels: %d", (i32)_pyramid.levels.size());
+		ImGui::Text("LOD Memory: %zu bytes", GetSeriesPyramidBytes(_pyramid));
+	}
+
+
+	void mvStairSeries::appendData(const std::vector<f64>& x, const std::vector<f64>& y)
+	{
+		// a pending pyramid build reads the storage about to grow
+		if (_pyramid.job.valid())
+			ResetSeriesPyramid(_pyramid);
+
+		// appending switches a zero copy series to owned storage
+		ResolveSeriesBuffers(false, _buffers, *_value, 2);
+		UpdateSeriesOrder(_order, GetSeriesChannel(_buffers[0], (*_value)[0], _ringOffset), x);
+		AppendSeriesData(*_value, _capacity, _ringOffset, x, y);
+		_decimation.dirty = true;
+
+		// rings are drawn without the pyramid (see draw)
+		if (_capacity != 0)
+			return;
+
+		const auto& values = *_value;
+		ExtendSeriesPyramid(_pyramid, GetSeriesChannel(_buffers[0], values[0]), GetSeriesChannel(_buffers[1], values[1]),
+			(i32)std::min(values[0].size(), values[1].size()));
+	}
 }
\ No newline at end of file
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
+#include "mvSeriesPyramid.h"
 
 namespace Marvel {
 
@@ -10,12 +13,18 @@ namespace Marvel {
     public:
 
         explicit mvStairSeries(mvUUID uuid);
+        ~mvStairSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
         void handleSpecificKeywordArgs(PyObject* dict) override;
         void getSpecificConfiguration(PyObject* dict) override;
         void applySpecificTemplate(mvAppItem* item) override;
+        void getSpecificInfo(PyObject* dict) override;
+        void renderSpecificDebugInfo() override;
+
+        // append_series_data
+        void appendData(const std::vector<f64>& x, const std::vector<f64>& y);
 
         // values
         void setDataSource(mvUUID dataSource) override;
@@ -32,6 +41,16 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+        i32            _capacity = 0;   // ring buffer size for appended data (0 = unbounded)
+        i32            _ringOffset = 0; // index of the oldest sample
+        i32            _downsample = mvPlotDownsample_None;
+        mvSeriesDecimation _decimation; // cached downsampled data
+        mvSeriesOrder  _order;
+        b8             _lod = false;
+        mvSeriesPyramid _pyramid;     // min/max levels (lod)
+
     };
 
 }
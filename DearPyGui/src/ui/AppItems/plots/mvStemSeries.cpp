@@ -15,20 +15,28 @@ namespace Marvel {
 	{
 	}
 
+	mvStemSeries::~mvStemSeries()
+	{
+		ReleaseSeriesBuffers(_buffers, 2);
+	}
+
 	void mvStemSeries::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvStemSeries*>(item);
 		if(_source != 0) _value = titem->_value;
+		_zeroCopy = titem->_zeroCopy;
+		_order.hint = titem->_order.hint;
 	}
 
 	PyObject* mvStemSeries::getPyValue()
 	{
-		return ToPyList(*_value);
+		return ToPyList(_buffers, *_value, 2);
 	}
 
 	void mvStemSeries::setPyValue(PyObject* value)
 	{
-		*_value = ToVectVectDouble(value);
+		SetSeriesPyValue(_zeroCopy, _buffers, *_value, 2, value);
+		_order.known = false;
 	}
 
 	void mvStemSeries::setDataSource(mvUUID dataSource)
@@ -50,6 +58,7 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<std::vector<double>>>*>(item->getValue());
+		_order.known = false;
 	}
 
 	void mvStemSeries::draw(ImDrawList* drawlist, float x, float y)
@@ -84,13 +93,31 @@ namespace Marvel {
 		//-----------------------------------------------------------------------------
 		{
 
-			static const std::vector<double>* xptr;
-			static const std::vector<double>* yptr;
+			mvSeriesChannel channels[] = { GetSeriesChannel(_buffers[0], (*_value)[0]), GetSeriesChannel(_buffers[1], (*_value)[1]) };
 
-			xptr = &(*_value.get())[0];
-			yptr = &(*_value.get())[1];
+			// sorted x only needs the visible range
+			i32 first = 0;
+			i32 visible = std::min(channels[0].count, channels[1].count);
+			if (IsSeriesSorted(_order, channels[0]))
+				GetVisibleRange(channels[0], first, visible);
 
-			ImPlot::PlotStems(_internalLabel.c_str(), xptr->data(), yptr->data(), (int)xptr->size());
+			if (SeriesBuffersCompatible(_buffers[0], _buffers[1]))
+			{
+				VisitSeriesBuffers([&](i32 count, i32 stride, auto xs, auto ys)
+					{
+						ImPlot::PlotStems(_internalLabel.c_str(), xs, ys, count, 0.0, 0, stride);
+					}, SliceSeriesBuffer(_buffers[0], first, visible), SliceSeriesBuffer(_buffers[1], first, visible));
+			}
+			else
+			{
+				static const std::vector<double>* xptr;
+				static const std::vector<double>* yptr;
+
+				xptr = &(*_value.get())[0];
+				yptr = &(*_value.get())[1];
+
+				ImPlot::PlotStems(_internalLabel.c_str(), xptr->data() + first, yptr->data() + first, visible);
+			}
 
 			// Begin a popup for a legend entry.
 			if (ImPlot::BeginLegendPopup(_internalLabel.c_str(), 1))
@@ -148,11 +175,11 @@ namespace Marvel {
 			switch (i)
 			{
 			case 0:
-				(*_value)[0] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[0], (*_value)[0], item);
 				break;
 
 			case 1:
-				(*_value)[1] = ToDoubleVect(item);
+				SetSeriesChannel(_buffers[1], (*_value)[1], item);
 				break;
 
 			default:
@@ -166,14 +193,23 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
-		if (PyObject* item = PyDict_GetItemString(dict, "x")) { (*_value)[0] = ToDoubleVect(item); }
-		if (PyObject* item = PyDict_GetItemString(dict, "y")) { (*_value)[1] = ToDoubleVect(item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "zero_copy")) _zeroCopy = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sorted_x")) _order.hint = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "x")) { SetSeriesChannel(_buffers[0], (*_value)[0], item); }
+		if (PyObject* item = PyDict_GetItemString(dict, "y")) { SetSeriesChannel(_buffers[1], (*_value)[1], item); }
+
+		ResolveSeriesBuffers(_zeroCopy, _buffers, *_value, 2);
+
+		_order.known = false;
 	}
 
 	void mvStemSeries::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "zero_copy", mvPyObject(ToPyBool(_zeroCopy)));
+		PyDict_SetItemString(dict, "sorted_x", mvPyObject(ToPyBool(_order.hint)));
 	}
 
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvPlot.h"
+#include "mvSeriesBuffer.h"
+#include "mvSeriesDecimation.h"
 
 namespace Marvel {
 
@@ -10,6 +12,7 @@ namespace Marvel {
     public:
 
         explicit mvStemSeries(mvUUID uuid);
+        ~mvStemSeries();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* args) override;
@@ -32,6 +35,10 @@ namespace Marvel {
             std::vector<double>{},
             std::vector<double>{} });
 
+        b8             _zeroCopy = false;
+        mvSeriesBuffer _buffers[2]; // referenced x/y buffers (zero_copy)
+        mvSeriesOrder  _order;
+
     };
 
 }
@@ -5,16 +5,135 @@
 #include "mvTableColumn.h"
 #include "mvPyObject.h"
 #include "mvPythonExceptions.h"
+#include "mvGlobalIntepreterLock.h"
 #include "fonts/mvFont.h"
 #include "themes/mvTheme.h"
 
 namespace Marvel {
 
+	// cell of a row item at a table column, tooltips don't take a column
+	mv_internal mvAppItem*
+	GetRowCell(mvAppItem* row, int column)
+	{
+		int column_index = -1;
+		for (auto& cell : row->_children[1])
+		{
+			if (cell->_type == mvAppItemType::mvTooltip)
+				continue;
+			if (++column_index == column)
+				return cell.get();
+		}
+		return nullptr;
+	}
+
+	// the cell's filter_key if set, otherwise its value or label,
+	// returns true if the key is a number
+	mv_internal b8
+	GetCellSortKey(mvAppItem* cell, std::string& text, f64& number)
+	{
+		if (cell && cell->_type == mvAppItemType::mvTableCell)
+			cell = cell->_children[1].empty() ? nullptr : cell->_children[1][0].get();
+
+		if (cell == nullptr)
+			return false;
+
+		if (!cell->_filter.empty())
+		{
+			text = cell->_filter;
+			return false;
+		}
+
+		if (void* value = cell->getValue())
+		{
+			switch (GetEntityValueType(cell->_type))
+			{
+			case StorageValueTypes::String: text = **static_cast<mvRef<std::string>*>(value); return false;
+			case StorageValueTypes::Int:    number = (f64)**static_cast<mvRef<int>*>(value); return true;
+			case StorageValueTypes::Float:  number = (f64)**static_cast<mvRef<float>*>(value); return true;
+			case StorageValueTypes::Double: number = **static_cast<mvRef<double>*>(value); return true;
+			default: break;
+			}
+		}
+
+		text = cell->_specifiedLabel;
+		return false;
+	}
+
+	mv_internal void
+	GetRowItemsSortKey(const std::vector<mvRef<mvAppItem>>& rows, int column, i32 keyType, mvTableSortColumn& key)
+	{
+		std::vector<std::string> strings(rows.size());
+		std::vector<f64> numbers(rows.size(), 0.0);
+		std::vector<b8> isNumber(rows.size(), false);
+
+		b8 allNumbers = true;
+		for (size_t i = 0; i < rows.size(); i++)
+		{
+			isNumber[i] = GetCellSortKey(GetRowCell(rows[i].get(), column), strings[i], numbers[i]);
+			allNumbers = allNumbers && isNumber[i];
+		}
+
+		key.isText = keyType == mvTableSortKey_Text || (keyType == mvTableSortKey_Auto && !allNumbers);
+		if (key.isText)
+		{
+			char buffer[64];
+			for (size_t i = 0; i < rows.size(); i++)
+			{
+				if (!isNumber[i])
+					continue;
+				snprintf(buffer, sizeof(buffer), "%g", numbers[i]);
+				strings[i] = buffer;
+			}
+			key.strings = std::move(strings);
+			key.text.resize(rows.size());
+			for (size_t i = 0; i < rows.size(); i++)
+				key.text[i] = key.strings[i].c_str();
+		}
+		else
+		{
+			for (size_t i = 0; i < rows.size(); i++)
+			{
+				if (!isNumber[i])
+					numbers[i] = ParseTableSortNumber(strings[i].c_str());
+			}
+			key.numbers = std::move(numbers);
+		}
+	}
+
+	void
+	InvalidateTableSort(mvAppItem* cell)
+	{
+		// item -> table_cell -> row -> table
+		mvAppItem* item = cell;
+		for (int i = 0; i < 3 && item; i++)
+		{
+			item = item->_parentPtr;
+			if (item && item->_type == mvAppItemType::mvTable)
+			{
+				static_cast<mvTable*>(item)->_sortDirty = static_cast<mvTable*>(item)->_filterDirty = true;
+				return;
+			}
+		}
+	}
+
 	mvTable::mvTable(mvUUID uuid)
 		: mvAppItem(uuid)
 	{
 	}
 
+	mvTable::~mvTable()
+	{
+		// only referenced buffers need the gil
+		b8 held = false;
+		for (const auto& column : _data.columns)
+			held = held || column.buffer.object != nullptr;
+		if (!held)
+			return;
+
+		mvGlobalIntepreterLock gil;
+		ReleaseTableData(_data);
+	}
+
 	void mvTable::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvTable*>(item);
@@ -24,6 +143,84 @@ namespace Marvel {
 		_freezeColumns = titem->_freezeColumns;
 		_flags = titem->_flags;
 		_tableHeader = titem->_tableHeader;
+		_nativeSort = titem->_nativeSort;
+	}
+
+	void mvTable::sortRows(const ImGuiTableSortSpecs* specs)
+	{
+		int rows = _data.columns.empty() ? (int)_children[1].size() : _data.rows;
+
+		_sortDirty = false;
+		_filterDirty = true;
+		_viewRows = rows;
+		_sortedRows.clear();
+
+		if (!_nativeSort || specs == nullptr || specs->SpecsCount == 0)
+			return;
+
+		std::vector<mvTableSortColumn> keys(specs->SpecsCount);
+		for (int i = 0; i < specs->SpecsCount; i++)
+		{
+			const ImGuiTableColumnSortSpecs& spec = specs->Specs[i];
+			mvTableSortColumn& key = keys[i];
+			key.descending = spec.SortDirection == ImGuiSortDirection_Descending;
+
+			int keyType = mvTableSortKey_Auto;
+			for (auto& column : _children[0])
+			{
+				if (static_cast<mvTableColumn*>(column.get())->_id == spec.ColumnUserID)
+					keyType = static_cast<mvTableColumn*>(column.get())->_sortKey;
+			}
+
+			if (_data.columns.empty())
+				GetRowItemsSortKey(_children[1], spec.ColumnIndex, keyType, key);
+			else if (spec.ColumnIndex < (int)_data.columns.size())
+				GetTableDataSortKey(_data.columns[spec.ColumnIndex], rows, keyType, key);
+			else
+				key.numbers.resize(rows, 0.0);
+		}
+
+		_sortedRows.resize(rows);
+		for (int i = 0; i < rows; i++)
+			_sortedRows[i] = i;
+		SortTableRows(_sortedRows, keys);
+	}
+
+	void mvTable::filterRows()
+	{
+		int rows = _data.columns.empty() ? (int)_children[1].size() : _data.rows;
+
+		_filterDirty = false;
+		_visibleRows.clear();
+
+		if (!_imguiFilter.IsActive())
+			return;
+
+		// data rows are matched on all their cells
+		std::string line;
+		char buffer[64];
+
+		for (int i = 0; i < rows; i++)
+		{
+			int row = _sortedRows.empty() ? i : _sortedRows[i];
+
+			b8 pass = false;
+			if (_data.columns.empty())
+				pass = _imguiFilter.PassFilter(_children[1][row]->_filter.c_str());
+			else
+			{
+				line.clear();
+				for (const auto& column : _data.columns)
+				{
+					line += FormatTableDataCell(column, row, buffer, sizeof(buffer));
+					line += ' ';
+				}
+				pass = _imguiFilter.PassFilter(line.c_str(), line.c_str() + line.size());
+			}
+
+			if (pass)
+				_visibleRows.push_back(row);
+		}
 	}
 
 	void mvTable::draw(ImDrawList* drawlist, float x, float y)
@@ -89,7 +286,16 @@ namespace Marvel {
 					if (_cellColorsSet[row_index][column_index])
 						ImGui::TableSetBgColor(ImGuiTableBgTarget_CellBg, _cellColors[row_index][column_index]);
 
+					// edited through the ui, resorted next frame (read below, so
+					// captured even with lazy_item_state)
+					mvAppItem* edited = cell->_type == mvAppItemType::mvTableCell && !cell->_children[1].empty()
+						? cell->_children[1][0].get() : cell.get();
+					RequestAppItemState(edited->_state);
+
 					cell->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
+
+					if (edited->_state.edited)
+						_sortDirty = _filterDirty = true;
 				}
 			};
 
@@ -114,7 +320,21 @@ namespace Marvel {
 				if (_tableHeader)
 					ImGui::TableHeadersRow();
 
-				if (ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs())
+				// rows added or removed since the cached order was built
+				int rowCount = _data.columns.empty() ? (int)_children[1].size() : _data.rows;
+				if (rowCount != _viewRows)
+					_sortDirty = _filterDirty = true;
+
+				if (_nativeSort)
+				{
+					ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs();
+					if (_sortDirty || (sorts_specs && sorts_specs->SpecsDirty))
+						sortRows(sorts_specs);
+					if (sorts_specs)
+						sorts_specs->SpecsDirty = false;
+				}
+
+				else if (ImGuiTableSortSpecs* sorts_specs = ImGui::TableGetSortSpecs())
 				{
 					if (sorts_specs->SpecsDirty)
 					{
@@ -156,36 +376,66 @@ namespace Marvel {
 					}
 				}
 
-				if (_rows != 0)
+				if (_filterDirty)
+				{
+					_viewRows = rowCount;
+					filterRows();
+				}
+
+				// display order, null if rows are drawn as they are
+				const std::vector<int>* order = _imguiFilter.IsActive() ? &_visibleRows
+					: !_sortedRows.empty() ? &_sortedRows : nullptr;
+				int displayCount = order ? (int)order->size() : rowCount;
+
+				if (!_data.columns.empty())
 				{
+					// virtual rows, only the visible ones are formatted
+					int columns = std::min(_columns, (int)_data.columns.size());
+					char buffer[64];
 
-					if (_imguiFilter.IsActive())
+					ImGuiListClipper clipper;
+					clipper.Begin(displayCount);
+					while (clipper.Step())
 					{
-						for (auto& row : _children[1])
+						for (int display_index = clipper.DisplayStart; display_index < clipper.DisplayEnd; display_index++)
 						{
-							if (!_imguiFilter.PassFilter(row->_filter.c_str()))
-								continue;
-							row_renderer(row.get());
+							int row_index = order ? (*order)[display_index] : display_index;
+							ImGui::TableNextRow();
+							for (int column_index = 0; column_index < columns; column_index++)
+							{
+								if (!ImGui::TableSetColumnIndex(column_index))
+									continue;
+
+								if (_columnColorsSet[column_index])
+									ImGui::TableSetBgColor(ImGuiTableBgTarget_CellBg, _columnColors[column_index]);
+
+								ImGui::TextUnformatted(FormatTableDataCell(_data.columns[column_index], row_index, buffer, sizeof(buffer)));
+							}
 						}
 					}
+					clipper.End();
+				}
+
+				else if (_rows != 0)
+				{
 
-					else if (_useClipper)
+					if (_useClipper)
 					{
 						ImGuiListClipper clipper;
-						clipper.Begin((int)_children[1].size());
+						clipper.Begin(displayCount);
 
 						while (clipper.Step())
 						{
 							for (int row_n = clipper.DisplayStart; row_n < clipper.DisplayEnd; row_n++)
-								row_renderer(_children[1][row_n].get());
+								row_renderer(_children[1][order ? (*order)[row_n] : row_n].get());
 
 						}
 						clipper.End();
 					}
 					else
 					{
-						for (auto& row : _children[1])
-							row_renderer(row.get());
+						for (int row_n = 0; row_n < displayCount; row_n++)
+							row_renderer(_children[1][order ? (*order)[row_n] : row_n].get());
 					}
 				}
 
@@ -219,6 +469,7 @@ namespace Marvel {
 
 	void mvTable::onChildAdd(mvRef<mvAppItem> item)
 	{
+		_sortDirty = _filterDirty = true;
 
 		if (item->_type == mvAppItemType::mvTableColumn)
 		{
@@ -247,6 +498,7 @@ namespace Marvel {
 
 	void mvTable::onChildRemoved(mvRef<mvAppItem> item)
 	{
+		_sortDirty = _filterDirty = true;
 		if (item->_type == mvAppItemType::mvTableColumn)
 			_columns--;
 		else if (item->_type == mvAppItemType::mvTableRow)
@@ -287,6 +539,7 @@ namespace Marvel {
 
 	void mvTable::onChildrenRemoved()
 	{
+		_sortDirty = _filterDirty = true;
 		_columns = (int)_children[0].size();
 		_rows = (int)_children[1].size();
 
@@ -321,6 +574,12 @@ namespace Marvel {
 		if (PyObject* item = PyDict_GetItemString(dict, "header_row")) _tableHeader = ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(dict, "clipper")) _useClipper = ToBool(item);
 		if (PyObject* item = PyDict_GetItemString(dict, "inner_width")) _inner_width = (int)ToFloat(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "native_sort"))
+		{
+			_nativeSort = ToBool(item);
+			_sortedRows.clear();
+			_sortDirty = _filterDirty = true;
+		}
 
 		// helper for bit flipping
 		auto flagop = [dict](const char* keyword, int flag, int& flags)
@@ -388,12 +647,14 @@ namespace Marvel {
 		mvPyObject py_inner_width = ToPyInt(_inner_width);
 		mvPyObject py_header_row = ToPyBool(_tableHeader);
 		mvPyObject py_clipper = ToPyBool(_useClipper);
+		mvPyObject py_native_sort = ToPyBool(_nativeSort);
 
 		PyDict_SetItemString(dict, "freeze_rows", py_freeze_rows);
 		PyDict_SetItemString(dict, "freeze_columns", py_freeze_columns);
 		PyDict_SetItemString(dict, "inner_width", py_inner_width);
 		PyDict_SetItemString(dict, "header_row", py_header_row);
 		PyDict_SetItemString(dict, "clipper", py_clipper);
+		PyDict_SetItemString(dict, "native_sort", py_native_sort);
 
 		// helper to check and set bit
 		auto checkbitset = [dict](const char* keyword, int flag, const int& flags)
@@ -462,6 +723,7 @@ namespace Marvel {
 		}
 		_imguiFilter.InputBuf[i] = 0;
 		_imguiFilter.Build();
+		_filterDirty = true;
 	}
 
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvItemRegistry.h"
+#include "mvTableData.h"
+#include "mvTableSort.h"
 #include <vector>
 
 namespace Marvel {
@@ -11,6 +13,7 @@ namespace Marvel {
     public:
 
         explicit mvTable(mvUUID uuid);
+        ~mvTable();
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificKeywordArgs(PyObject* dict) override;
@@ -18,12 +21,17 @@ namespace Marvel {
         void onChildAdd(mvRef<mvAppItem> item) override;
         void onChildRemoved(mvRef<mvAppItem> item) override;
         void onChildrenRemoved() override;
+        void onChildrenReordered() override { _sortDirty = _filterDirty = true; } // cached row order holds positions
         void applySpecificTemplate(mvAppItem* item) override;
 
         // values
         PyObject* getPyValue() override;
         void setPyValue(PyObject* value) override;
 
+        // built-in sort and cached filter, only called when dirty
+        void sortRows(const ImGuiTableSortSpecs* specs);
+        void filterRows();
+
     public:
 
         ImGuiTextFilter _imguiFilter;
@@ -37,6 +45,18 @@ namespace Marvel {
         bool _tableHeader = true;
         bool _useClipper = false;
 
+        bool _nativeSort = false;
+
+        // set_table_data, rows are drawn from _data instead of row items
+        mvTableData _data;
+
+        // rows (indices into _children[1] or _data) in display order
+        std::vector<int> _sortedRows;  // empty if not sorted natively
+        std::vector<int> _visibleRows; // rows passing the filter, in sorted order
+        int  _viewRows = 0;            // row count the two above were built for
+        bool _sortDirty = true;
+        bool _filterDirty = true;
+
         std::vector<bool> _columnColorsSet;
         std::vector<bool> _rowColorsSet;
         std::vector<bool> _rowSelectionColorsSet;
@@ -55,4 +75,8 @@ namespace Marvel {
         
     };
 
+    // the value, filter_key or label of a row item's cell (or of the item in a
+    // table_cell) changed: the native sort and filter are rebuilt next frame
+    void InvalidateTableSort(mvAppItem* cell);
+
 }
@@ -18,6 +18,7 @@ namespace Marvel {
 		auto titem = static_cast<mvTableColumn*>(item);
 		_flags = titem->_flags;
 		_init_width_or_weight = titem->_init_width_or_weight;
+		_sortKey = titem->_sortKey;
 	}
 
 	void mvTableColumn::draw(ImDrawList* drawlist, float x, float y)
@@ -44,6 +45,12 @@ namespace Marvel {
 			return;
 
 		if (PyObject* item = PyDict_GetItemString(dict, "init_width_or_weight")) _init_width_or_weight = ToFloat(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "sort_key"))
+		{
+			_sortKey = ToInt(item);
+			if (_parentPtr && _parentPtr->_type == mvAppItemType::mvTable)
+				static_cast<mvTable*>(_parentPtr)->_sortDirty = true;
+		}
 
 		// helper for bit flipping
 		auto flagop = [dict](const char* keyword, int flag, int& flags)
@@ -78,6 +85,7 @@ namespace Marvel {
 		mvPyObject py_init_width_or_weight = ToPyFloat(_init_width_or_weight);
 
 		PyDict_SetItemString(dict, "init_width_or_weight", py_init_width_or_weight);
+		PyDict_SetItemString(dict, "sort_key", mvPyObject(ToPyInt(_sortKey)));
 
 		// helper to check and set bit
 		auto checkbitset = [dict](const char* keyword, int flag, const int& flags)
@@ -22,6 +22,7 @@ namespace Marvel {
         ImGuiTableColumnFlags _flags = 0;
         float _init_width_or_weight = 0.0f;
         ImGuiID _id = 0u;
+        int _sortKey = 0; // mvTableSortKey, used by tables with native_sort
 
     };
 
@@ -0,0 +1,212 @@
+#include "mvTableData.h"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include "mvPythonTranslator.h"
+
+namespace Marvel {
+
+	mv_internal b8
+	IsIntegralBuffer(const mvSeriesBuffer& buffer)
+	{
+		return buffer.object && buffer.type != mvSeriesBufferType::Float && buffer.type != mvSeriesBufferType::Double;
+	}
+
+	mv_internal void
+	SetTableDataText(mvTableDataColumn& column, PyObject* sequence)
+	{
+		Py_ssize_t count = PySequence_Fast_GET_SIZE(sequence);
+		PyObject** items = PySequence_Fast_ITEMS(sequence);
+
+		column.offsets.reserve((size_t)count);
+		for (Py_ssize_t i = 0; i < count; i++)
+		{
+			PyObject* str = PyUnicode_Check(items[i]) ? items[i] : PyObject_Str(items[i]);
+			Py_ssize_t length = 0;
+			const char* utf8 = str ? PyUnicode_AsUTF8AndSize(str, &length) : nullptr;
+			if (utf8 == nullptr)
+			{
+				PyErr_Clear();
+				utf8 = "";
+				length = 0;
+			}
+
+			column.offsets.push_back(column.text.size());
+			column.text.insert(column.text.end(), utf8, utf8 + length);
+			column.text.push_back(0);
+
+			if (str != items[i])
+				Py_XDECREF(str);
+		}
+	}
+
+	mv_internal b8
+	SetTableDataColumn(mvTableDataColumn& column, PyObject* value)
+	{
+		if (SetSeriesBuffer(column.buffer, value))
+		{
+			column.integral = IsIntegralBuffer(column.buffer);
+			return true;
+		}
+
+		if (PyList_Check(value) || PyTuple_Check(value))
+		{
+			PyObject** items = PySequence_Fast_ITEMS(value);
+			Py_ssize_t count = PySequence_Fast_GET_SIZE(value);
+
+			// numeric only if every cell is a number, anything else makes
+			// the whole column text (str() of every cell)
+			b8 numeric = true;
+			b8 integral = count > 0;
+			for (Py_ssize_t i = 0; i < count && numeric; i++)
+			{
+				numeric = !PyUnicode_Check(items[i]) && PyNumber_Check(items[i]);
+				integral = integral && PyLong_Check(items[i]);
+			}
+
+			if (numeric)
+			{
+				column.numbers = ToDoubleVect(value, "Table data columns must be buffers, lists or tuples.");
+				column.integral = integral;
+			}
+
+			// i.e. numbers that don't fit a double
+			if (!numeric || PyErr_Occurred())
+			{
+				PyErr_Clear();
+				column.numbers.clear();
+				column.integral = false;
+				column.isText = true;
+				SetTableDataText(column, value);
+			}
+			return true;
+		}
+
+		if (!PyObject_CheckBuffer(value))
+			return false;
+
+		// buffers SetSeriesBuffer can't reference (i.e. 2D), copied
+		column.numbers = ToDoubleVect(value, "Table data columns must be buffers, lists or tuples.");
+		if (PyErr_Occurred())
+		{
+			PyErr_Clear();
+			return false;
+		}
+		return true;
+	}
+
+	b8
+	IsTableDataFormat(const std::string& format)
+	{
+		// exactly one conversion, and it must take a double
+		i32 conversions = 0;
+		for (size_t i = 0; i < format.size(); i++)
+		{
+			if (format[i] != '%')
+				continue;
+
+			if (i + 1 < format.size() && format[i + 1] == '%')
+			{
+				i++;
+				continue;
+			}
+
+			size_t j = i + 1;
+			while (j < format.size() && std::strchr("-+ #0123456789.", format[j]))
+				j++;
+			if (j == format.size() || !std::strchr("fFeEgGaA", format[j]))
+				return false;
+			conversions++;
+			i = j;
+		}
+		return conversions == 1;
+	}
+
+	b8
+	SetTableData(mvTableData& data, PyObject* columns, const std::vector<std::string>& formats)
+	{
+		ReleaseTableData(data);
+
+		if (columns == nullptr || !(PyList_Check(columns) || PyTuple_Check(columns)))
+			return false;
+
+		PyObject** items = PySequence_Fast_ITEMS(columns);
+		Py_ssize_t count = PySequence_Fast_GET_SIZE(columns);
+
+		data.columns.resize((size_t)count);
+		for (Py_ssize_t i = 0; i < count; i++)
+		{
+			mvTableDataColumn& column = data.columns[i];
+			if (!SetTableDataColumn(column, items[i]))
+			{
+				ReleaseTableData(data);
+				return false;
+			}
+			if ((size_t)i < formats.size() && !formats[i].empty())
+				column.format = formats[i];
+
+			i32 rows = column.buffer.object ? column.buffer.count
+				: column.isText ? (i32)column.offsets.size() : (i32)column.numbers.size();
+			data.rows = i == 0 ? rows : std::min(data.rows, rows);
+		}
+		return true;
+	}
+
+	void
+	ReleaseTableData(mvTableData& data)
+	{
+		for (auto& column : data.columns)
+			ReleaseSeriesBuffer(column.buffer);
+		data.columns.clear();
+		data.columns.shrink_to_fit();
+		data.rows = 0;
+	}
+
+	const char*
+	FormatTableDataCell(const mvTableDataColumn& column, i32 row, char* buffer, size_t size)
+	{
+		if (column.isText)
+			return column.text.data() + column.offsets[row];
+
+		f64 value = column.buffer.object ? GetSeriesBufferValue(column.buffer, row) : column.numbers[row];
+		const char* format = !column.format.empty() ? column.format.c_str() : column.integral ? "%.0f" : "%g";
+		std::snprintf(buffer, size, format, value);
+		return buffer;
+	}
+
+	void
+	GetTableDataSortKey(const mvTableDataColumn& column, i32 rows, i32 keyType, mvTableSortColumn& key)
+	{
+		key.isText = keyType == mvTableSortKey_Text || (keyType == mvTableSortKey_Auto && column.isText);
+
+		if (key.isText && column.isText)
+		{
+			// straight from the column store
+			key.text.resize((size_t)rows);
+			for (i32 i = 0; i < rows; i++)
+				key.text[i] = column.text.data() + column.offsets[i];
+		}
+		else if (key.isText)
+		{
+			char buffer[64];
+			key.strings.resize((size_t)rows);
+			key.text.resize((size_t)rows);
+			for (i32 i = 0; i < rows; i++)
+				key.strings[i] = FormatTableDataCell(column, i, buffer, sizeof(buffer));
+			for (i32 i = 0; i < rows; i++)
+				key.text[i] = key.strings[i].c_str();
+		}
+		else
+		{
+			key.numbers.resize((size_t)rows);
+			for (i32 i = 0; i < rows; i++)
+			{
+				if (column.isText)
+					key.numbers[i] = ParseTableSortNumber(column.text.data() + column.offsets[i]);
+				else
+					key.numbers[i] = column.buffer.object ? GetSeriesBufferValue(column.buffer, i) : column.numbers[i];
+			}
+		}
+	}
+
+}
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "plots/mvSeriesBuffer.h"
+#include "mvTableSort.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvTableData
+    //     - columnar data a table draws rows from directly (set_table_data),
+    //       instead of one mvTableRow/mvTableCell item per cell
+    //     - numeric columns reference python buffers when possible (copied
+    //       to doubles otherwise), string columns are packed into one
+    //       character store per column
+    //     - only the rows made visible by the list clipper are formatted,
+    //       every frame, into a stack buffer
+    //     - acquiring/releasing buffers requires the GIL
+    //-----------------------------------------------------------------------------
+
+    struct mvTableDataColumn
+    {
+        mvSeriesBuffer      buffer;
+        std::vector<f64>    numbers;
+        std::vector<char>   text;    // null terminated cells, back to back
+        std::vector<size_t> offsets; // start of every cell in text
+        b8                  isText = false;
+        b8                  integral = false; // integer buffer or list of ints
+        std::string         format;           // empty picks %.0f or %g
+    };
+
+    struct mvTableData
+    {
+        std::vector<mvTableDataColumn> columns;
+        i32                            rows = 0; // shortest column
+    };
+
+    // columns is a list of buffers, numeric sequences or string sequences,
+    // formats an optional list of printf formats for numeric columns
+    b8          IsTableDataFormat  (const std::string& format); // a single double conversion
+    b8          SetTableData       (mvTableData& data, PyObject* columns, const std::vector<std::string>& formats); // false (and empty) if a column isn't a buffer or sequence
+    void        ReleaseTableData   (mvTableData& data);
+    const char* FormatTableDataCell(const mvTableDataColumn& column, i32 row, char* buffer, size_t size);
+    void        GetTableDataSortKey(const mvTableDataColumn& column, i32 rows, i32 keyType, mvTableSortColumn& key);
+
+}
@@ -1,4 +1,5 @@
 #include "mvTableRow.h"
+#include "mvTable.h"
 #include "mvContext.h"
 #include "mvCore.h"
 #include "mvLog.h"
@@ -13,4 +14,20 @@ namespace Marvel {
 
 	}
 
+	void mvTableRow::handleSpecificKeywordArgs(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		// the table caches which rows pass its filter
+		if (PyDict_GetItemString(dict, "filter_key") && _parentPtr && _parentPtr->_type == mvAppItemType::mvTable)
+			static_cast<mvTable*>(_parentPtr)->_filterDirty = true;
+	}
+
+	void mvTableRow::onChildrenReordered()
+	{
+		if (_parentPtr && _parentPtr->_type == mvAppItemType::mvTable)
+			_parentPtr->onChildrenReordered();
+	}
+
 }
\ No newline at end of file
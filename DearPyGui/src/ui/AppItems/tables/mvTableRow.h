@@ -14,6 +14,8 @@ namespace Marvel {
         explicit mvTableRow(mvUUID uuid);
 
         void draw(ImDrawList* drawlist, float x, float y) override {}
+        void handleSpecificKeywordArgs(PyObject* dict) override;
+        void onChildrenReordered() override; // cells moved, the table's sort keys changed
 
     private:
 
@@ -0,0 +1,116 @@
+#include "mvTableSort.h"
+#include <algorithm>
+#include <cmath>
+#include <cstdlib>
+#include <cstring>
+#include "mvContext.h"
+#include "mvThreadPool.h"
+
+namespace Marvel {
+
+	mv_internal constexpr size_t ParallelSortChunk = 1 << 15; // smaller sorts stay on the calling thread
+
+	mv_internal i32
+	CompareTableKeys(const mvTableSortColumn& key, i32 a, i32 b)
+	{
+		if (key.isText)
+			return std::strcmp(key.text[a], key.text[b]);
+
+		// nan after every number, in both directions
+		f64 x = key.numbers[a];
+		f64 y = key.numbers[b];
+		if (std::isnan(x) || std::isnan(y))
+			return (i32)std::isnan(x) - (i32)std::isnan(y);
+		return x < y ? -1 : (x > y ? 1 : 0);
+	}
+
+	f64
+	ParseTableSortNumber(const char* text)
+	{
+		char* end = nullptr;
+		f64 number = std::strtod(text, &end);
+		return end == text ? NAN : number;
+	}
+
+	void
+	SortTableRows(std::vector<i32>& order, const std::vector<mvTableSortColumn>& keys)
+	{
+		auto less = [&keys](i32 a, i32 b)
+		{
+			for (const auto& key : keys)
+			{
+				i32 result = CompareTableKeys(key, a, b);
+				if (result == 0)
+					continue;
+				b8 nan = !key.isText && (std::isnan(key.numbers[a]) || std::isnan(key.numbers[b]));
+				return key.descending && !nan ? result > 0 : result < 0;
+			}
+			return false;
+		};
+
+		if (order.size() <= ParallelSortChunk)
+		{
+			std::stable_sort(order.begin(), order.end(), less);
+			return;
+		}
+
+		// sorted chunks
+		std::vector<size_t> bounds;
+		for (size_t start = 0; start < order.size(); start += ParallelSortChunk)
+			bounds.push_back(start);
+		bounds.push_back(order.size());
+
+		// only idle workers get chunks, the rest run here, so a busy
+		// pool can't stall the render thread
+		mvThreadPool& pool = GetThreadPool();
+		size_t idle = pool.getIdleCount();
+		std::vector<std::future<void>> jobs;
+		for (size_t i = 0; i + 1 < bounds.size(); i++)
+		{
+			size_t first = bounds[i];
+			size_t last = bounds[i + 1];
+			if (jobs.size() < idle)
+			{
+				jobs.push_back(pool.submit([&order, &less, first, last]()
+					{
+						std::stable_sort(order.begin() + first, order.begin() + last, less);
+					}));
+			}
+			else
+				std::stable_sort(order.begin() + first, order.begin() + last, less);
+		}
+		for (auto& job : jobs)
+			job.wait();
+
+		// merging neighbours keeps it stable
+		while (bounds.size() > 2)
+		{
+			jobs.clear();
+			idle = pool.getIdleCount();
+			std::vector<size_t> merged;
+			size_t i = 0;
+			for (; i + 2 < bounds.size(); i += 2)
+			{
+				size_t first = bounds[i];
+				size_t middle = bounds[i + 1];
+				size_t last = bounds[i + 2];
+				if (jobs.size() < idle)
+				{
+					jobs.push_back(pool.submit([&order, &less, first, middle, last]()
+						{
+							std::inplace_merge(order.begin() + first, order.begin() + middle, order.begin() + last, less);
+						}));
+				}
+				else
+					std::inplace_merge(order.begin() + first, order.begin() + middle, order.begin() + last, less);
+				merged.push_back(first);
+			}
+			for (; i < bounds.size(); i++)
+				merged.push_back(bounds[i]);
+			for (auto& job : jobs)
+				job.wait();
+			bounds = std::move(merged);
+		}
+	}
+
+}
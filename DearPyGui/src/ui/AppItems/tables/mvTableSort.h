@@ -0,0 +1,43 @@
+#pragma once
+
+#include <vector>
+#include <string>
+#include "mvTypes.h"
+
+namespace Marvel {
+
+    //-----------------------------------------------------------------------------
+    // mvTableSort
+    //     - built-in row sorting for tables (native_sort keyword), used
+    //       instead of handing the sort specs to the callback
+    //     - keys are gathered once per sort column, indexed by row, so the
+    //       comparator never touches items or python objects
+    //     - stable and multi-column: the first key decides, the others only
+    //       break ties
+    //     - large sorts are split into chunks sorted on the thread pool,
+    //       then merged pairwise
+    //-----------------------------------------------------------------------------
+
+    enum mvTableSortKey
+    {
+        mvTableSortKey_Auto = 0, // numbers for numeric values, text otherwise
+        mvTableSortKey_Text,
+        mvTableSortKey_Number    // text is parsed, unparsable cells sort last
+    };
+
+    struct mvTableSortColumn
+    {
+        std::vector<f64>         numbers;
+        std::vector<std::string> strings; // owned text keys
+        std::vector<const char*> text;    // text keys, into strings or a column store
+        b8                       isText = false;
+        b8                       descending = false;
+    };
+
+    // must be called with GContext->mutex held (thread pool)
+    void SortTableRows(std::vector<i32>& order, const std::vector<mvTableSortColumn>& keys);
+
+    // nan if the text doesn't start with a number
+    f64  ParseTableSortNumber(const char* text);
+
+}
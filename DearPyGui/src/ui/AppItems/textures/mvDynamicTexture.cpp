@@ -3,6 +3,10 @@
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
 #include "mvUtilities.h"
+#include "mvTexturePixels.h"
+#include "mvGlobalIntepreterLock.h"
+#include "mvPyObject.h"
+#include "values/mvFloatVectValue.h"
 
 namespace Marvel {
 
@@ -16,26 +20,52 @@ namespace Marvel {
 	mvDynamicTexture::~mvDynamicTexture()
 	{
 		FreeTexture(_texture);
+
+		if (_pendingValue)
+		{
+			mvGlobalIntepreterLock gil;
+			Py_XDECREF(_pendingValue);
+		}
 	}
 
 	void mvDynamicTexture::applySpecificTemplate(mvAppItem* item)
 	{
 		auto titem = static_cast<mvDynamicTexture*>(item);
-		if(_source != 0) _value = titem->_value;
+		if (_source != 0)
+		{
+			_value = titem->_value;
+			_generation = titem->_generation;
+		}
 		_texture = titem->_texture;
+		_format = titem->_format;
+		_streaming = titem->_streaming;
 		_permWidth = titem->_permWidth;
 		_permHeight = titem->_permHeight;
 		_dirty = titem->_dirty;
+		_regions.rowCursor = titem->_regions.rowCursor;
 	}
 
 	PyObject* mvDynamicTexture::getPyValue()
 	{
+		if (!IsFloatTextureFormat(_format))
+			return ToPyTexturePixels(_pixels, _format);
 		return ToPyList(*_value);
 	}
 
 	void mvDynamicTexture::setPyValue(PyObject* value)
 	{
-		*_value = ToFloatVect(value);
+		if (IsFloatTextureFormat(_format))
+			*_value = ToFloatVect(value);
+		else
+		{
+			// short data is padded, the upload reads the whole surface
+			SetTexturePixels(_pixels, _format, value);
+			size_t size = (size_t)GetTextureFormatBytes(_permWidth, _permHeight, _format);
+			if (_pixels.size() < size)
+				_pixels.resize(size);
+		}
+		if (_generation)
+			(*_generation)++;
 	}
 
 	void mvDynamicTexture::setDataSource(mvUUID dataSource)
@@ -56,25 +86,88 @@ namespace Marvel {
 				"Values types do not match: " + std::to_string(dataSource), this);
 			return;
 		}
+		if (!IsFloatTextureFormat(_format) || !IsFloatTextureFormat(GetTextureItemFormat(item)))
+		{
+			mvThrowPythonError(mvErrorCode::mvSourceNotCompatible, "set_value",
+				"Only float textures can share values: " + std::to_string(dataSource), this);
+			return;
+		}
 		_value = *static_cast<std::shared_ptr<std::vector<float>>*>(item->getValue());
+
+		// other sources are uploaded every frame
+		if (item->_type == mvAppItemType::mvFloatVectValue)
+			_generation = static_cast<mvFloatVectValue*>(item)->getGeneration();
+		else if (item->_type == mvAppItemType::mvDynamicTexture)
+			_generation = static_cast<mvDynamicTexture*>(item)->getGeneration();
+		else
+			_generation = nullptr;
+		_uploadedGeneration = _generation ? *_generation - 1u : 0u;
 	}
 
 	void mvDynamicTexture::draw(ImDrawList* drawlist, float x, float y)
 	{
+		// created without keywords
+		if (_pendingValue)
+		{
+			mvGlobalIntepreterLock gil;
+			applyPendingValue();
+		}
+
+		const u8* data = getSurface();
+
 		if (_dirty)
 		{
 
-			_texture = LoadTextureFromArrayDynamic(_permWidth, _permHeight, _value->data());
+			_texture = LoadTextureFromArrayDynamic(_permWidth, _permHeight, data, _format, _streaming ? MaxPixelBuffers : 1u);
+			GContext->textureBytes += GetTextureFormatBytes(_permWidth, _permHeight, _format);
 
 			if (_texture == nullptr)
 				_state.ok = false;
 
+			_uploadedGeneration = _generation ? *_generation : 0u;
+			_regions.rects.clear();
 			_dirty = false;
 			return;
 		}
 
-		UpdateTexture(_texture, _permWidth, _permHeight, *_value);
+		// only upload changes, whole values or just the regions set
+		if (!_generation || *_generation != _uploadedGeneration)
+		{
+			UpdateTexture(_texture, _permWidth, _permHeight, data, _format);
+			GContext->textureBytes += GetTextureFormatBytes(_permWidth, _permHeight, _format);
+			if (_generation)
+				_uploadedGeneration = *_generation;
+			_regions.rects.clear();
+		}
+		else if (!_regions.rects.empty())
+			GContext->textureBytes += UploadTextureRegions(_regions, _texture, _permWidth, _permHeight, data, _format);
+
+	}
+
+	u8* mvDynamicTexture::getSurface()
+	{
+		// regions are written into, so it always covers the whole texture
+		size_t size = (size_t)GetTextureFormatBytes(_permWidth, _permHeight, _format);
+		if (IsFloatTextureFormat(_format))
+		{
+			if (_value->size() * sizeof(f32) < size)
+				_value->resize(size / sizeof(f32));
+			return reinterpret_cast<u8*>(_value->data());
+		}
+
+		if (_pixels.size() < size)
+			_pixels.resize(size);
+		return _pixels.data();
+	}
 
+	void mvDynamicTexture::setRegion(const mvTextureRect& rect, const u8* pixels)
+	{
+		WriteTextureRegion(_regions, getSurface(), _permWidth, _format, rect, pixels);
+	}
+
+	void mvDynamicTexture::pushRows(const u8* pixels, u32 rows)
+	{
+		PushTextureRows(_regions, getSurface(), _permWidth, _permHeight, _format, pixels, rows);
 	}
 
 	void mvDynamicTexture::handleSpecificRequiredArgs(PyObject* dict)
@@ -98,7 +191,9 @@ namespace Marvel {
 				break;
 
 			case 2:
-				*_value = ToFloatVect(item);
+				// the format keyword decides the conversion
+				Py_XINCREF(item);
+				_pendingValue = item;
 				break;
 
 			default:
@@ -112,12 +207,48 @@ namespace Marvel {
 		if (dict == nullptr)
 			return;
 
+		if (PyObject* item = PyDict_GetItemString(dict, "format"))
+		{
+			i32 format = ToInt(item);
+			if (format < 0 || format >= mvTextureFormat_Count)
+				mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(_type), "Unknown texture format.", this);
+			else if (format != _format && _texture)
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Texture format can only be set on creation.", this);
+			else if (format != _format && _source != 0 && !IsFloatTextureFormat(format))
+				mvThrowPythonError(mvErrorCode::mvSourceNotCompatible, GetEntityCommand(_type), "Only float textures can share values.", this);
+			else
+				_format = format;
+		}
+
+		if (PyObject* item = PyDict_GetItemString(dict, "streaming"))
+		{
+			bool streaming = ToBool(item);
+			if (streaming != _streaming && _texture)
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Texture streaming can only be set on creation.", this);
+			else
+				_streaming = streaming;
+		}
+
+		applyPendingValue();
 	}
 
 	void mvDynamicTexture::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "format", mvPyObject(ToPyInt(_format)));
+		PyDict_SetItemString(dict, "streaming", mvPyObject(ToPyBool(_streaming)));
+	}
+
+	void mvDynamicTexture::applyPendingValue()
+	{
+		if (_pendingValue == nullptr)
+			return;
+
+		setPyValue(_pendingValue);
+		Py_XDECREF(_pendingValue);
+		_pendingValue = nullptr;
 	}
 
 }
\ No newline at end of file
@@ -1,6 +1,8 @@
 #pragma once
 
 #include "mvItemRegistry.h"
+#include "mvUtilities.h"
+#include "mvTextureRegions.h"
 
 namespace Marvel {
 
@@ -25,12 +27,34 @@ namespace Marvel {
         void setPyValue(PyObject* value) override;
         
         void* getRawTexture() { return _texture; }
+        i32   getFormat() const { return _format; }
+
+        // bumped on every change, null if the source can't report changes
+        mvRef<u32> getGeneration() { return _generation; }
+
+        // set_texture_region/push_texture_rows, pixels in the texture's format
+        void setRegion(const mvTextureRect& rect, const u8* pixels);
+        void pushRows (const u8* pixels, u32 rows);
+        f32  getScroll() const { return _permHeight > 0 ? (f32)_regions.rowCursor / (f32)_permHeight : 0.0f; }
 
     private:
 
+        // converts default_value once the format keyword is known
+        void applyPendingValue();
+
+        // complete cpu side surface in the texture's format
+        u8*  getSurface();
+
         mvRef<std::vector<float>> _value = CreateRef<std::vector<float>>(std::vector<float>{0.0f});
+        std::vector<u8>           _pixels; // non float formats
+        PyObject*                 _pendingValue = nullptr;
+        i32                       _format = mvTextureFormat_Float_rgba;
+        mvRef<u32>                _generation = CreateRef<u32>(0u);
+        u32                       _uploadedGeneration = 0u;
+        mvTextureRegions          _regions;
         void*                     _texture = nullptr;
         bool                      _dirty = true;
+        bool                      _streaming = false; // ring of pixel buffers
         int                       _permWidth = 0;
         int                       _permHeight = 0;
 
@@ -0,0 +1,129 @@
+#include "mvImageDecoder.h"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <stb_image.h>
+#include "mvThreadPool.h"
+
+namespace Marvel {
+
+	mv_internal void
+	RunImageDecodes(mvImageDecoder& decoder)
+	{
+		while (true)
+		{
+			mvRef<mvImageDecode> decode;
+			{
+				std::lock_guard<std::mutex> lock(decoder.mutex);
+				if (decoder.pending.empty() || decoder.cancelled)
+				{
+					decoder.active--;
+					decoder.idle.notify_all();
+					return;
+				}
+				decode = decoder.pending.front();
+				decoder.pending.pop_front();
+			}
+
+			DecodeImage(*decode);
+			decode->ready = true;
+			if (decode->done)
+				decode->done(*decode, false);
+		}
+	}
+
+	mvImageDecoder::~mvImageDecoder()
+	{
+		std::deque<mvRef<mvImageDecode>> cancelled;
+		{
+			std::lock_guard<std::mutex> lock(mutex);
+			this->cancelled = true;
+			cancelled.swap(pending);
+		}
+
+		for (auto& decode : cancelled)
+		{
+			if (decode->done)
+				decode->done(*decode, true);
+		}
+
+		std::unique_lock<std::mutex> lock(mutex);
+		idle.wait(lock, [&] { return active == 0; });
+	}
+
+	b8
+	IsDecodableTextureFormat(i32 format)
+	{
+		return format == mvTextureFormat_Float_rgba || format == mvTextureFormat_Byte_rgba
+			|| format == mvTextureFormat_Byte_r || format == mvTextureFormat_Byte_rg;
+	}
+
+	void
+	DecodeImage(mvImageDecode& decode)
+	{
+		i32 components = GetTextureFormatComponents(decode.format);
+		const char* file = decode.file.c_str();
+
+		if (decode.format == mvTextureFormat_Float_rgba && stbi_is_hdr(file))
+		{
+			// hdr images load as floats without any gamma
+			f32* data = stbi_loadf(file, &decode.width, &decode.height, nullptr, components);
+			if (data)
+			{
+				decode.pixels.resize((size_t)GetTextureFormatBytes(decode.width, decode.height, decode.format));
+				memcpy(decode.pixels.data(), data, decode.pixels.size());
+				stbi_image_free(data);
+			}
+			decode.failed = data == nullptr;
+			return;
+		}
+
+		u8* data = stbi_load(file, &decode.width, &decode.height, nullptr, components);
+		decode.failed = data == nullptr;
+		if (data == nullptr)
+			return;
+
+		size_t count = (size_t)decode.width * decode.height * components;
+		decode.pixels.resize((size_t)GetTextureFormatBytes(decode.width, decode.height, decode.format));
+		if (decode.format != mvTextureFormat_Float_rgba)
+			memcpy(decode.pixels.data(), data, count);
+		else
+		{
+			// same as stbi_loadf with stbi_ldr_to_hdr_gamma/scale, alpha is linear
+			f32 table[256];
+			for (i32 i = 0; i < 256; i++)
+				table[i] = std::pow((f32)i / 255.0f, decode.gamma) * decode.gammaScale;
+
+			f32* texels = reinterpret_cast<f32*>(decode.pixels.data());
+			for (size_t i = 0; i < count; i++)
+				texels[i] = i % 4 == 3 ? (f32)data[i] / 255.0f : table[data[i]];
+		}
+		stbi_image_free(data);
+	}
+
+	void
+	SubmitImageDecode(mvRef<mvImageDecode> decode)
+	{
+		if (GContext->imageDecoder == nullptr)
+			GContext->imageDecoder = new mvImageDecoder();
+		mvImageDecoder& decoder = *GContext->imageDecoder;
+
+		std::lock_guard<std::mutex> lock(decoder.mutex);
+		decoder.pending.push_back(std::move(decode));
+		i32 threads = std::max(GContext->IO.decodeThreads, 1);
+		if (decoder.active >= threads)
+			return;
+
+		// resized once idle if decode_threads changed
+		if (decoder.pool == nullptr || (decoder.poolSize != threads && decoder.active == 0))
+		{
+			decoder.pool.reset();
+			decoder.pool = std::make_unique<mvThreadPool>((unsigned)threads);
+			decoder.poolSize = threads;
+		}
+
+		decoder.active++;
+		decoder.pool->submit([&decoder]() { RunImageDecodes(decoder); });
+	}
+
+}
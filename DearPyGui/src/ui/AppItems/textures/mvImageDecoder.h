@@ -0,0 +1,69 @@
+#pragma once
+
+#include <string>
+#include <vector>
+#include <deque>
+#include <memory>
+#include <atomic>
+#include <mutex>
+#include <functional>
+#include <condition_variable>
+#include "mvContext.h"
+#include "mvUtilities.h"
+
+namespace Marvel {
+
+    class mvThreadPool;
+
+    //-----------------------------------------------------------------------------
+    // mvImageDecoder
+    //     - decodes image files on its own workers (load_image_async, static
+    //       textures created with a file) instead of the calling thread or
+    //       the render thread
+    //     - never uses the shared pool, the render thread waits on work there
+    //       (sorts, heat maps) and long decodes would stall frames
+    //     - at most IO.decodeThreads decodes run at once, the rest wait in
+    //       order
+    //     - gamma is applied here rather than through stb_image's global
+    //       settings, which aren't thread safe
+    //-----------------------------------------------------------------------------
+
+    struct mvImageDecode
+    {
+        std::string     file;
+        f32             gamma = 1.0f;
+        f32             gammaScale = 1.0f;
+        i32             format = mvTextureFormat_Float_rgba; // float rgba or a byte format
+
+        // results, written before ready is set
+        std::atomic<b8> ready = false;
+        b8              failed = false;
+        i32             width = 0;
+        i32             height = 0;
+        std::vector<u8> pixels; // in the format's layout
+
+        // called on the worker once ready, or when the decoder is destroyed
+        // first (cancelled)
+        std::function<void(mvImageDecode& decode, b8 cancelled)> done;
+    };
+
+    struct mvImageDecoder
+    {
+        std::mutex                        mutex;
+        std::condition_variable           idle;
+        std::deque<mvRef<mvImageDecode>>  pending;
+        i32                               active = 0; // decoding jobs on the pool
+        b8                                cancelled = false;
+        std::unique_ptr<mvThreadPool>     pool;       // IO.decodeThreads workers, created on first use
+        i32                               poolSize = 0;
+
+        ~mvImageDecoder(); // cancels pending decodes and waits for running ones
+    };
+
+    b8   IsDecodableTextureFormat(i32 format);
+    void DecodeImage            (mvImageDecode& decode);
+
+    // must be called with GContext->mutex held
+    void SubmitImageDecode(mvRef<mvImageDecode> decode);
+
+}
@@ -4,6 +4,7 @@
 #include "mvPythonExceptions.h"
 #include "mvUtilities.h"
 #include "mvGlobalIntepreterLock.h"
+#include "mvPyObject.h"
 
 namespace Marvel {
 
@@ -34,6 +35,10 @@ namespace Marvel {
 				PyBUF_CONTIG_RO | PyBUF_FORMAT))
 			{
 				_value = buffer_info.buf;
+				_itemSize = buffer_info.itemsize;
+				_bufferSize = buffer_info.len;
+				_writable = !buffer_info.readonly;
+				_state.ok = true;
 				if (_value == nullptr)
 				{
 					mvThrowPythonError(mvErrorCode::mvTextureNotFound, GetEntityCommand(_type), "Texture data not valid", this);
@@ -44,6 +49,10 @@ namespace Marvel {
 				Py_XDECREF(_buffer);
 			Py_XINCREF(value);
 			_buffer = value;
+
+			// a new buffer is uploaded whole
+			_regions.rects.clear();
+			_regions.rects.push_back({ 0u, 0u, (u32)_permWidth, (u32)_permHeight });
 		}
 	}
 
@@ -62,33 +71,83 @@ namespace Marvel {
 		_buffer = titem->_buffer;
 		_texture = titem->_texture;
 		_dirty = titem->_dirty;
-		_componentType = titem->_componentType;
-		_components = titem->_components;
+		_writable = titem->_writable;
+		_fullUpload = titem->_fullUpload;
+		_regions.rowCursor = titem->_regions.rowCursor;
+		_format = titem->_format;
+		_streaming = titem->_streaming;
+		_itemSize = titem->_itemSize;
+		_bufferSize = titem->_bufferSize;
 		_permWidth = titem->_permWidth;
 		_permHeight = titem->_permHeight;
 	}
 
 	void mvRawTexture::draw(ImDrawList* drawlist, float x, float y)
 	{
-		if (_dirty)
+		if (_value == nullptr)
+			return;
+
+		u64 size = GetTextureFormatBytes(_permWidth, _permHeight, _format);
+		if (!hasValidBuffer())
 		{
+			if (_state.ok)
+				mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(_type), "Texture buffer doesn't match the format or size.", this);
+			_state.ok = false;
+			return;
+		}
 
-			if (_value == nullptr)
-				return;
+		if (_dirty)
+		{
 
-			if(_componentType == ComponentType::MV_FLOAT_COMPONENT)
-				_texture = LoadTextureFromArrayRaw(_permWidth, _permHeight, (float*)_value, _components);
+			_texture = LoadTextureFromArrayRaw(_permWidth, _permHeight, _value, _format, _streaming ? MaxPixelBuffers : 1u);
+			GContext->textureBytes += size;
 
 			if (_texture == nullptr)
 				_state.ok = false;
 
+			_regions.rects.clear();
 			_dirty = false;
 			return;
 		}
 
-		if (_componentType == ComponentType::MV_FLOAT_COMPONENT)
-			UpdateRawTexture(_texture, _permWidth, _permHeight, (float*)_value, _components);
+		// the buffer can change underneath, so it is uploaded every frame
+		// unless the changes are reported through set_texture_region
+		if (_fullUpload)
+		{
+			UpdateRawTexture(_texture, _permWidth, _permHeight, _value, _format);
+			GContext->textureBytes += size;
+			_regions.rects.clear();
+		}
+		else if (!_regions.rects.empty())
+			GContext->textureBytes += UploadTextureRegions(_regions, _texture, _permWidth, _permHeight, _value, _format);
+
+	}
+
+	bool mvRawTexture::hasValidBuffer() const
+	{
+		// the buffer is uploaded (and written) as is, so it must be in the format's layout
+		u64 size = GetTextureFormatBytes(_permWidth, _permHeight, _format);
+		return _value != nullptr && _itemSize == GetTextureFormatComponentSize(_format) && (u64)_bufferSize >= size;
+	}
+
+	void mvRawTexture::setRegion(const mvTextureRect& rect, const u8* pixels)
+	{
+		if (!hasValidBuffer())
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "set_texture_region", "Texture buffer doesn't match the format or size.", this);
+			return;
+		}
+		WriteTextureRegion(_regions, static_cast<u8*>(_value), _permWidth, _format, rect, pixels);
+	}
 
+	void mvRawTexture::pushRows(const u8* pixels, u32 rows)
+	{
+		if (!hasValidBuffer())
+		{
+			mvThrowPythonError(mvErrorCode::mvWrongType, "push_texture_rows", "Texture buffer doesn't match the format or size.", this);
+			return;
+		}
+		PushTextureRows(_regions, static_cast<u8*>(_value), _permWidth, _permHeight, _format, pixels, rows);
 	}
 
 	void mvRawTexture::handleSpecificRequiredArgs(PyObject* dict)
@@ -131,24 +190,38 @@ namespace Marvel {
 
 		if (PyObject* item = PyDict_GetItemString(dict, "format"))
 		{
-			int format = ToInt(item);
-			if (format == 0)
-			{
-				_components = 4;
-				_componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
-			}
-			else if (format == 1)
+			i32 format = ToInt(item);
+			if (format < 0 || format >= mvTextureFormat_Count)
+				mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(_type), "Unknown texture format.", this);
+			else if (format != _format && _texture)
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Texture format can only be set on creation.", this);
+			else
 			{
-				_components = 3;
-				_componentType = mvRawTexture::ComponentType::MV_FLOAT_COMPONENT;
+				_format = format;
+				_state.ok = true;
 			}
 		}
+
+		if (PyObject* item = PyDict_GetItemString(dict, "streaming"))
+		{
+			bool streaming = ToBool(item);
+			if (streaming != _streaming && _texture)
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Texture streaming can only be set on creation.", this);
+			else
+				_streaming = streaming;
+		}
+
+		if (PyObject* item = PyDict_GetItemString(dict, "full_upload")) _fullUpload = ToBool(item);
 	}
 
 	void mvRawTexture::getSpecificConfiguration(PyObject* dict)
 	{
 		if (dict == nullptr)
 			return;
+
+		PyDict_SetItemString(dict, "format", mvPyObject(ToPyInt(_format)));
+		PyDict_SetItemString(dict, "streaming", mvPyObject(ToPyBool(_streaming)));
+		PyDict_SetItemString(dict, "full_upload", mvPyObject(ToPyBool(_fullUpload)));
 	}
 
 }
\ No newline at end of file
@@ -1,17 +1,14 @@
 #pragma once
 
 #include "mvItemRegistry.h"
+#include "mvUtilities.h"
+#include "mvTextureRegions.h"
 
 namespace Marvel {
 
     class mvRawTexture : public mvAppItem
     {
 
-        enum class ComponentType {
-            MV_FLOAT_COMPONENT,
-            MV_INT_COMPONENT,
-        };
-
     public:
 
         explicit mvRawTexture(mvUUID uuid);
@@ -28,6 +25,17 @@ namespace Marvel {
         void setPyValue(PyObject* value) override;
 
         void* getRawTexture() { return _texture; }
+        i32   getFormat() const { return _format; }
+        bool  isWritable() const { return _writable; }
+
+        // the buffer is in the format's layout and covers the whole texture
+        bool hasValidBuffer() const;
+
+        // set_texture_region/push_texture_rows, pixels (if any) in the texture's format,
+        // raise instead of writing if the buffer isn't valid
+        void setRegion(const mvTextureRect& rect, const u8* pixels);
+        void pushRows (const u8* pixels, u32 rows);
+        f32  getScroll() const { return _permHeight > 0 ? (f32)_regions.rowCursor / (f32)_permHeight : 0.0f; }
 
     private:
 
@@ -35,8 +43,13 @@ namespace Marvel {
         void*         _value = nullptr;
         void*         _texture = nullptr;
         bool          _dirty = true;
-        ComponentType _componentType = ComponentType::MV_FLOAT_COMPONENT;
-        int           _components = 4;
+        bool          _writable = false;
+        bool          _streaming = false; // ring of pixel buffers
+        bool          _fullUpload = true; // every frame, otherwise only regions set
+        mvTextureRegions _regions;
+        i32           _format = mvTextureFormat_Float_rgba;
+        Py_ssize_t    _itemSize = 0;  // of the buffer, must match the format
+        Py_ssize_t    _bufferSize = 0;
         int           _permWidth = 0;
         int           _permHeight = 0;
 
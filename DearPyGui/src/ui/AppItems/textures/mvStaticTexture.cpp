@@ -3,7 +3,11 @@
 #include "mvItemRegistry.h"
 #include "mvPythonExceptions.h"
 #include "mvUtilities.h"
+#include "mvTexturePixels.h"
+#include "mvGlobalIntepreterLock.h"
+#include "mvPyObject.h"
 #include <fstream>
+#include <cstring>
 
 namespace Marvel {
 
@@ -20,6 +24,12 @@ namespace Marvel {
 			return;
 		//UnloadTexture(_name);
 		FreeTexture(_texture);
+
+		if (_pendingValue)
+		{
+			mvGlobalIntepreterLock gil;
+			Py_XDECREF(_pendingValue);
+		}
 	}
 
 	void mvStaticTexture::applySpecificTemplate(mvAppItem* item)
@@ -27,7 +37,10 @@ namespace Marvel {
 		auto titem = static_cast<mvStaticTexture*>(item);
 		if(_source != 0) _value = titem->_value;
 		_texture = titem->_texture;
+		_atlasRect = titem->_atlasRect;
 		_dirty = titem->_dirty;
+		_format = titem->_format;
+		_file = titem->_file;
 		_permWidth = titem->_permWidth;
 		_permHeight = titem->_permHeight;
 	}
@@ -37,6 +50,14 @@ namespace Marvel {
 		if (!_dirty)
 			return;
 
+		// nothing to upload until the file is decoded
+		if (_decode)
+		{
+			if (!_decode->ready)
+				return;
+			applyDecode();
+		}
+
 		if (!_state.ok)
 			return;
 
@@ -47,9 +68,33 @@ namespace Marvel {
 			_height = ImGui::GetIO().Fonts->TexHeight;
 		}
 		else
-			_texture = LoadTextureFromArray(_permWidth, _permHeight, _value->data());
+		{
+			// created without keywords
+			if (_pendingValue)
+			{
+				mvGlobalIntepreterLock gil;
+				applyPendingValue();
+			}
 
-		if (_texture == nullptr)
+			// short float values are padded too, the upload reads the whole surface
+			size_t bytes = (size_t)GetTextureFormatBytes(_permWidth, _permHeight, _format);
+			if (IsFloatTextureFormat(_format) && _value->size() * sizeof(f32) < bytes)
+				_value->resize(bytes / sizeof(f32));
+
+			const void* data = IsFloatTextureFormat(_format) ? (const void*)_value->data() : (const void*)_pixels.data();
+			size_t size = IsFloatTextureFormat(_format) ? _value->size() * sizeof(f32) : _pixels.size();
+
+			// uploaded with its page by the registry
+			mvTextureAtlas* atlas = _texture ? nullptr : GetTextureAtlas(_parentPtr);
+			if (atlas == nullptr || !PackAtlasTexture(*atlas, _atlasRect, _permWidth, _permHeight, _format, data, size))
+			{
+				_atlasRect = mvAtlasRect();
+				_texture = LoadTextureFromArray(_permWidth, _permHeight, data, _format);
+				GContext->textureBytes += GetTextureFormatBytes(_permWidth, _permHeight, _format);
+			}
+		}
+
+		if (_texture == nullptr && !_atlasRect.page)
 		{
 			_state.ok = false;
 			mvThrowPythonError(mvErrorCode::mvItemNotFound, "add_static_texture",
@@ -81,7 +126,9 @@ namespace Marvel {
 				break;
 
 			case 2:
-				*_value = ToFloatVect(item);
+				// the format keyword decides the conversion
+				Py_XINCREF(item);
+				_pendingValue = item;
 				break;
 
 			default:
@@ -90,14 +137,122 @@ namespace Marvel {
 		}
 	}
 
+	void mvStaticTexture::handleSpecificKeywordArgs(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		if (PyObject* item = PyDict_GetItemString(dict, "format"))
+		{
+			i32 format = ToInt(item);
+			if (format < 0 || format >= mvTextureFormat_Count)
+				mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(_type), "Unknown texture format.", this);
+			else if (format != _format && (_texture || _atlasRect.page))
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Texture format can only be set on creation.", this);
+			else
+				_format = format;
+		}
+
+		applyPendingValue();
+
+		if (PyObject* item = PyDict_GetItemString(dict, "file"))
+		{
+			std::string file = ToString(item);
+			if (file.empty() || file == _file)
+				return;
+
+			if (!IsDecodableTextureFormat(_format))
+			{
+				mvThrowPythonError(mvErrorCode::mvWrongType, GetEntityCommand(_type), "Files load as mvFormat_Float_rgba or one of the byte formats.", this);
+				return;
+			}
+
+			// replaces the texture once decoded
+			_file = file;
+			_decode = CreateRef<mvImageDecode>();
+			_decode->file = file;
+			_decode->format = _format;
+			_state.ok = false;
+			_dirty = true;
+			SubmitImageDecode(_decode);
+		}
+	}
+
+	void mvStaticTexture::getSpecificConfiguration(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		PyDict_SetItemString(dict, "format", mvPyObject(ToPyInt(_format)));
+		PyDict_SetItemString(dict, "file", mvPyObject(ToPyString(_file)));
+
+		// read only, where the texture was packed (0..1 when it has its own)
+		mvVec2 atlasMin = GetAtlasUV(this, { 0.0f, 0.0f });
+		mvVec2 atlasMax = GetAtlasUV(this, { 1.0f, 1.0f });
+		PyDict_SetItemString(dict, "atlas_uv_min", mvPyObject(ToPyPair(atlasMin.x, atlasMin.y)));
+		PyDict_SetItemString(dict, "atlas_uv_max", mvPyObject(ToPyPair(atlasMax.x, atlasMax.y)));
+	}
+
+	void mvStaticTexture::applyDecode()
+	{
+		mvRef<mvImageDecode> decode = std::move(_decode);
+
+		if (decode->failed)
+		{
+			mvGlobalIntepreterLock gil;
+			mvThrowPythonError(mvErrorCode::mvItemNotFound, "add_static_texture",
+				"Texture file could not be loaded: " + decode->file, this);
+			return;
+		}
+
+		_permWidth = _width = decode->width;
+		_permHeight = _height = decode->height;
+		if (IsFloatTextureFormat(_format))
+		{
+			_value->resize(decode->pixels.size() / sizeof(f32));
+			memcpy(_value->data(), decode->pixels.data(), decode->pixels.size());
+		}
+		else
+			_pixels = std::move(decode->pixels);
+
+		if (_texture)
+		{
+			FreeTexture(_texture);
+			_texture = nullptr;
+		}
+		_state.ok = true;
+	}
+
+	void mvStaticTexture::applyPendingValue()
+	{
+		if (_pendingValue == nullptr)
+			return;
+
+		setPyValue(_pendingValue);
+		Py_XDECREF(_pendingValue);
+		_pendingValue = nullptr;
+	}
+
 	PyObject* mvStaticTexture::getPyValue()
 	{
+		if (!IsFloatTextureFormat(_format))
+			return ToPyTexturePixels(_pixels, _format);
 		return ToPyList(*_value);
 	}
 
 	void mvStaticTexture::setPyValue(PyObject* value)
 	{
-		*_value = ToFloatVect(value);
+		if (IsFloatTextureFormat(_format))
+		{
+			*_value = ToFloatVect(value);
+			return;
+		}
+
+		// short data is padded, the upload reads the whole surface
+		SetTexturePixels(_pixels, _format, value);
+		size_t size = (size_t)GetTextureFormatBytes(_permWidth, _permHeight, _format);
+		if (_pixels.size() < size)
+			_pixels.resize(size);
 	}
 
 	void mvStaticTexture::setDataSource(mvUUID dataSource)
@@ -118,6 +273,12 @@ namespace Marvel {
 				"Values types do not match: " + std::to_string(dataSource), this);
 			return;
 		}
+		if (!IsFloatTextureFormat(_format) || !IsFloatTextureFormat(GetTextureItemFormat(item)))
+		{
+			mvThrowPythonError(mvErrorCode::mvSourceNotCompatible, "set_value",
+				"Only float textures can share values: " + std::to_string(dataSource), this);
+			return;
+		}
 		_value = *static_cast<std::shared_ptr<std::vector<float>>*>(item->getValue());
 	}
 
@@ -1,6 +1,9 @@
 #pragma once
 
 #include "mvItemRegistry.h"
+#include "mvUtilities.h"
+#include "mvImageDecoder.h"
+#include "mvTextureAtlas.h"
 
 namespace Marvel {
 
@@ -14,6 +17,8 @@ namespace Marvel {
 
         void draw(ImDrawList* drawlist, float x, float y) override;
         void handleSpecificRequiredArgs(PyObject* dict) override;
+        void handleSpecificKeywordArgs(PyObject* dict) override;
+        void getSpecificConfiguration(PyObject* dict) override;
         void applySpecificTemplate(mvAppItem* item) override;
         
         // values
@@ -22,13 +27,27 @@ namespace Marvel {
         PyObject* getPyValue() override;
         void setPyValue(PyObject* value) override;
         
-        void* getRawTexture() { return _texture; }
+        void* getRawTexture() { return _atlasRect.page ? _atlasRect.page->texture : _texture; }
+        const mvAtlasRect& getAtlasRect() const { return _atlasRect; }
+        i32   getFormat() const { return _format; }
         void markDirty() { _dirty = true; }
 
     private:
 
+        // converts default_value once the format keyword is known
+        void applyPendingValue();
+
+        // takes the size and pixels of a finished file decode
+        void applyDecode();
+
         mvRef<std::vector<float>> _value = CreateRef<std::vector<float>>(std::vector<float>{0.0f});
+        std::vector<u8>           _pixels; // non float formats
+        PyObject*                 _pendingValue = nullptr;
+        std::string               _file;
+        mvRef<mvImageDecode>      _decode; // file being decoded off thread
+        i32                       _format = mvTextureFormat_Float_rgba;
         void*                     _texture = nullptr;
+        mvAtlasRect               _atlasRect; // set instead of _texture in an atlas registry
         bool                      _dirty = true;
         int                       _permWidth = 0;
         int                       _permHeight = 0;
@@ -0,0 +1,158 @@
+#include "mvTextureAtlas.h"
+#include <cstring>
+#include "mvUtilities.h"
+#include "mvStaticTexture.h"
+#include "mvTextureRegistry.h"
+
+namespace Marvel {
+
+	mvAtlasPage::~mvAtlasPage()
+	{
+		FreeTexture(texture);
+	}
+
+	mv_internal b8
+	AllocateAtlasRect(mvAtlasPage& page, u32 width, u32 height, u32& x, u32& y)
+	{
+		// lowest shelf the rect fits on
+		mvAtlasShelf* best = nullptr;
+		for (auto& shelf : page.shelves)
+		{
+			if (shelf.height < height || page.size - shelf.cursor < width)
+				continue;
+			if (best == nullptr || shelf.height < best->height)
+				best = &shelf;
+		}
+
+		// a new shelf rather than wasting more than half of one
+		if ((best == nullptr || best->height > height * 2u) && page.size - page.top >= height && page.size >= width)
+		{
+			page.shelves.push_back({ page.top, height, 0u });
+			page.top += height;
+			best = &page.shelves.back();
+		}
+
+		if (best == nullptr)
+			return false;
+
+		x = best->cursor;
+		y = best->y;
+		best->cursor += width;
+		return true;
+	}
+
+	mv_internal void
+	WriteAtlasRect(mvAtlasPage& page, const mvAtlasRect& rect, const u8* pixels)
+	{
+		size_t texel = (size_t)GetTextureFormatBytes(1, 1, page.format);
+		size_t pitch = texel * page.size;
+		size_t rowSize = texel * rect.width;
+		size_t cellSize = rowSize + 2 * texel;
+		u8* corner = page.pixels.data() + (rect.y - 1) * pitch + (rect.x - 1) * texel;
+
+		// rows with their first and last texel repeated, then the first and last row
+		for (u32 row = 0; row < rect.height; row++)
+		{
+			u8* line = corner + (row + 1) * pitch;
+			memcpy(line + texel, pixels + row * rowSize, rowSize);
+			memcpy(line, line + texel, texel);
+			memcpy(line + texel + rowSize, line + rowSize, texel);
+		}
+		memcpy(corner, corner + pitch, cellSize);
+		memcpy(corner + (rect.height + 1) * pitch, corner + rect.height * pitch, cellSize);
+
+		WriteTextureRegion(page.regions, page.pixels.data(), page.size, page.format,
+			{ rect.x - 1, rect.y - 1, rect.width + 2, rect.height + 2 }, nullptr);
+	}
+
+	b8
+	PackAtlasTexture(mvTextureAtlas& atlas, mvAtlasRect& rect, u32 width, u32 height, i32 format, const void* pixels, size_t size)
+	{
+		// short data keeps the old upload path
+		if (width == 0 || height == 0 || size < (size_t)GetTextureFormatBytes(width, height, format))
+			return false;
+
+		if (rect.page && rect.page->format == format && rect.width == width && rect.height == height)
+		{
+			WriteAtlasRect(*rect.page, rect, (const u8*)pixels);
+			return true;
+		}
+
+		rect = mvAtlasRect();
+		u32 cellWidth = width + 2u;
+		u32 cellHeight = height + 2u;
+		u32 x = 0u;
+		u32 y = 0u;
+
+		for (auto& page : atlas.pages)
+		{
+			if (page->format == format && AllocateAtlasRect(*page, cellWidth, cellHeight, x, y))
+			{
+				rect.page = page;
+				break;
+			}
+		}
+
+		if (!rect.page)
+		{
+			if (cellWidth > atlas.pageSize || cellHeight > atlas.pageSize)
+				return false;
+
+			auto page = CreateRef<mvAtlasPage>();
+			page->format = format;
+			page->size = atlas.pageSize;
+			page->pixels.resize((size_t)GetTextureFormatBytes(page->size, page->size, format));
+			AllocateAtlasRect(*page, cellWidth, cellHeight, x, y);
+			atlas.pages.push_back(page);
+			rect.page = page;
+		}
+
+		rect.x = x + 1u;
+		rect.y = y + 1u;
+		rect.width = width;
+		rect.height = height;
+		WriteAtlasRect(*rect.page, rect, (const u8*)pixels);
+		return true;
+	}
+
+	u64
+	UploadAtlasPages(mvTextureAtlas& atlas)
+	{
+		u64 bytes = 0u;
+		for (auto& page : atlas.pages)
+		{
+			if (page->texture == nullptr)
+			{
+				page->texture = LoadTextureFromArrayDynamic(page->size, page->size, page->pixels.data(), page->format);
+				page->regions.rects.clear();
+				bytes += GetTextureFormatBytes(page->size, page->size, page->format);
+			}
+			else if (!page->regions.rects.empty())
+				bytes += UploadTextureRegions(page->regions, page->texture, page->size, page->size, page->pixels.data(), page->format);
+		}
+		return bytes;
+	}
+
+	mvTextureAtlas*
+	GetTextureAtlas(mvAppItem* registry)
+	{
+		if (registry == nullptr || registry->_type != mvAppItemType::mvTextureRegistry)
+			return nullptr;
+		return static_cast<mvTextureRegistry*>(registry)->getAtlas();
+	}
+
+	mvVec2
+	GetAtlasUV(mvAppItem* texture, mvVec2 uv)
+	{
+		if (texture->_type != mvAppItemType::mvStaticTexture)
+			return uv;
+
+		const mvAtlasRect& rect = static_cast<mvStaticTexture*>(texture)->getAtlasRect();
+		if (!rect.page)
+			return uv;
+
+		f32 size = (f32)rect.page->size;
+		return { (rect.x + uv.x * rect.width) / size, (rect.y + uv.y * rect.height) / size };
+	}
+
+}
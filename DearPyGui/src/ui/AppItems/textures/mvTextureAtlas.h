@@ -0,0 +1,74 @@
+#pragma once
+
+#include <vector>
+#include "mvContext.h"
+#include "mvMath.h"
+#include "mvUtilities.h"
+#include "mvTextureRegions.h"
+
+namespace Marvel {
+
+    class mvAppItem;
+
+    //-----------------------------------------------------------------------------
+    // mvTextureAtlas
+    //     - static textures of a texture registry created with atlas=True are
+    //       shelf packed into shared square pages (one set of pages per
+    //       format) instead of getting a texture each, so images of many
+    //       small textures batch into a single draw call
+    //     - every rect keeps a 1 texel border copied from its edges, linear
+    //       filtering never samples a neighbour
+    //     - images remap their uvs into the rect, uvs outside 0..1 (tiling)
+    //       don't repeat the texture
+    //     - space of deleted textures is not reused, pages live as long as
+    //       the registry or the last texture on them
+    //     - textures larger than a page get their own texture
+    //-----------------------------------------------------------------------------
+
+    struct mvAtlasShelf
+    {
+        u32 y = 0u;
+        u32 height = 0u;
+        u32 cursor = 0u; // next free x
+    };
+
+    struct mvAtlasPage
+    {
+        ~mvAtlasPage();
+
+        i32                       format = mvTextureFormat_Float_rgba;
+        u32                       size = 0u;
+        std::vector<u8>           pixels;
+        std::vector<mvAtlasShelf> shelves;
+        u32                       top = 0u;         // first row below the shelves
+        void*                     texture = nullptr;
+        mvTextureRegions          regions;          // rects written since the last upload
+    };
+
+    struct mvAtlasRect
+    {
+        mvRef<mvAtlasPage> page;
+        u32                x = 0u; // inside the border
+        u32                y = 0u;
+        u32                width = 0u;
+        u32                height = 0u;
+    };
+
+    struct mvTextureAtlas
+    {
+        u32                             pageSize = 1024u;
+        std::vector<mvRef<mvAtlasPage>> pages;
+    };
+
+    // false if the texture doesn't fit a page or size (bytes) is short,
+    // rewrites rect in place when the size and format are unchanged
+    b8     PackAtlasTexture(mvTextureAtlas& atlas, mvAtlasRect& rect, u32 width, u32 height, i32 format, const void* pixels, size_t size);
+    u64    UploadAtlasPages(mvTextureAtlas& atlas);
+
+    // atlas of a texture registry, null when packing is off
+    mvTextureAtlas* GetTextureAtlas(mvAppItem* registry);
+
+    // texture space uv to page space, unchanged outside an atlas
+    mvVec2 GetAtlasUV(mvAppItem* texture, mvVec2 uv);
+
+}
@@ -0,0 +1,194 @@
+#include "mvTexturePixels.h"
+#include <cmath>
+#include <cstring>
+#include "mvPythonTranslator.h"
+#include "mvPythonExceptions.h"
+#include "mvStaticTexture.h"
+#include "mvDynamicTexture.h"
+#include "mvRawTexture.h"
+
+namespace Marvel {
+
+	mv_internal u8
+	ToTextureByte(f32 value, b8 normalized)
+	{
+		if (normalized)
+			value *= 255.0f;
+		if (!(value > 0.0f)) // nan too
+			return 0;
+		return value >= 255.0f ? 255 : (u8)(value + 0.5f);
+	}
+
+	mv_internal b8
+	CopyTextureBuffer(std::vector<u8>& pixels, i32 format, PyObject* value, b8& normalized)
+	{
+		Py_buffer view;
+		if (PyObject_GetBuffer(value, &view, PyBUF_CONTIG_RO | PyBUF_FORMAT))
+		{
+			PyErr_Clear();
+			return false;
+		}
+
+		const char* type = view.format ? view.format : "B";
+		if (*type == '@' || *type == '=' || *type == '<')
+			type++;
+
+		b8 copied = false;
+		char layout = IsFloatTextureFormat(format) ? 'f' : (format == mvTextureFormat_Half_rgba ? 'e' : 'B');
+		if (type[1] == 0 && (type[0] == layout || (layout == 'B' && type[0] == 'c')) && view.itemsize == GetTextureFormatComponentSize(format))
+		{
+			pixels.resize((size_t)view.len);
+			memcpy(pixels.data(), view.buf, (size_t)view.len);
+			copied = true;
+		}
+		normalized = type[0] == 'f' || type[0] == 'd' || type[0] == 'e';
+
+		PyBuffer_Release(&view);
+		return copied;
+	}
+
+	b8
+	IsFloatTextureFormat(i32 format)
+	{
+		return format == mvTextureFormat_Float_rgba || format == mvTextureFormat_Float_rgb;
+	}
+
+	b8
+	SetTexturePixels(std::vector<u8>& pixels, i32 format, PyObject* value)
+	{
+		if (value == nullptr)
+			return false;
+
+		b8 normalized = false;
+		if (PyObject_CheckBuffer(value))
+		{
+			if (CopyTextureBuffer(pixels, format, value, normalized))
+				return true;
+		}
+		else if (PyList_Check(value) || PyTuple_Check(value))
+		{
+			// any float makes the whole sequence 0.0-1.0 ([0, 0.5, 1.0])
+			PyObject** items = PySequence_Fast_ITEMS(value);
+			Py_ssize_t count = PySequence_Fast_GET_SIZE(value);
+			for (Py_ssize_t i = 0; i < count && !normalized; i++)
+				normalized = PyFloat_Check(items[i]);
+		}
+
+		std::vector<f32> values = ToFloatVect(value);
+		if (PyErr_Occurred())
+			return false;
+
+		if (IsFloatTextureFormat(format))
+		{
+			pixels.resize(values.size() * sizeof(f32));
+			memcpy(pixels.data(), values.data(), pixels.size());
+		}
+		else if (format == mvTextureFormat_Half_rgba)
+		{
+			pixels.resize(values.size() * sizeof(u16));
+			u16* halves = reinterpret_cast<u16*>(pixels.data());
+			for (size_t i = 0; i < values.size(); i++)
+				halves[i] = FloatToHalf(values[i]);
+		}
+		else
+		{
+			pixels.resize(values.size());
+			for (size_t i = 0; i < values.size(); i++)
+				pixels[i] = ToTextureByte(values[i], normalized);
+		}
+		return true;
+	}
+
+	PyObject*
+	ToPyTexturePixels(const std::vector<u8>& pixels, i32 format)
+	{
+		if (format == mvTextureFormat_Half_rgba)
+		{
+			const u16* halves = reinterpret_cast<const u16*>(pixels.data());
+			size_t count = pixels.size() / sizeof(u16);
+			PyObject* result = PyList_New((Py_ssize_t)count);
+			for (size_t i = 0; i < count; i++)
+				PyList_SET_ITEM(result, (Py_ssize_t)i, PyFloat_FromDouble(HalfToFloat(halves[i])));
+			return result;
+		}
+
+		PyObject* result = PyList_New((Py_ssize_t)pixels.size());
+		for (size_t i = 0; i < pixels.size(); i++)
+			PyList_SET_ITEM(result, (Py_ssize_t)i, PyLong_FromLong(pixels[i]));
+		return result;
+	}
+
+	u16
+	FloatToHalf(f32 value)
+	{
+		u32 bits;
+		memcpy(&bits, &value, sizeof(bits));
+
+		u32 sign = (bits >> 16) & 0x8000u;
+		u32 exponent = (bits >> 23) & 0xffu;
+		u32 mantissa = bits & 0x7fffffu;
+
+		// inf and nan
+		if (exponent == 0xffu)
+			return (u16)(sign | 0x7c00u | (mantissa ? 0x200u : 0u));
+
+		i32 halfExponent = (i32)exponent - 127 + 15;
+
+		// overflow to inf
+		if (halfExponent >= 0x1f)
+			return (u16)(sign | 0x7c00u);
+
+		// subnormal or zero
+		if (halfExponent <= 0)
+		{
+			if (halfExponent < -10)
+				return (u16)sign;
+			mantissa |= 0x800000u;
+			u32 shift = (u32)(14 - halfExponent);
+			u32 half = mantissa >> shift;
+			u32 rest = mantissa & ((1u << shift) - 1u);
+			u32 halfway = 1u << (shift - 1u);
+			if (rest > halfway || (rest == halfway && (half & 1u)))
+				half++;
+			return (u16)(sign | half);
+		}
+
+		// round to nearest even, a carry bumps the exponent
+		u32 half = ((u32)halfExponent << 10) | (mantissa >> 13);
+		u32 rest = mantissa & 0x1fffu;
+		if (rest > 0x1000u || (rest == 0x1000u && (half & 1u)))
+			half++;
+		return (u16)(sign | half);
+	}
+
+	f32
+	HalfToFloat(u16 value)
+	{
+		u32 sign = (u32)(value & 0x8000u) << 16;
+		u32 exponent = (value >> 10) & 0x1fu;
+		u32 mantissa = value & 0x3ffu;
+
+		f32 result;
+		if (exponent == 0)
+			result = std::ldexp((f32)mantissa, -24);
+		else if (exponent == 0x1f)
+			result = mantissa ? NAN : INFINITY;
+		else
+			result = std::ldexp((f32)(mantissa | 0x400u), (i32)exponent - 25);
+
+		return sign ? -result : result;
+	}
+
+	i32
+	GetTextureItemFormat(mvAppItem* item)
+	{
+		if (item->_type == mvAppItemType::mvStaticTexture)
+			return static_cast<mvStaticTexture*>(item)->getFormat();
+		if (item->_type == mvAppItemType::mvDynamicTexture)
+			return static_cast<mvDynamicTexture*>(item)->getFormat();
+		if (item->_type == mvAppItemType::mvRawTexture)
+			return static_cast<mvRawTexture*>(item)->getFormat();
+		return mvTextureFormat_Float_rgba;
+	}
+
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <vector>
+#include "mvContext.h"
+#include "mvUtilities.h"
+
+namespace Marvel {
+
+    class mvAppItem;
+
+    //-----------------------------------------------------------------------------
+    // mvTexturePixels
+    //     - python values converted to the layout of a texture format,
+    //       static/dynamic textures only keep these for non float formats
+    //       (mvFormat_Byte_*, mvFormat_Half_rgba), float formats use the
+    //       item's float vector
+    //     - buffers already in the format's layout (float32, uint8 for bytes,
+    //       float16 for halves) are copied as is
+    //     - byte formats take 0-255 integers, a sequence or buffer holding
+    //       any float is treated as 0.0-1.0
+    //-----------------------------------------------------------------------------
+
+    b8        IsFloatTextureFormat(i32 format);
+    b8        SetTexturePixels    (std::vector<u8>& pixels, i32 format, PyObject* value);
+    PyObject* ToPyTexturePixels   (const std::vector<u8>& pixels, i32 format);
+    u16       FloatToHalf         (f32 value);
+    f32       HalfToFloat         (u16 value);
+
+    // format of a static/dynamic/raw texture, float rgba for other items
+    i32       GetTextureItemFormat(mvAppItem* item);
+
+}
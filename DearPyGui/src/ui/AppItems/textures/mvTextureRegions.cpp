@@ -0,0 +1,87 @@
+#include "mvTextureRegions.h"
+#include <algorithm>
+#include <cstring>
+#include "mvUtilities.h"
+#include "mvDynamicTexture.h"
+#include "mvRawTexture.h"
+
+namespace Marvel {
+
+	mv_internal constexpr size_t MaxTextureRects = 16; // more are merged into their bounds
+
+	void
+	WriteTextureRegion(mvTextureRegions& regions, u8* surface, u32 width, i32 format, const mvTextureRect& rect, const u8* pixels)
+	{
+		if (pixels)
+		{
+			size_t pitch = (size_t)GetTextureFormatBytes(width, 1, format);
+			size_t rowSize = (size_t)GetTextureFormatBytes(rect.width, 1, format);
+			u8* first = surface + rect.y * pitch + (size_t)GetTextureFormatBytes(rect.x, 1, format);
+			for (u32 row = 0; row < rect.height; row++)
+				memcpy(first + row * pitch, pixels + row * rowSize, rowSize);
+		}
+
+		if (regions.rects.size() < MaxTextureRects)
+		{
+			regions.rects.push_back(rect);
+			return;
+		}
+
+		mvTextureRect bounds = rect;
+		for (const auto& queued : regions.rects)
+		{
+			u32 right = std::max(bounds.x + bounds.width, queued.x + queued.width);
+			u32 bottom = std::max(bounds.y + bounds.height, queued.y + queued.height);
+			bounds.x = std::min(bounds.x, queued.x);
+			bounds.y = std::min(bounds.y, queued.y);
+			bounds.width = right - bounds.x;
+			bounds.height = bottom - bounds.y;
+		}
+		regions.rects.assign(1, bounds);
+	}
+
+	void
+	PushTextureRows(mvTextureRegions& regions, u8* surface, u32 width, u32 height, i32 format, const u8* pixels, u32 rows)
+	{
+		// only the newest rows of a push taller than the texture survive
+		if (rows > height)
+		{
+			pixels += (size_t)GetTextureFormatBytes(width, rows - height, format);
+			regions.rowCursor = (regions.rowCursor + rows - height) % height;
+			rows = height;
+		}
+
+		// up to the bottom, then wrapped to the top
+		u32 first = std::min(rows, height - regions.rowCursor);
+		WriteTextureRegion(regions, surface, width, format, { 0u, regions.rowCursor, width, first }, pixels);
+		if (rows > first)
+			WriteTextureRegion(regions, surface, width, format, { 0u, 0u, width, rows - first },
+				pixels + (size_t)GetTextureFormatBytes(width, first, format));
+
+		regions.rowCursor = (regions.rowCursor + rows) % height;
+	}
+
+	u64
+	UploadTextureRegions(mvTextureRegions& regions, void* texture, u32 width, u32 height, const void* surface, i32 format)
+	{
+		u64 bytes = 0u;
+		for (const auto& rect : regions.rects)
+		{
+			UpdateTextureRegion(texture, width, height, surface, format, rect.x, rect.y, rect.width, rect.height);
+			bytes += GetTextureFormatBytes(rect.width, rect.height, format);
+		}
+		regions.rects.clear();
+		return bytes;
+	}
+
+	f32
+	GetTextureScroll(mvAppItem* texture)
+	{
+		if (texture->_type == mvAppItemType::mvDynamicTexture)
+			return static_cast<mvDynamicTexture*>(texture)->getScroll();
+		if (texture->_type == mvAppItemType::mvRawTexture)
+			return static_cast<mvRawTexture*>(texture)->getScroll();
+		return 0.0f;
+	}
+
+}
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <vector>
+#include "mvContext.h"
+
+namespace Marvel {
+
+    class mvAppItem;
+
+    //-----------------------------------------------------------------------------
+    // mvTextureRegions
+    //     - dirty rectangles of a dynamic/raw texture (set_texture_region,
+    //       push_texture_rows) that the next frame uploads instead of the
+    //       whole surface
+    //     - the cpu side surface is always complete, the rectangles only
+    //       decide what is sent to the gpu
+    //     - push_texture_rows writes whole rows at a cursor that wraps around
+    //       (scrolling spectrograms, waterfalls), images shift their v
+    //       coordinates by the cursor so the newest row is drawn last; this
+    //       relies on the backend sampling with wrap addressing
+    //-----------------------------------------------------------------------------
+
+    struct mvTextureRect
+    {
+        u32 x = 0u;
+        u32 y = 0u;
+        u32 width = 0u;
+        u32 height = 0u;
+    };
+
+    struct mvTextureRegions
+    {
+        std::vector<mvTextureRect> rects;
+        u32                        rowCursor = 0u; // oldest row, next one pushed
+    };
+
+    // pixels are tightly packed rect.width * rect.height texels of format,
+    // null when the surface was written already (raw textures)
+    void WriteTextureRegion  (mvTextureRegions& regions, u8* surface, u32 width, i32 format, const mvTextureRect& rect, const u8* pixels);
+    void PushTextureRows     (mvTextureRegions& regions, u8* surface, u32 width, u32 height, i32 format, const u8* pixels, u32 rows);
+    u64  UploadTextureRegions(mvTextureRegions& regions, void* texture, u32 width, u32 height, const void* surface, i32 format);
+
+    // v offset of a dynamic/raw texture's row cursor, 0 for other items
+    f32  GetTextureScroll(mvAppItem* texture);
+
+}
@@ -3,6 +3,7 @@
 #include "mvLog.h"
 #include "mvStaticTexture.h"
 #include "mvDynamicTexture.h"
+#include "mvPyObject.h"
 
 namespace Marvel {
 
@@ -19,6 +20,9 @@ namespace Marvel {
 		for (auto& item : _children[1])
 			item->draw(drawlist, ImGui::GetCursorPosX(), ImGui::GetCursorPosY());
 
+		// after the static textures packed into them
+		GContext->textureBytes += UploadAtlasPages(_textureAtlas);
+
 		if (_show)
 			show_debugger();
 
@@ -34,6 +38,31 @@ namespace Marvel {
 		_selection = -1;
 	}
 
+	void mvTextureRegistry::handleSpecificKeywordArgs(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		if (PyObject* item = PyDict_GetItemString(dict, "atlas")) _atlas = ToBool(item);
+		if (PyObject* item = PyDict_GetItemString(dict, "atlas_page_size"))
+		{
+			i32 size = ToInt(item);
+			if (size < 64 || size > 16384)
+				mvThrowPythonError(mvErrorCode::mvNone, GetEntityCommand(_type), "Atlas page size must be between 64 and 16384.", this);
+			else
+				_textureAtlas.pageSize = (u32)size;
+		}
+	}
+
+	void mvTextureRegistry::getSpecificConfiguration(PyObject* dict)
+	{
+		if (dict == nullptr)
+			return;
+
+		PyDict_SetItemString(dict, "atlas", mvPyObject(ToPyBool(_atlas)));
+		PyDict_SetItemString(dict, "atlas_page_size", mvPyObject(ToPyInt((i32)_textureAtlas.pageSize)));
+	}
+
 	void mvTextureRegistry::show_debugger()
 	{
 		ImGui::PushID(this);
@@ -56,7 +85,7 @@ namespace Marvel {
 				else
 					textureRaw = static_cast<mvDynamicTexture*>(texture.get())->getRawTexture();
 
-				ImGui::Image(textureRaw, ImVec2(25, 25));
+				ImGui::Image(textureRaw, ImVec2(25, 25), GetAtlasUV(texture.get(), { 0.0f, 0.0f }), GetAtlasUV(texture.get(), { 1.0f, 1.0f }));
 				ImGui::SameLine();
 				if (ImGui::Selectable(texture->_internalLabel.c_str(), &status))
 					_selection = index;
@@ -85,14 +114,16 @@ namespace Marvel {
 				else
 					textureRaw = static_cast<mvDynamicTexture*>(_children[1][_selection].get())->getRawTexture();
 
-				ImGui::Image(textureRaw, ImVec2((float)_children[1][_selection]->_width, (float)_children[1][_selection]->_height));
+				mvVec2 uv_min = GetAtlasUV(_children[1][_selection].get(), { 0.0f, 0.0f });
+				mvVec2 uv_max = GetAtlasUV(_children[1][_selection].get(), { 1.0f, 1.0f });
+				ImGui::Image(textureRaw, ImVec2((float)_children[1][_selection]->_width, (float)_children[1][_selection]->_height), uv_min, uv_max);
 
 				ImPlot::PushStyleColor(ImPlotCol_FrameBg, ImVec4(0.0f, 0.0f, 0.0f, 0.0f));
 				if (ImPlot::BeginPlot("##texture plot", 0, 0, ImVec2(-1, -1),
 					ImPlotFlags_NoTitle | ImPlotFlags_NoLegend | ImPlotFlags_NoMenus | ImPlotFlags_Equal))
 				{
 					ImPlot::PlotImage(_children[1][_selection]->_internalLabel.c_str(), textureRaw, ImPlotPoint(0.0, 0.0),
-						ImPlotPoint(_children[1][_selection]->_width, _children[1][_selection]->_height));
+						ImPlotPoint(_children[1][_selection]->_width, _children[1][_selection]->_height), uv_min, uv_max);
 					ImPlot::EndPlot();
 				}
 				ImPlot::PopStyleColor();
@@ -3,6 +3,7 @@
 #include "mvItemRegistry.h"
 #include "dearpygui.h"
 #include "cpp.hint"
+#include "mvTextureAtlas.h"
 
 namespace Marvel {
 
@@ -16,6 +17,10 @@ namespace Marvel {
         void draw(ImDrawList* drawlist, float x, float y) override;
         void onChildRemoved(mvRef<mvAppItem> item) override;
         void onChildrenRemoved() override;
+        void handleSpecificKeywordArgs(PyObject* dict) override;
+        void getSpecificConfiguration(PyObject* dict) override;
+
+        mvTextureAtlas* getAtlas() { return _atlas ? &_textureAtlas : nullptr; }
 
     private:
 
@@ -23,7 +28,9 @@ namespace Marvel {
 
     private:
 
-        int _selection = -1;
+        int            _selection = -1;
+        bool           _atlas = false;
+        mvTextureAtlas _textureAtlas;
     };
 
 }
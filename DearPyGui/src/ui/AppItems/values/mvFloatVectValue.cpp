@@ -20,6 +20,7 @@ namespace Marvel {
 	void mvFloatVectValue::setPyValue(PyObject* value)
 	{
 		*_value = ToFloatVect(value);
+		(*_generation)++;
 	}
 
 	void mvFloatVectValue::setDataSource(mvUUID dataSource)
@@ -41,6 +42,8 @@ namespace Marvel {
 			return;
 		}
 		_value = *static_cast<std::shared_ptr<std::vector<float>>*>(item->getValue());
+		if (item->_type == mvAppItemType::mvFloatVectValue)
+			_generation = static_cast<mvFloatVectValue*>(item)->getGeneration();
 	}
 
 }
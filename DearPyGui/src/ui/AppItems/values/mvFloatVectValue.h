@@ -19,9 +19,13 @@ namespace Marvel {
         PyObject* getPyValue() override;
         void setPyValue(PyObject* value) override;
 
+        // bumped on every change, shared with items using this as source
+        mvRef<u32> getGeneration() { return _generation; }
+
     private:
 
         mvRef<std::vector<float>> _value = CreateRef<std::vector<float>>(std::vector<float>{0.0f});
+        mvRef<u32>                _generation = CreateRef<u32>(0u);
 
     };
 
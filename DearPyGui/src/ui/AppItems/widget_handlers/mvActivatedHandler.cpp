@@ -15,18 +15,14 @@ namespace Marvel {
 
     void mvActivatedHandler::customAction(void* data)
     {
-
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if (state->activated)
-        {
-            mvSubmitCallback([=]()
-                {
-                    if(_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, ToPyUUID(state->parent), _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, ToPyUUID(state->parent), _user_data);
-                });
-        }
+        if (!state->activated)
+            return;
+
+        mvCallbackRecord record = mvItemCallbackRecord(this);
+        record.data = mvCallbackData_Item;
+        record.item = state->parent;
+        mvSubmitCallbackRecord(record);
     }
 
 }
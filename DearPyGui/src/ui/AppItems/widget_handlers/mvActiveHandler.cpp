@@ -15,17 +15,13 @@ namespace Marvel {
 
     void mvActiveHandler::customAction(void* data)
     {
-
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if (state->active)
-        {
-            mvSubmitCallback([=]()
-                {
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, ToPyUUID(state->parent), _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, ToPyUUID(state->parent), _user_data);
-                });
-        }
+        if (!state->active)
+            return;
+
+        mvCallbackRecord record = mvItemCallbackRecord(this);
+        record.data = mvCallbackData_Item;
+        record.item = state->parent;
+        mvSubmitCoalescedCallbackRecord(_uuid, state->parent ? state->parent->_uuid : 0, record);
     }
 }
@@ -15,53 +15,19 @@ namespace Marvel {
 
     void mvClickedHandler::customAction(void* data)
     {
-
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if(_button == -1 || _button == 0)
-            if (state->leftclicked)
-            {
-                mvSubmitCallback([=]()
-                {
-                    mvPyObject pArgs(PyTuple_New(2));
-                    PyTuple_SetItem(pArgs, 0, ToPyInt(0));
-                    PyTuple_SetItem(pArgs, 1, ToPyUUID(state->parent)); // steals data, so don't deref
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, pArgs, _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, pArgs, _user_data);
-                    });
-            }
-
-        if (_button == -1 || _button == 1)
-            if (state->rightclicked)
-            {
-                mvSubmitCallback([=]()
-                {
-                    mvPyObject pArgs(PyTuple_New(2));
-                    PyTuple_SetItem(pArgs, 0, ToPyInt(1));
-                    PyTuple_SetItem(pArgs, 1, ToPyUUID(state->parent)); // steals data, so don't deref
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, pArgs, _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, pArgs, _user_data);
-                    });
-            }
-
-        if (_button == -1 || _button == 2)
-            if (state->middleclicked)
-            {
-                mvSubmitCallback([=]()
-                    {
-                        mvPyObject pArgs(PyTuple_New(2));
-                        PyTuple_SetItem(pArgs, 0, ToPyInt(2));
-                        PyTuple_SetItem(pArgs, 1, ToPyUUID(state->parent)); // steals data, so don't deref
-                        if (_alias.empty())
-                            mvRunCallback(getCallback(false), _uuid, pArgs, _user_data);
-                        else
-                            mvRunCallback(getCallback(false), _alias, pArgs, _user_data);
-                    });
-            }
-
+        b8 clicked[3] = { state->leftclicked, state->rightclicked, state->middleclicked };
+        for (i32 button = 0; button < 3; button++)
+        {
+            if (!clicked[button] || (_button != -1 && _button != button))
+                continue;
+
+            mvCallbackRecord record = mvItemCallbackRecord(this);
+            record.data = mvCallbackData_IntItem;
+            record.code = button;
+            record.item = state->parent;
+            mvSubmitCallbackRecord(record);
+        }
     }
 
     void mvClickedHandler::handleSpecificRequiredArgs(PyObject* dict)
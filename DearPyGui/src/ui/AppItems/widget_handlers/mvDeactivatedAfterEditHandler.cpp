@@ -15,17 +15,13 @@ namespace Marvel {
 
     void mvDeactivatedAfterEditHandler::customAction(void* data)
     {
-
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if (state->deactivatedAfterEdit)
-        {
-            mvSubmitCallback([=]()
-                {
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, ToPyUUID(state->parent), _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, ToPyUUID(state->parent), _user_data);
-                });
-        }
+        if (!state->deactivatedAfterEdit)
+            return;
+
+        mvCallbackRecord record = mvItemCallbackRecord(this);
+        record.data = mvCallbackData_Item;
+        record.item = state->parent;
+        mvSubmitCallbackRecord(record);
     }
 }
@@ -16,15 +16,12 @@ namespace Marvel {
     void mvDeactivatedHandler::customAction(void* data)
     {
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if (state->deactivated)
-        {
-            mvSubmitCallback([=]()
-                {
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, ToPyUUID(state->parent), _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, ToPyUUID(state->parent), _user_data);
-                });
-        }
+        if (!state->deactivated)
+            return;
+
+        mvCallbackRecord record = mvItemCallbackRecord(this);
+        record.data = mvCallbackData_Item;
+        record.item = state->parent;
+        mvSubmitCallbackRecord(record);
     }
 }
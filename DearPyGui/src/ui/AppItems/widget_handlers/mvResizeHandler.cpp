@@ -17,15 +17,12 @@ namespace Marvel {
     void mvResizeHandler::customAction(void* data)
     {
         mvAppItemState* state = static_cast<mvAppItemState*>(data);
-        if (state->mvRectSizeResized)
-        {
-            mvSubmitCallback([=]()
-                {
-                    if (_alias.empty())
-                        mvRunCallback(getCallback(false), _uuid, ToPyUUID(state->parent), _user_data);
-                    else
-                        mvRunCallback(getCallback(false), _alias, ToPyUUID(state->parent), _user_data);
-                });
-        }
+        if (!state->mvRectSizeResized)
+            return;
+
+        mvCallbackRecord record = mvItemCallbackRecord(this);
+        record.data = mvCallbackData_Item;
+        record.item = state->parent;
+        mvSubmitCoalescedCallbackRecord(_uuid, state->parent ? state->parent->_uuid : 0, record);
     }
 }
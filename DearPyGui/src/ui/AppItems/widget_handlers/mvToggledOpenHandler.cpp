@@ -15,17 +15,13 @@ namespace Marvel {
 
 	void mvToggledOpenHandler::customAction(void* data)
 	{
+		mvAppItemState* state = static_cast<mvAppItemState*>(data);
+		if (!state->toggledOpen)
+			return;
 
-		if (static_cast<mvAppItemState*>(data)->toggledOpen)
-		{
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, GetPyNone(), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, GetPyNone(), _user_data);
-				});
-		}
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_None;
+		mvSubmitCallbackRecord(record);
 	}
 
 }
\ No newline at end of file
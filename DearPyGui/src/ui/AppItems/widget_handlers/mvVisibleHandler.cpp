@@ -15,16 +15,12 @@ namespace Marvel {
 
 	void mvVisibleHandler::customAction(void* data)
 	{
+		mvAppItemState* state = static_cast<mvAppItemState*>(data);
+		if (!state->visible)
+			return;
 
-		if (static_cast<mvAppItemState*>(data)->visible)
-		{
-			mvSubmitCallback([=]()
-				{
-					if (_alias.empty())
-						mvRunCallback(getCallback(false), _uuid, GetPyNone(), _user_data);
-					else
-						mvRunCallback(getCallback(false), _alias, GetPyNone(), _user_data);
-				});
-		}
+		mvCallbackRecord record = mvItemCallbackRecord(this);
+		record.data = mvCallbackData_None;
+		mvSubmitCoalescedCallbackRecord(_uuid, state->parent ? state->parent->_uuid : 0, record);
 	}
 }
\ No newline at end of file
@@ -215,6 +215,7 @@ namespace Marvel {
         DebugItem("Handlers Bound:", _itemref->_handlerRegistry ? ts : fs);
 
         int applicableState = GetApplicableState(_itemref->_type);
+        RequestAppItemState(_itemref->_state);
         ImGui::Spacing();
         ImGui::Spacing();
         ImGui::Spacing();
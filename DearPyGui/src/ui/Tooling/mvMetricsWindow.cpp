@@ -1,6 +1,7 @@
 #include "mvMetricsWindow.h"
 #include "mvProfiler.h"
 #include "mvContext.h"
+#include "mvCallbackRegistry.h"
 
 mv_internal void
 DebugItem(const char* label, const char* item)
@@ -77,6 +78,8 @@ namespace Marvel {
                 ImGui::Text("%d vertices, %d indices (%d triangles)", io.MetricsRenderVertices, io.MetricsRenderIndices, io.MetricsRenderIndices / 3);
                 ImGui::Text("%d active windows (%d visible)", io.MetricsActiveWindows, io.MetricsRenderWindows);
                 ImGui::Text("%d active allocations", io.MetricsActiveAllocations);
+                ImGui::Text("%.3f MB texture data uploaded last frame", (double)GContext->textureBytesLastFrame / (1024.0 * 1024.0));
+                ImGui::Text("%d callbacks queued", (i32)GContext->callbackRegistry->callCount);
 
                 mv_local_persist std::map<std::string, ScrollingBuffer> buffers;
                 mv_local_persist float t = 0;
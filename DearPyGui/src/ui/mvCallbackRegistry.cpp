@@ -2,6 +2,7 @@
 #include "mvProfiler.h"
 #include "mvContext.h"
 #include <chrono>
+#include <algorithm>
 #include <iostream>
 #include "mvItemRegistry.h"
 #include "mvAppItemCommons.h"
@@ -22,6 +23,32 @@ namespace Marvel {
 		}
 	}
 
+	void mvRunCommands()
+	{
+
+		mvMPSCQueue<mvFunctionWrapper>& commands = GContext->callbackRegistry->commands;
+
+		if (commands.empty())
+			return;
+
+		MV_PROFILE_SCOPE("Commands")
+
+		// only apply what was queued before this frame so
+		// fast producers can't stall the render thread
+		size_t budget = commands.size();
+
+		mvGlobalIntepreterLock gil;
+
+		mvFunctionWrapper command;
+		while (budget > 0 && commands.try_pop(command))
+		{
+			command();
+			if (PyErr_Occurred())
+				PyErr_Print();
+			budget--;
+		}
+	}
+
 	void mvFrameCallback(i32 frame)
 	{
 
@@ -34,59 +61,471 @@ namespace Marvel {
 		mvAddCallback(GContext->callbackRegistry->frameCallbacks[frame], frame, nullptr, nullptr);
 	}
 
+	mv_internal void
+	mvNotifyCallbacks(mvCallbackRegistry& registry)
+	{
+		// taking the lock orders this with the callback thread's wait
+		{
+			std::lock_guard<std::mutex> lock(registry.signalMutex);
+		}
+		registry.signal.notify_one();
+	}
+
+	mv_internal void
+	mvDrainCallbackLane(mvCallbackLane& lane)
+	{
+		mvGlobalIntepreterLock gil;
+
+		for (;;)
+		{
+			mvFunctionWrapper call;
+			{
+				std::lock_guard<std::mutex> lock(lane.mutex);
+				if (lane.pending.empty())
+				{
+					lane.scheduled = false;
+					return;
+				}
+				call = std::move(lane.pending.front());
+				lane.pending.pop_front();
+			}
+			call();
+			GContext->callbackRegistry->callCount--;
+		}
+	}
+
+	// lane of a routed sender (nullptr: parallel), false when the sender
+	// isn't routed or there are no callback workers
+	mv_internal b8
+	mvFindCallbackLane(mvCallbackRegistry& registry, mvUUID sender, mvCallbackLane*& lane)
+	{
+		if (sender == 0 || GContext->IO.callbackWorkers <= 0)
+			return false;
+
+		std::lock_guard<std::mutex> lock(registry.laneMutex);
+		auto found = registry.senderLanes.find(sender);
+		if (found == registry.senderLanes.end())
+			return false;
+		lane = found->second == CallbackLaneParallel ? nullptr : registry.lanes[found->second].get();
+		return true;
+	}
+
+	// hands a callback of a routed sender to the callback workers,
+	// called by the callback thread with the GIL
+	mv_internal void
+	mvRouteCallback(mvCallbackRegistry& registry, mvCallbackLane* lane, mvFunctionWrapper call)
+	{
+		i32 count = GContext->IO.callbackWorkers;
+
+		if (registry.workers == nullptr || registry.workerCount != count)
+		{
+			// callbacks already routed finish on the old workers
+			Py_BEGIN_ALLOW_THREADS;
+			delete registry.workers;
+			registry.workers = new mvThreadPool((unsigned)count);
+			Py_END_ALLOW_THREADS;
+			registry.workerCount = count;
+		}
+
+		if (lane == nullptr)
+		{
+			registry.workers->submit([call = std::move(call)]() mutable
+				{
+					mvGlobalIntepreterLock gil;
+					call();
+					GContext->callbackRegistry->callCount--;
+				});
+			return;
+		}
+
+		std::lock_guard<std::mutex> lock(lane->mutex);
+		lane->pending.push_back(std::move(call));
+		if (!lane->scheduled)
+		{
+			lane->scheduled = true;
+			registry.workers->submit([lane]() { mvDrainCallbackLane(*lane); });
+		}
+	}
+
 	bool mvRunCallbacks()
 	{
-		GContext->callbackRegistry->running = true;
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+		registry.running = true;
 
 		mvGlobalIntepreterLock gil;
 
-		while (GContext->callbackRegistry->running)
+		// front of each queue, popped but not run yet
+		mvCallbackRecord record;
+		mvQueuedCall call;
+		b8 hasRecord = false;
+		b8 hasCall = false;
+		mvCallbackLane* lane = nullptr;
+
+		while (registry.running)
 		{
-			mvFunctionWrapper t2;
 			Py_BEGIN_ALLOW_THREADS;
-			GContext->callbackRegistry->calls.wait_and_pop(t2);
+			{
+				std::unique_lock<std::mutex> lock(registry.signalMutex);
+				registry.signal.wait(lock, [&]() { return hasRecord || hasCall || !registry.records.empty() || !registry.calls.empty(); });
+			}
 			Py_END_ALLOW_THREADS;
-			t2();
-			GContext->callbackRegistry->callCount--;
+
+			// whatever is queued runs in the same GIL hold, up to the budget,
+			// the older of the two queue fronts first (submission order)
+			i32 budget = std::max(GContext->IO.callbackBatch, 1);
+			{
+				std::lock_guard<std::mutex> lock(registry.statisticsMutex);
+				registry.statistics.batches++;
+			}
+			while (budget > 0 && registry.running)
+			{
+				if (!hasRecord)
+					hasRecord = registry.records.try_pop(record);
+				if (!hasCall)
+					hasCall = registry.calls.try_pop(call);
+				if (!hasRecord && !hasCall)
+					break;
+
+				budget--;
+				if (hasRecord && (!hasCall || record.sequence < call.sequence))
+				{
+					hasRecord = false;
+					if (mvFindCallbackLane(registry, record.senderId, lane))
+					{
+						mvRouteCallback(registry, lane, [record]() { mvRunCallbackRecord(record); });
+						continue;
+					}
+					mvRunCallbackRecord(record);
+				}
+				else
+				{
+					hasCall = false;
+					if (mvFindCallbackLane(registry, call.sender, lane))
+					{
+						mvRouteCallback(registry, lane, std::move(call.call));
+						continue;
+					}
+					call.call();
+				}
+				registry.callCount--;
+			}
 		}
 
+		// routed callbacks finish before the context goes away
+		Py_BEGIN_ALLOW_THREADS;
+		delete registry.workers;
+		registry.workers = nullptr;
+		Py_END_ALLOW_THREADS;
+
+		Py_XDECREF(registry.eventLoop);
+		registry.eventLoop = nullptr;
+
+		return true;
+	}
+
+	void mvSetCallbackLane(mvUUID sender, const std::string& lane, b8 parallel)
+	{
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+		std::lock_guard<std::mutex> lock(registry.laneMutex);
+
+		if (parallel)
+		{
+			registry.senderLanes[sender] = CallbackLaneParallel;
+			return;
+		}
+
+		if (lane.empty())
+		{
+			registry.senderLanes.erase(sender);
+			return;
+		}
+
+		auto found = registry.laneNames.find(lane);
+		if (found == registry.laneNames.end())
+		{
+			found = registry.laneNames.emplace(lane, (i32)registry.lanes.size()).first;
+			registry.lanes.push_back(std::make_unique<mvCallbackLane>());
+		}
+		registry.senderLanes[sender] = found->second;
+	}
+
+	mv_internal void
+	mvPushQueuedCall(mvCallbackRegistry& registry, u64 sequence, mvUUID sender, mvFunctionWrapper call)
+	{
+		registry.calls.push({ sequence, sender, std::move(call) });
+		mvNotifyCallbacks(registry);
+	}
+
+	void mvPushCallback(mvFunctionWrapper call, mvUUID sender)
+	{
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+		mvPushQueuedCall(registry, registry.sequence++, sender, std::move(call));
+	}
+
+	mvCallbackRecord mvItemCallbackRecord(mvAppItem* sender)
+	{
+		mvCallbackRecord record;
+		record.sender = sender;
+		record.senderId = sender->_uuid;
+		return record;
+	}
+
+	mvCallbackRecord mvItemCallbackRecord(mvAppItem* sender, mvCallbackData data, i32 code)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(sender);
+		record.data = data;
+		record.code = code;
+		return record;
+	}
+
+	b8 mvSubmitCallbackRecord(const mvCallbackRecord& record)
+	{
+		if (mvCallbackQueueFull())
+			return false;
+
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+		registry.callCount++;
+
+		mvCallbackRecord queued = record;
+		queued.queued = std::chrono::steady_clock::now();
+		queued.sequence = registry.sequence++;
+
+		if (registry.records.try_push(queued))
+			mvNotifyCallbacks(registry);
+		else
+			mvPushQueuedCall(registry, queued.sequence, queued.senderId, [queued]() { mvRunCallbackRecord(queued); }); // ring full, keeps its place
+		return true;
+	}
+
+	// reuses the node of a finished burst, so steady coalescing doesn't allocate
+	mv_internal mvCoalescedMap::iterator
+	mvInsertCoalesced(mvCallbackRegistry& registry, const std::pair<mvUUID, mvUUID>& id)
+	{
+		if (registry.coalescedNodes.empty())
+			return registry.coalesced.emplace(id, mvCoalescedCall()).first;
+
+		mvCoalescedMap::node_type node = std::move(registry.coalescedNodes.back());
+		registry.coalescedNodes.pop_back();
+		node.key() = id;
+		node.mapped() = mvCoalescedCall();
+		return registry.coalesced.insert(std::move(node)).position;
+	}
+
+	void mvSubmitCoalescedCallbackRecord(mvUUID sender, mvUUID key, const mvCallbackRecord& record)
+	{
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+
+		if (!GContext->IO.callbackCoalescing)
+		{
+			mvSubmitCallbackRecord(record);
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(registry.coalesceMutex);
+			auto found = registry.coalesced.find({ sender, key });
+			if (found == registry.coalesced.end())
+				found = mvInsertCoalesced(registry, { sender, key });
+			mvCoalescedCall& pending = found->second;
+			b8 queued = pending.isRecord;
+			pending.record = record;
+			pending.isRecord = true;
+			if (queued)
+			{
+				// the queued record runs this one instead
+				registry.coalescedCalls++;
+				return;
+			}
+		}
+
+		mvCallbackRecord marker;
+		marker.coalesced = true;
+		marker.senderId = sender;
+		marker.key = key;
+		if (!mvSubmitCallbackRecord(marker))
+		{
+			std::lock_guard<std::mutex> lock(registry.coalesceMutex);
+			registry.coalesced.erase({ sender, key });
+		}
+	}
+
+	mv_internal PyObject*
+	mvBuildCallbackData(const mvCallbackRecord& record)
+	{
+		switch (record.data)
+		{
+		case mvCallbackData_Int:           return ToPyInt(record.code);
+		case mvCallbackData_IntFloat:      return ToPyMPair(record.code, record.x);
+		case mvCallbackData_IntFloatFloat: return ToPyMTrip(record.code, record.x, record.y);
+		case mvCallbackData_FloatPair:     return ToPyPair(record.x, record.y);
+		case mvCallbackData_Item:          return ToPyUUID(record.item);
+		case mvCallbackData_IntItem:
+		{
+			PyObject* pArgs = PyTuple_New(2);
+			PyTuple_SetItem(pArgs, 0, ToPyInt(record.code));
+			PyTuple_SetItem(pArgs, 1, ToPyUUID(record.item)); // steals data, so don't deref
+			return pArgs;
+		}
+		case mvCallbackData_Bool:          return ToPyBool(record.code != 0);
+		case mvCallbackData_Float:         return ToPyFloat((f32)record.values[0]);
+		case mvCallbackData_FloatList:
+		{
+			f32 values[CallbackRecordValues];
+			for (i32 i = 0; i < record.count; i++)
+				values[i] = (f32)record.values[i];
+			return ToPyFloatList(values, record.count);
+		}
+		case mvCallbackData_IntList:
+		{
+			int values[CallbackRecordValues];
+			for (i32 i = 0; i < record.count; i++)
+				values[i] = (int)record.values[i];
+			return ToPyIntList(values, record.count);
+		}
+		default: return nullptr;
+		}
+	}
+
+	mv_internal void
+	mvInvokeCallbackRecord(const mvCallbackRecord& record)
+	{
+		// objects handed over by mvAddCallback keep their old ownership
+		mvPyObject built(mvBuildCallbackData(record));
+		PyObject* appData = record.data == mvCallbackData_Object ? record.appData : (PyObject*)built;
+
+		if (mvAppItem* sender = record.sender)
+		{
+			if (sender->_alias.empty())
+				mvRunCallback(sender->getCallback(false), sender->_uuid, appData, sender->_user_data);
+			else
+				mvRunCallback(sender->getCallback(false), sender->_alias, appData, sender->_user_data);
+		}
+		else
+			mvRunCallback(record.callable, record.senderId, appData, record.userData);
+	}
+
+	void mvRunCallbackRecord(const mvCallbackRecord& record)
+	{
+		mvRecordCallbackLatency(record.queued);
+
+		if (record.coalesced)
+			mvRunCoalescedCallback(record.senderId, record.key);
+		else
+			mvInvokeCallbackRecord(record);
+	}
+
+	void mvRecordCallbackLatency(std::chrono::steady_clock::time_point queued)
+	{
+		f64 latency = std::chrono::duration<f64>(std::chrono::steady_clock::now() - queued).count();
+
+		std::lock_guard<std::mutex> lock(GContext->callbackRegistry->statisticsMutex);
+		mvCallbackStatistics& statistics = GContext->callbackRegistry->statistics;
+		statistics.calls++;
+		statistics.latency += latency;
+		statistics.maxLatency = std::max(statistics.maxLatency, latency);
+	}
+
+	void mvRunCoalescedCallback(mvUUID sender, mvUUID key)
+	{
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+
+		mvCoalescedCall call;
+		{
+			std::lock_guard<std::mutex> lock(registry.coalesceMutex);
+			auto found = registry.coalesced.find({ sender, key });
+			if (found == registry.coalesced.end())
+				return;
+			mvCoalescedMap::node_type node = registry.coalesced.extract(found);
+			call = std::move(node.mapped());
+			registry.coalescedNodes.push_back(std::move(node));
+		}
+
+		if (call.isRecord)
+			mvInvokeCallbackRecord(call.record);
+		else
+			call.call();
+	}
+
+	b8 mvCallbackQueueFull()
+	{
+		i32 limit = GContext->IO.callbackQueueLimit;
+		if (limit <= 0 || GContext->callbackRegistry->callCount < limit)
+			return false;
+
+		GContext->callbackRegistry->droppedCalls++;
 		return true;
 	}
 
 	void mvAddCallback(PyObject* callable, mvUUID sender, PyObject* app_data, PyObject* user_data)
 	{
 
-		if (GContext->callbackRegistry->callCount > GContext->callbackRegistry->maxNumberOfCalls)
+		mvCallbackRecord record;
+		record.callable = callable;
+		record.senderId = sender;
+		record.userData = user_data;
+		record.data = mvCallbackData_Object;
+		record.appData = app_data;
+
+		if (!mvSubmitCallbackRecord(record))
 		{
 			if (app_data != nullptr)
 				Py_XDECREF(app_data);
 			if (user_data != nullptr)
 				Py_XDECREF(user_data);
-			assert(false);
-			return;
 		}
-
-		mvSubmitCallback([=]() {
-			mvRunCallback(callable, sender, app_data, user_data);
-			});
 	}
 
 	void mvAddCallback(PyObject* callable, const std::string& sender, PyObject* app_data, PyObject* user_data)
 	{
 
-		if (GContext->callbackRegistry->callCount > GContext->callbackRegistry->maxNumberOfCalls)
+		if (mvCallbackQueueFull())
 		{
 			if (app_data != nullptr)
 				Py_XDECREF(app_data);
 			if (user_data != nullptr)
 				Py_XDECREF(user_data);
-			assert(false);
 			return;
 		}
 
+		// routed by the aliased item (set_callback_lane takes its uuid), the
+		// alias map is only changed with the GIL and GContext->mutex held, so
+		// the callback thread and the render thread can both read it here
+		mvUUID id = GetIdFromAlias(*GContext->itemRegistry, sender);
 		mvSubmitCallback([=]() {
 			mvRunCallback(callable, sender, app_data, user_data);
-			});
+			}, id);
+	}
+
+	// an async def callback returns a coroutine, it runs as a task on the
+	// loop given to set_callback_event_loop
+	mv_internal void
+	mvScheduleCoroutine(PyObject* result)
+	{
+		if (!PyCoro_CheckExact(result))
+			return;
+
+		PyObject* loop = GContext->callbackRegistry->eventLoop;
+		if (loop)
+		{
+			mvPyObject createTask(PyObject_GetAttrString(loop, "create_task"));
+			if (createTask.isOk())
+			{
+				mvPyObject scheduled(PyObject_CallMethod(loop, "call_soon_threadsafe", "OO", (PyObject*)createTask, result));
+				if (scheduled.isOk())
+					return;
+			}
+			PyErr_Print(); // i.e. closed loop
+		}
+		else
+		{
+			mvThrowPythonError(mvErrorCode::mvNone, "Coroutine callbacks need an event loop, see set_callback_event_loop.");
+			PyErr_Print();
+		}
+
+		// never awaited
+		mvPyObject closed(PyObject_CallMethod(result, "close", nullptr));
+		if (!closed.isOk())
+			PyErr_Print();
 	}
 
 	void mvRunCallback(PyObject* callable, const std::string& sender, PyObject* app_data, PyObject* user_data)
@@ -155,6 +594,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if (count == 3)
@@ -170,6 +611,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if (count == 2)
@@ -184,6 +627,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if (count == 1)
@@ -196,6 +641,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 				}
 				else
 				{
@@ -204,6 +651,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 
 				}
@@ -280,6 +729,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if (count == 3)
@@ -295,6 +746,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if (count == 2)
@@ -309,6 +762,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 				}
 				else if(count == 1)
@@ -321,6 +776,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 				}
 				else
 				{
@@ -329,6 +786,8 @@ namespace Marvel {
 					// check if call succeeded
 					if (!result.isOk())
 						PyErr_Print();
+					else
+						mvScheduleCoroutine(result);
 
 
 				}
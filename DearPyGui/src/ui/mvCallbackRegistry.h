@@ -1,11 +1,20 @@
 #pragma once
 
 #include <mutex>
+#include <chrono>
+#include <map>
+#include <deque>
+#include <memory>
+#include <string>
+#include <unordered_map>
+#include <condition_variable>
 #include "mvThreadPool.h"
 #include "mvContext.h"
 
 namespace Marvel {
 
+	class mvAppItem;
+
 	mv_internal PyObject* SanitizeCallback(PyObject* callback)
 	{
 		if (callback == Py_None)
@@ -14,18 +23,123 @@ namespace Marvel {
 		return callback;
 	}
 
+	// enqueue to call latency of submitted callbacks (get_callback_statistics),
+	// guarded by statisticsMutex, callback workers write it too
+	struct mvCallbackStatistics
+	{
+		u64 calls = 0u;
+		u64 batches = 0u;      // GIL acquisitions of the callback thread
+		f64 latency = 0.0;     // total, seconds
+		f64 maxLatency = 0.0;
+	};
+
+	mv_internal constexpr size_t CallbackRingSize = 4096; // records, overflow goes through calls
+	mv_internal constexpr i32    CallbackRecordValues = 4; // widget value components kept in a record
+
+	// app data of a callback record, built on the callback thread
+	enum mvCallbackData
+	{
+		mvCallbackData_None = 0,
+		mvCallbackData_Object,        // appData
+		mvCallbackData_Int,           // code
+		mvCallbackData_IntFloat,      // [code, x]
+		mvCallbackData_IntFloatFloat, // [code, x, y]
+		mvCallbackData_FloatPair,     // (x, y)
+		mvCallbackData_Item,          // item
+		mvCallbackData_IntItem,       // (code, item)
+		mvCallbackData_Bool,          // code != 0
+		mvCallbackData_Float,         // values[0]
+		mvCallbackData_FloatList,     // values[0..count] (colors too)
+		mvCallbackData_IntList        // values[0..count]
+	};
+
+	// fixed size callback, queued without allocating: an item sender's callback,
+	// alias and user data are read when it runs (like the lambdas capturing this),
+	// otherwise callable, senderId and userData are used
+	struct mvCallbackRecord
+	{
+		mvAppItem*     sender = nullptr;
+		PyObject*      callable = nullptr;
+		mvUUID         senderId = 0;
+		PyObject*      userData = nullptr;
+		mvCallbackData data = mvCallbackData_None;
+		PyObject*      appData = nullptr;
+		mvAppItem*     item = nullptr;
+		i32            code = 0;
+		f32            x = 0.0f;
+		f32            y = 0.0f;
+		f64            values[CallbackRecordValues] = {};
+		i32            count = 0;
+		b8             coalesced = false; // runs the newest record for (senderId, key)
+		mvUUID         key = 0;
+		u64            sequence = 0;      // submission order, shared with calls
+		std::chrono::steady_clock::time_point queued;
+	};
+
+	// generic callback, stamped from the same sequence as records
+	struct mvQueuedCall
+	{
+		u64               sequence = 0;
+		mvUUID            sender = 0; // routed like a record of this sender, 0 never is
+		mvFunctionWrapper call;
+	};
+
+	// newest pending call of a coalesced sender and key
+	struct mvCoalescedCall
+	{
+		mvFunctionWrapper call;
+		mvCallbackRecord  record;
+		b8                isRecord = false;
+	};
+
+	using mvCoalescedMap = std::map<std::pair<mvUUID, mvUUID>, mvCoalescedCall>;
+
+	// callbacks of items routed to a named lane (set_callback_lane) run one at
+	// a time, in order, on the callback workers; lanes run concurrently
+	mv_internal constexpr i32 CallbackLaneParallel = -1; // any worker, no ordering
+
+	struct mvCallbackLane
+	{
+		std::mutex                    mutex;
+		std::deque<mvFunctionWrapper> pending;
+		b8                            scheduled = false; // a worker is draining it
+	};
+
 	struct mvCallbackRegistry
 	{
-		const i32 maxNumberOfCalls = 50;
+		mvQueue<mvFunctionWrapper>     tasks;
+		mvQueue<mvQueuedCall>          calls;
+		mvRingQueue<mvCallbackRecord>  records{ CallbackRingSize };
+		std::atomic<u64>               sequence = 0; // next record or call, they run in this order
+		std::mutex                     signalMutex; // wakes the callback thread
+		std::condition_variable        signal;
+		mvMPSCQueue<mvFunctionWrapper> commands; // deferred python commands (render thread)
+		std::atomic<b8>                running = false;
+		std::atomic<i32>               callCount = 0;      // queue depth
+		std::atomic<u64>               droppedCalls = 0;   // past IO.callbackQueueLimit
+		std::atomic<u64>               coalescedCalls = 0; // replaced by a newer call
+		mvCallbackStatistics           statistics;
+		std::mutex                     statisticsMutex; // callback workers record too
+
+		// callback workers (configure_app callback_workers), created and
+		// resized by the callback thread, only used for routed items
+		mvThreadPool*                                   workers = nullptr;
+		i32                                             workerCount = 0;
+		std::mutex                                      laneMutex;
+		std::unordered_map<mvUUID, i32>                 senderLanes; // lane index or CallbackLaneParallel
+		std::unordered_map<std::string, i32>            laneNames;
+		std::vector<std::unique_ptr<mvCallbackLane>>    lanes;
 
-		mvQueue<mvFunctionWrapper> tasks;
-		mvQueue<mvFunctionWrapper> calls;
-		std::atomic<b8>            running = false;
-		std::atomic<i32>           callCount = 0;
+		// newest pending call per sender and key (see mvSubmitCoalescedCallback),
+		// nodes of finished bursts are reused by records instead of freed
+		std::mutex                             coalesceMutex;
+		mvCoalescedMap                         coalesced;
+		std::vector<mvCoalescedMap::node_type> coalescedNodes;
 
 		// callbacks
 		PyObject* resizeCallback = nullptr;
 		PyObject* onCloseCallback = nullptr;
+		PyObject* eventLoop = nullptr; // coroutine callbacks (set_callback_event_loop)
 
 		i32 highestFrame = 0;
 		std::unordered_map<i32, PyObject*> frameCallbacks;
@@ -33,11 +147,43 @@ namespace Marvel {
 
 	void mvFrameCallback(i32 frame);
 	void mvRunTasks();
+	void mvRunCommands();
 	void mvRunCallback(PyObject* callback, mvUUID sender, PyObject* app_data, PyObject* user_data);
 	void mvRunCallback(PyObject* callback, const std::string& sender, PyObject* app_data, PyObject* user_data);
 	void mvAddCallback(PyObject* callback, mvUUID sender, PyObject* app_data, PyObject* user_data);
 	void mvAddCallback(PyObject* callback, const std::string& sender, PyObject* app_data, PyObject* user_data);
 	bool mvRunCallbacks();
+	void mvRecordCallbackLatency(std::chrono::steady_clock::time_point queued);
+	void mvRunCoalescedCallback(mvUUID sender, mvUUID key);
+	void mvRunCallbackRecord(const mvCallbackRecord& record);
+	void mvPushCallback(mvFunctionWrapper call, mvUUID sender = 0); // generic path, wakes the callback thread
+	void mvSetCallbackLane(mvUUID sender, const std::string& lane, b8 parallel); // empty and not parallel resets
+
+	// item sender, see mvCallbackRecord
+	mvCallbackRecord mvItemCallbackRecord(mvAppItem* sender);
+
+	// item sender with its value as app data (Int, Bool: code)
+	mvCallbackRecord mvItemCallbackRecord(mvAppItem* sender, mvCallbackData data, i32 code);
+
+	// item sender with its value as app data (Float, FloatList, IntList), at
+	// most CallbackRecordValues components
+	template<typename T>
+	mvCallbackRecord mvItemCallbackRecord(mvAppItem* sender, mvCallbackData data, const T* values, i32 count)
+	{
+		mvCallbackRecord record = mvItemCallbackRecord(sender);
+		record.data = data;
+		record.count = count < CallbackRecordValues ? count : CallbackRecordValues;
+		for (i32 i = 0; i < record.count; i++)
+			record.values[i] = (f64)values[i];
+		return record;
+	}
+
+	// ring path for records, same queue limit and statistics as mvSubmitCallback
+	b8   mvSubmitCallbackRecord(const mvCallbackRecord& record); // false when dropped
+	void mvSubmitCoalescedCallbackRecord(mvUUID sender, mvUUID key, const mvCallbackRecord& record);
+
+	// true (and counted as dropped) once configure_app's callback_queue_limit is reached
+	b8   mvCallbackQueueFull();
 
 
 	template<typename F, typename ...Args>
@@ -56,24 +202,71 @@ namespace Marvel {
 		return res;
 	}
 
+	// queues a python command to be applied by the render thread (with the GIL)
+	template<typename F>
+	void mvSubmitCommand(F f)
+	{
+		GContext->callbackRegistry->commands.push(mvFunctionWrapper(std::move(f)));
+	}
+
+	// sender routes the call like that item's records (set_callback_lane)
 	template<typename F, typename ...Args>
-	std::future<typename std::invoke_result<F, Args...>::type> mvSubmitCallback(F f)
+	std::future<typename std::invoke_result<F, Args...>::type> mvSubmitCallback(F f, mvUUID sender = 0)
 	{
 
-		if (GContext->callbackRegistry->callCount > GContext->callbackRegistry->maxNumberOfCalls)
-		{
+		if (mvCallbackQueueFull())
 			return {};
-		}
 
 		GContext->callbackRegistry->callCount++;
 
 		typedef typename std::invoke_result<F, Args...>::type result_type;
-		std::packaged_task<result_type()> task(std::move(f));
+		auto queued = std::chrono::steady_clock::now();
+		std::packaged_task<result_type()> task([f = std::move(f), queued]() mutable
+			{
+				mvRecordCallbackLatency(queued);
+				return f();
+			});
 		std::future<result_type> res(task.get_future());
 
-		GContext->callbackRegistry->calls.push(std::move(task));
+		mvPushCallback(std::move(task), sender);
 
 		return res;
 	}
 
+	// continuous events (value changes while dragging, mouse moves, held keys,
+	// hover) keep only their newest call while one is queued: sender and key
+	// (item, key code, button) identify calls that replace each other, so
+	// they can't flood the queue and discrete events are never crowded out
+	template<typename F>
+	void mvSubmitCoalescedCallback(mvUUID sender, mvUUID key, F f)
+	{
+		mvCallbackRegistry& registry = *GContext->callbackRegistry;
+
+		if (!GContext->IO.callbackCoalescing)
+		{
+			mvSubmitCallback(std::move(f));
+			return;
+		}
+
+		{
+			std::lock_guard<std::mutex> lock(registry.coalesceMutex);
+			auto found = registry.coalesced.find({ sender, key });
+			if (found != registry.coalesced.end())
+			{
+				// the queued call runs this one instead
+				found->second.call = mvFunctionWrapper(std::move(f));
+				registry.coalescedCalls++;
+				return;
+			}
+			registry.coalesced[{ sender, key }].call = mvFunctionWrapper(std::move(f));
+		}
+
+		auto queued = mvSubmitCallback([sender, key]() { mvRunCoalescedCallback(sender, key); });
+		if (!queued.valid())
+		{
+			std::lock_guard<std::mutex> lock(registry.coalesceMutex);
+			registry.coalesced.erase({ sender, key });
+		}
+	}
+
 }
@@ -0,0 +1,830 @@
+import os
+import sys
+import time
+import array
+import subprocess
+import asyncio
+import threading
+import dearpygui.dearpygui as dpg
+try:
+    import dearpygui.aio as dpg_aio
+except ImportError:
+    # baseline builds (DPG_BASELINE) may predate it
+    dpg_aio = None
+
+# Simple timing harness, not part of the unit tests.
+#   run: python benchmarks.py [bench_name ...]
+#   DPG_BASELINE=<dir holding an older dearpygui package> also times the
+#   benchmarks that compare kernels against that build
+
+def timeit(label, func, repeat=5):
+    best = None
+    for _ in range(repeat):
+        start = time.perf_counter()
+        func()
+        elapsed = time.perf_counter() - start
+        best = elapsed if best is None else min(best, elapsed)
+    print(f"{label:<50} {best*1000.0:10.3f} ms")
+    return best
+
+def bench_item_lookup():
+
+    # lookup cost should stay flat as the item tree grows
+    for count in (1_000, 10_000, 50_000):
+
+        dpg.create_context()
+
+        items = []
+        with dpg.window():
+            for i in range(count // 100):
+                with dpg.group():
+                    for j in range(100):
+                        items.append(dpg.add_button())
+
+        targets = items[::max(1, len(items) // 2000)]
+
+        def lookups():
+            for item in targets:
+                dpg.get_value(item)
+
+        timeit(f"get_value x{len(targets)} ({count} items)", lookups)
+
+        dpg.destroy_context()
+
+def bench_batch_set_values():
+
+    # per-call overhead vs one batched call
+    dpg.create_context()
+
+    with dpg.window():
+        items = [dpg.add_progress_bar() for _ in range(5_000)]
+    values = [float(i % 100)/100.0 for i in range(len(items))]
+
+    def single():
+        for item, value in zip(items, values):
+            dpg.set_value(item, value)
+
+    def batched():
+        dpg.set_values(items, values)
+
+    timeit(f"set_value x{len(items)}", single)
+    timeit(f"set_values ({len(items)} items, list)", batched)
+
+    try:
+        import array
+        buffer = array.array('f', values)
+        timeit(f"set_values ({len(items)} items, buffer)", lambda: dpg.set_values(items, buffer))
+    except ImportError:
+        pass
+
+    dpg.destroy_context()
+
+def run_baseline(bench):
+
+    # same benchmark in a child interpreter importing the baseline build,
+    # its rows are tagged with the build
+    baseline = os.environ.get("DPG_BASELINE")
+    if not baseline:
+        print(f"{bench}: set DPG_BASELINE to compare against a baseline build")
+        return
+    env = dict(os.environ, DPG_BENCH_BUILD="baseline")
+    env.pop("DPG_BASELINE")
+    env["PYTHONPATH"] = os.pathsep.join(filter(None, (baseline, env.get("PYTHONPATH"))))
+    subprocess.run([sys.executable, os.path.abspath(__file__), bench], env=env, check=False)
+
+def bench_buffer_conversion():
+
+    # buffer and sequence conversion for every array format code, the kernels
+    # themselves are compared by rerunning this in a baseline build (DPG_BASELINE)
+    build = os.environ.get("DPG_BENCH_BUILD", "this build")
+    dpg.create_context()
+
+    count = 1_000_000
+    source = [i % 251 for i in range(count)]
+
+    with dpg.texture_registry():
+        texture = dpg.add_dynamic_texture(500, 500, [0.0]*count)
+
+    with dpg.window():
+        with dpg.plot():
+            dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                series = dpg.add_line_series([], [])
+
+    # series values are converted as x and y, so twice per call
+    for code in "bBhHiIlLqQfd":
+        values = array.array(code, source)
+        # formats the baseline build doesn't read fail there, skip them
+        try:
+            dpg.set_value(series, [values, values])
+            dpg.set_value(texture, values)
+        except Exception:
+            print(f"'{code}' buffers: unsupported ({build})")
+            continue
+        timeit(f"to double ('{code}' buffer, 2x{count}, {build})", lambda: dpg.set_value(series, [values, values]))
+        timeit(f"to float ('{code}' buffer, {count}, {build})", lambda: dpg.set_value(texture, values))
+
+    values = [float(v) for v in source]
+    packed = tuple(values)
+    timeit(f"to double (list, 2x{count}, {build})", lambda: dpg.set_value(series, [values, values]))
+    timeit(f"to double (tuple, 2x{count}, {build})", lambda: dpg.set_value(series, [packed, packed]))
+    timeit(f"to float (list, {count}, {build})", lambda: dpg.set_value(texture, values))
+
+    dpg.destroy_context()
+
+    if build == "this build":
+        run_baseline("bench_buffer_conversion")
+
+def bench_series_set_value():
+
+    # copying vs referencing series buffers
+    try:
+        import numpy as np
+    except ImportError:
+        return
+
+    dpg.create_context()
+
+    count = 1_000_000
+    x = np.arange(count, dtype=np.float64)
+    y = np.sin(x*0.001)
+
+    with dpg.window():
+        with dpg.plot():
+            dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                copied = dpg.add_line_series(x, y)
+                referenced = dpg.add_line_series(x, y, zero_copy=True)
+
+    timeit(f"line series set_value ({count} points, copy)", lambda: dpg.set_value(copied, [x, y]))
+    timeit(f"line series set_value ({count} points, zero_copy)", lambda: dpg.set_value(referenced, [x, y]))
+
+    dpg.destroy_context()
+
+def bench_series_append():
+
+    # streaming one sample per call: ring buffer append vs resending the window
+    dpg.create_context()
+
+    capacity = 10_000
+    xs = [float(i) for i in range(capacity)]
+    ys = [0.0]*capacity
+
+    with dpg.window():
+        with dpg.plot():
+            dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                resent = dpg.add_line_series(xs, ys)
+                ring = dpg.add_line_series(xs, ys, capacity=capacity)
+
+    timeit(f"line series set_value ({capacity} point window)", lambda: dpg.set_value(resent, [xs, ys]))
+    timeit(f"line series append_series_data ({capacity} capacity)", lambda: dpg.append_series_data(ring, 1.0, 1.0))
+
+    dpg.destroy_context()
+
+def bench_series_downsample(frames=60):
+
+    # frame time with a few million points, plotted as is vs downsampled
+    dpg.create_context()
+
+    count = 5_000_000
+    xs = [i*0.001 for i in range(count)]
+    ys = [(i % 1000)*0.001 for i in range(count)]
+
+    with dpg.window(width=800, height=600):
+        with dpg.plot(width=-1, height=-1):
+            dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                series = dpg.add_line_series(xs, ys)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+
+    for mode, label in ((dpg.mvPlotDownsample_None, "none"), (dpg.mvPlotDownsample_MinMax, "minmax"), (dpg.mvPlotDownsample_LTTB, "lttb")):
+        dpg.configure_item(series, downsample=mode)
+        timeit(f"line series frame ({count} points, {label})", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_series_culling(frames=60):
+
+    # zoomed in on a long sorted history, only the visible range is submitted
+    dpg.create_context()
+
+    count = 5_000_000
+    xs = [i*0.001 for i in range(count)]
+    ys = [(i % 1000)*0.001 for i in range(count)]
+
+    with dpg.window(width=800, height=600):
+        with dpg.plot(width=-1, height=-1):
+            x_axis = dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                dpg.add_line_series(xs, ys, sorted_x=True)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+
+    for visible in (1.0, 0.01, 0.0001):
+        dpg.set_axis_limits(x_axis, 0.0, xs[-1]*visible)
+        timeit(f"line series frame ({count} points, {visible*100.0:g}% visible)", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_series_lod(frames=60):
+
+    # zoomed out on a long sorted history, the pyramid replaces most samples
+    dpg.create_context()
+
+    count = 5_000_000
+    xs = [i*0.001 for i in range(count)]
+    ys = [(i % 1000)*0.001 for i in range(count)]
+
+    with dpg.window(width=800, height=600):
+        with dpg.plot(width=-1, height=-1):
+            x_axis = dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                series = dpg.add_line_series(xs, ys, sorted_x=True)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.set_axis_limits(x_axis, 0.0, xs[-1])
+
+    dpg.render_dearpygui_frame()
+    timeit(f"line series frame ({count} points)", dpg.render_dearpygui_frame, repeat=frames)
+
+    # let the background build finish
+    dpg.configure_item(series, lod=True)
+    while dpg.get_item_info(series)["lod_memory"] == 0:
+        dpg.render_dearpygui_frame()
+    print(f"lod memory: {dpg.get_item_info(series)['lod_memory']} bytes")
+    timeit(f"line series frame ({count} points, lod)", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_heat_series(frames=30):
+
+    # one quad per cell vs a single textured quad
+    dpg.create_context()
+
+    rows = cols = 1000
+    values = [((r*cols + c) % 997)/997.0 for r in range(rows) for c in range(cols)]
+
+    with dpg.window(width=800, height=600):
+        with dpg.plot(width=-1, height=-1):
+            dpg.add_plot_axis(dpg.mvXAxis)
+            with dpg.plot_axis(dpg.mvYAxis):
+                series = dpg.add_heat_series(values, rows, cols, format="")
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+
+    for use_texture in (False, True):
+        dpg.configure_item(series, use_texture=use_texture)
+        dpg.render_dearpygui_frame()
+        timeit(f"heat series frame ({rows}x{cols}, use_texture={use_texture})", dpg.render_dearpygui_frame, repeat=frames)
+
+    # recolorize every frame
+    def change_scale():
+        dpg.configure_item(series, scale_max=dpg.get_item_configuration(series)["scale_max"] + 0.001)
+        dpg.render_dearpygui_frame()
+    timeit(f"heat series frame ({rows}x{cols}, use_texture=True, scale changed)", change_scale, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_table_data(rows=1000000, columns=10, frames=60):
+
+    # one row/cell item per cell vs columnar data formatted when visible
+    dpg.create_context()
+
+    data = [array.array('d', (float(r*columns + c) for r in range(rows))) for c in range(columns)]
+
+    with dpg.window(width=800, height=600) as window:
+        with dpg.table(scrollY=True, height=-1) as table:
+            for _ in range(columns):
+                dpg.add_table_column()
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+
+    timeit(f"table set_table_data ({rows}x{columns})", lambda: dpg.set_table_data(table, data), repeat=3)
+    dpg.render_dearpygui_frame()
+    timeit(f"table data frame ({rows}x{columns})", dpg.render_dearpygui_frame, repeat=frames)
+
+    # item based table, a fraction of the rows is already far slower to build
+    item_rows = rows // 100
+    def build_items():
+        with dpg.table(parent=window, clipper=True) as items:
+            for _ in range(columns):
+                dpg.add_table_column()
+            for r in range(item_rows):
+                with dpg.table_row():
+                    for c in range(columns):
+                        dpg.add_text(str(data[c][r]))
+        dpg.delete_item(items)
+    timeit(f"table row items build ({item_rows}x{columns})", build_items, repeat=3)
+
+    dpg.destroy_context()
+
+def bench_table_sort(rows=1000000, frames=10):
+
+    # built-in sort and cached filter on a data-backed table
+    dpg.create_context()
+
+    keys = array.array('d', (float((r * 7919) % 100003) for r in range(rows)))
+    names = [f"row {(r * 31) % 1000}" for r in range(rows)]
+
+    with dpg.window(width=800, height=600):
+        with dpg.table(scrollY=True, height=-1, sortable=True, sort_multi=True, native_sort=True) as table:
+            dpg.add_table_column(default_sort=True)
+            dpg.add_table_column()
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.set_table_data(table, [keys, names])
+
+    # setting the data again forces a sort on the next frame
+    def resort():
+        dpg.set_table_data(table, [keys, names])
+        dpg.render_dearpygui_frame()
+    timeit(f"table native sort ({rows} rows)", resort, repeat=frames)
+    timeit(f"table sorted frame ({rows} rows)", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.set_value(table, "row 42")
+    dpg.render_dearpygui_frame()
+    timeit(f"table filtered frame ({rows} rows)", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_dynamic_texture(frames=30):
+
+    # a static 1080p float texture is only uploaded when its value changes
+    dpg.create_context()
+
+    width, height = 1920, 1080
+    data = array.array('f', [0.5]) * (width * height * 4)
+
+    with dpg.texture_registry():
+        texture = dpg.add_dynamic_texture(width, height, data)
+
+    with dpg.window(width=800, height=600):
+        dpg.add_image(texture)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    timeit(f"dynamic texture frame ({width}x{height}, unchanged)", dpg.render_dearpygui_frame, repeat=frames)
+
+    def change():
+        dpg.set_value(texture, data)
+        dpg.render_dearpygui_frame()
+    timeit(f"dynamic texture frame ({width}x{height}, set_value)", change, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_texture_formats(frames=30):
+
+    # the same 1080p frame streamed as float32 and as rgba8
+    dpg.create_context()
+
+    width, height = 1920, 1080
+    floats = array.array('f', [0.5]) * (width * height * 4)
+    bytes8 = bytearray([128]) * (width * height * 4)
+
+    with dpg.texture_registry():
+        float_texture = dpg.add_dynamic_texture(width, height, floats)
+        byte_texture = dpg.add_dynamic_texture(width, height, bytes8, format=dpg.mvFormat_Byte_rgba)
+
+    with dpg.window(width=800, height=600):
+        dpg.add_image(float_texture)
+        dpg.add_image(byte_texture)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    def stream(texture, data):
+        def frame():
+            dpg.set_value(texture, data)
+            dpg.render_dearpygui_frame()
+        return frame
+
+    timeit(f"texture frame ({width}x{height}, float rgba)", stream(float_texture, floats), repeat=frames)
+    timeit(f"texture frame ({width}x{height}, byte rgba)", stream(byte_texture, bytes8), repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_texture_regions(frames=30):
+
+    # a 1080p texture, whole frame versus a strip of new rows
+    dpg.create_context()
+
+    width, height = 1920, 1080
+    frame = bytearray([128]) * (width * height * 4)
+    rows = bytearray([255]) * (width * 8 * 4)
+
+    with dpg.texture_registry():
+        texture = dpg.add_dynamic_texture(width, height, frame, format=dpg.mvFormat_Byte_rgba)
+
+    with dpg.window(width=800, height=600):
+        dpg.add_image(texture)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    def whole():
+        dpg.set_value(texture, frame)
+        dpg.render_dearpygui_frame()
+
+    def region():
+        dpg.set_texture_region(texture, 0, 0, width, 8, rows)
+        dpg.render_dearpygui_frame()
+
+    def scroll():
+        dpg.push_texture_rows(texture, rows)
+        dpg.render_dearpygui_frame()
+
+    timeit(f"texture set_value ({width}x{height})", whole, repeat=frames)
+    timeit(f"texture set_texture_region ({width}x8)", region, repeat=frames)
+    timeit(f"texture push_texture_rows ({width}x8)", scroll, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_streaming_textures(frames=60):
+
+    # a new 1080p frame every frame, one pixel buffer versus a ring of them
+    # (software GL: LIBGL_ALWAYS_SOFTWARE=1 python benchmarks.py)
+    dpg.create_context()
+
+    width, height = 1920, 1080
+    frames_data = [bytearray([value]) * (width * height * 4) for value in (64, 192)]
+
+    with dpg.texture_registry():
+        single = dpg.add_dynamic_texture(width, height, frames_data[0], format=dpg.mvFormat_Byte_rgba)
+        ring = dpg.add_dynamic_texture(width, height, frames_data[0], format=dpg.mvFormat_Byte_rgba, streaming=True)
+
+    with dpg.window(width=800, height=600):
+        dpg.add_image(single, width=400, height=225)
+        dpg.add_image(ring, width=400, height=225)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    def stream(texture):
+        def run():
+            for i in range(frames):
+                dpg.set_value(texture, frames_data[i % 2])
+                dpg.render_dearpygui_frame()
+        return run
+
+    timeit(f"stream {frames} frames ({width}x{height}, one buffer)", stream(single), repeat=3)
+    timeit(f"stream {frames} frames ({width}x{height}, buffer ring)", stream(ring), repeat=3)
+
+    dpg.destroy_context()
+
+def bench_load_image_async(count=500, size=128):
+
+    # thumbnails decoded on the calling thread versus on the decode threads
+    import os
+    import tempfile
+
+    directory = tempfile.mkdtemp()
+    files = []
+    for i in range(count):
+        path = os.path.join(directory, f"thumb{i}.ppm")
+        with open(path, "wb") as file:
+            file.write(f"P6 {size} {size} 255\n".encode() + bytes([i % 256]) * (size * size * 3))
+        files.append(path)
+
+    dpg.create_context()
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+
+    def blocking():
+        for path in files:
+            dpg.load_image(path)
+
+    def asynchronous():
+        done = threading.Semaphore(0)
+        for path in files:
+            dpg.load_image_async(path, lambda s, a, u: done.release())
+        for _ in files:
+            done.acquire()
+
+    timeit(f"load_image x{count} ({size}x{size})", blocking, repeat=3)
+    timeit(f"load_image_async x{count} ({size}x{size})", asynchronous, repeat=3)
+
+    dpg.destroy_context()
+    for path in files:
+        os.remove(path)
+    os.rmdir(directory)
+
+def bench_texture_atlas(count=300, size=24, frames=60):
+
+    # a toolbar of small icons, a texture each versus packed into pages
+    # (draw calls: Tools > Show Metrics)
+    icon = [0.5] * (size * size * 4)
+
+    for atlas in (False, True):
+        dpg.create_context()
+
+        with dpg.texture_registry(atlas=atlas):
+            textures = [dpg.add_static_texture(size, size, icon) for _ in range(count)]
+
+        with dpg.window(width=800, height=600):
+            with dpg.group(horizontal=True):
+                for texture in textures:
+                    dpg.add_image_button(texture)
+
+        dpg.create_viewport(width=800, height=600)
+        dpg.setup_dearpygui()
+        dpg.render_dearpygui_frame()
+
+        timeit(f"{count} icons, atlas={atlas}", dpg.render_dearpygui_frame, repeat=frames)
+
+        dpg.destroy_context()
+
+def bench_callback_batching(count=40, frames=120):
+
+    # bursts of callbacks every frame (visible handlers), the callback thread
+    # releasing the GIL after each one versus draining the queue in one hold
+    for batch in (1, 64):
+        dpg.create_context()
+        dpg.configure_app(callback_batch=batch)
+
+        with dpg.item_handler_registry() as handlers:
+            dpg.add_item_visible_handler(callback=lambda: None)
+
+        with dpg.window(width=800, height=600):
+            for _ in range(count):
+                dpg.bind_item_handler_registry(dpg.add_text("burst"), handlers)
+
+        dpg.create_viewport(width=800, height=600)
+        dpg.setup_dearpygui()
+        dpg.render_dearpygui_frame()
+        dpg.get_callback_statistics(reset=True)
+
+        timeit(f"{count} callbacks per frame, callback_batch={batch}", dpg.render_dearpygui_frame, repeat=frames)
+
+        time.sleep(0.5)
+        statistics = dpg.get_callback_statistics()
+        calls = max(statistics["calls"], 1)
+        print(f"    {statistics['calls']} calls in {statistics['batches']} batches ({calls / max(statistics['batches'], 1):.1f} per GIL hold), "
+              f"latency mean {statistics['latency_mean']*1000.0:.3f} ms, max {statistics['latency_max']*1000.0:.3f} ms")
+
+        dpg.destroy_context()
+
+def bench_callback_coalescing(count=200, frames=120):
+
+    # more per frame callbacks (visible handlers) than the callback thread
+    # keeps up with: the old fixed cap of 50 versus coalescing
+    for limit, coalescing in ((50, False), (0, True)):
+        dpg.create_context()
+        dpg.configure_app(callback_queue_limit=limit, callback_coalescing=coalescing)
+
+        def slow():
+            time.sleep(0.0005)
+
+        with dpg.item_handler_registry() as handlers:
+            dpg.add_item_visible_handler(callback=slow)
+
+        with dpg.window(width=800, height=600):
+            for _ in range(count):
+                dpg.bind_item_handler_registry(dpg.add_text("burst"), handlers)
+
+        dpg.create_viewport(width=800, height=600)
+        dpg.setup_dearpygui()
+        dpg.render_dearpygui_frame()
+        dpg.get_callback_statistics(reset=True)
+
+        timeit(f"{count} callbacks per frame, limit={limit} coalescing={coalescing}", dpg.render_dearpygui_frame, repeat=frames)
+
+        statistics = dpg.get_callback_statistics()
+        print(f"    queue depth {statistics['queue_depth']}, {statistics['calls']} calls, "
+              f"{statistics['coalesced']} coalesced, {statistics['dropped']} dropped, "
+              f"latency max {statistics['latency_max']*1000.0:.3f} ms")
+
+        dpg.destroy_context()
+
+def bench_callback_records(count=2000, frames=120):
+
+    # submission cost on the render thread: every visible handler call is a
+    # fixed size record, nothing coalesced
+    dpg.create_context()
+    dpg.configure_app(callback_coalescing=False)
+
+    with dpg.item_handler_registry() as handlers:
+        dpg.add_item_visible_handler(callback=lambda: None)
+
+    with dpg.window(width=800, height=600):
+        for _ in range(count):
+            dpg.bind_item_handler_registry(dpg.add_text("record"), handlers)
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+    dpg.get_callback_statistics(reset=True)
+
+    start = time.perf_counter()
+    timeit(f"{count} callback records per frame", dpg.render_dearpygui_frame, repeat=frames)
+    time.sleep(0.5)
+    statistics = dpg.get_callback_statistics()
+    print(f"    {statistics['calls'] / (time.perf_counter() - start):10.0f} calls/s, {statistics['dropped']} dropped")
+
+    dpg.destroy_context()
+
+def bench_lazy_item_state(count=20000, frames=60):
+
+    # a large tree nobody queries or binds handlers to, with and without
+    # lazy interaction state
+    for lazy in (False, True):
+        dpg.create_context()
+        dpg.configure_app(lazy_item_state=lazy)
+
+        with dpg.window(width=800, height=600):
+            for i in range(count // 100):
+                with dpg.group():
+                    for j in range(50):
+                        dpg.add_button(label="button")
+                        dpg.add_text("text")
+
+        dpg.create_viewport(width=800, height=600)
+        dpg.setup_dearpygui()
+
+        # new items report state for their first frames
+        for _ in range(61):
+            dpg.render_dearpygui_frame()
+
+        timeit(f"{count} widgets, lazy_item_state={lazy}", dpg.render_dearpygui_frame, repeat=frames)
+
+        dpg.destroy_context()
+
+def bench_handler_dispatch(count=500, frames=120):
+
+    # many global handlers on frames without input
+    dpg.create_context()
+
+    with dpg.handler_registry():
+        for i in range(count):
+            dpg.add_key_down_handler(key=i % 512)
+            dpg.add_key_press_handler()
+            dpg.add_mouse_drag_handler(button=i % 3)
+            dpg.add_mouse_move_handler()
+
+    with dpg.window():
+        dpg.add_text("idle")
+
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    timeit(f"{count*4} global handlers, no input", dpg.render_dearpygui_frame, repeat=frames)
+
+    dpg.destroy_context()
+
+def bench_callback_workers(count=32, frames=30, workers=4):
+
+    # callbacks waiting on I/O (sleeping releases the GIL), all on the
+    # callback thread and spread over the callback workers
+    for routed in (False, True):
+        dpg.create_context()
+        dpg.configure_app(callback_coalescing=False, callback_workers=workers if routed else 0)
+
+        with dpg.item_handler_registry() as handlers:
+            handler = dpg.add_item_visible_handler(callback=lambda: time.sleep(0.001))
+        if routed:
+            dpg.set_callback_lane(handler, parallel=True)
+
+        with dpg.window(width=800, height=600):
+            for _ in range(count):
+                dpg.bind_item_handler_registry(dpg.add_text("io"), handlers)
+
+        dpg.create_viewport(width=800, height=600)
+        dpg.setup_dearpygui()
+        dpg.render_dearpygui_frame()
+        time.sleep(0.5)
+        dpg.get_callback_statistics(reset=True)
+
+        start = time.perf_counter()
+        for _ in range(frames):
+            dpg.render_dearpygui_frame()
+        while dpg.get_callback_statistics()["calls"] < count * frames and time.perf_counter() - start < 30.0:
+            time.sleep(0.01)
+        print(f"{workers if routed else 0} callback workers: {time.perf_counter() - start:.3f}s for {count * frames} sleeping callbacks")
+
+        dpg.destroy_context()
+
+def bench_frame_wakeup(frames=120):
+
+    # render, then wait for a waiter to see the frame: woken by Render()
+    # on a thread (wait_for_frame) and on an event loop (aio.until_frame)
+    dpg.create_context()
+    dpg.create_viewport(width=800, height=600)
+    dpg.setup_dearpygui()
+    dpg.render_dearpygui_frame()
+
+    acknowledged = threading.Semaphore(0)
+
+    def thread_waiter(frame):
+        for _ in range(frames):
+            frame = dpg.wait_for_frame(frame=frame + 1)
+            acknowledged.release()
+
+    async def loop_waiter(frame):
+        for _ in range(frames):
+            frame = await dpg_aio.until_frame(frame + 1)
+            acknowledged.release()
+
+    def lockstep():
+        for _ in range(frames):
+            dpg.render_dearpygui_frame()
+            acknowledged.acquire()
+
+    for label, target in (("thread", thread_waiter), ("event loop", lambda frame: asyncio.run(loop_waiter(frame)))):
+        waiter = threading.Thread(target=target, args=(dpg.wait_for_frame(frame=0),))
+        waiter.start()
+        timeit(f"{frames} frames, {label} waiter", lockstep, repeat=1)
+        waiter.join()
+
+    dpg.destroy_context()
+
+def bench_threaded_set_value(deferred, threads=4, seconds=2.0):
+
+    # worker threads hammer set_value while the main thread renders
+    dpg.create_context()
+    dpg.configure_app(deferred_updates=deferred)
+
+    with dpg.window():
+        items = [dpg.add_slider_float() for _ in range(100)]
+
+    dpg.create_viewport()
+    dpg.setup_dearpygui()
+
+    done = threading.Event()
+    counts = [0]*threads
+
+    def worker(index):
+        i = 0
+        while not done.is_set():
+            dpg.set_value(items[i % len(items)], float(i % 100))
+            i += 1
+        counts[index] = i
+
+    workers = [threading.Thread(target=worker, args=(i,)) for i in range(threads)]
+    for worker_thread in workers:
+        worker_thread.start()
+
+    frames = 0
+    worst = 0.0
+    start = time.perf_counter()
+    while time.perf_counter() - start < seconds:
+        frame_start = time.perf_counter()
+        dpg.render_dearpygui_frame()
+        worst = max(worst, time.perf_counter() - frame_start)
+        frames += 1
+
+    done.set()
+    for worker_thread in workers:
+        worker_thread.join()
+
+    dpg.destroy_context()
+
+    elapsed = time.perf_counter() - start
+    label = "deferred" if deferred else "immediate"
+    print(f"set_value x{threads} threads ({label})".ljust(50)
+          + f" {sum(counts)/elapsed:10.0f} calls/s {frames/elapsed:8.1f} fps {worst*1000.0:8.3f} ms worst frame")
+
+if __name__ == '__main__':
+    if len(sys.argv) > 1:
+        for name in sys.argv[1:]:
+            globals()[name]()
+        sys.exit(0)
+
+    bench_item_lookup()
+    bench_batch_set_values()
+    bench_buffer_conversion()
+    bench_series_set_value()
+    bench_series_append()
+    bench_series_downsample()
+    bench_series_culling()
+    bench_series_lod()
+    bench_heat_series()
+    bench_table_data()
+    bench_table_sort()
+    bench_dynamic_texture()
+    bench_texture_formats()
+    bench_texture_regions()
+    bench_streaming_textures()
+    bench_load_image_async()
+    bench_texture_atlas()
+    bench_callback_batching()
+    bench_callback_coalescing()
+    bench_callback_records()
+    bench_lazy_item_state()
+    bench_handler_dispatch()
+    bench_callback_workers()
+    bench_frame_wakeup()
+    bench_threaded_set_value(deferred=False)
+    bench_threaded_set_value(deferred=True)
@@ -1,5 +1,11 @@
 import unittest
+import asyncio
+import os
+import sys
+import threading
+import time
 import dearpygui.dearpygui as dpg
+import dearpygui.aio as dpg_aio
 
 class TestSimple(unittest.TestCase):
 
@@ -21,6 +27,23 @@ def tearDown(self):
         dpg.stop_dearpygui()
         dpg.destroy_context()
 
+    def wait_for_callbacks(self, timeout=5.0):
+
+        deadline = time.time() + timeout
+        while dpg.get_callback_statistics()["queue_depth"] > 0 and time.time() < deadline:
+            time.sleep(0.01)
+
+    def render_frames(self, count=1):
+
+        # rendering needs a shown viewport, which needs a display
+        if not dpg.is_viewport_ok():
+            if sys.platform.startswith("linux") and not (os.environ.get("DISPLAY") or os.environ.get("WAYLAND_DISPLAY")):
+                self.skipTest("rendering needs a display")
+            dpg.create_viewport(width=400, height=400)
+            dpg.show_viewport()
+        for _ in range(count):
+            dpg.render_dearpygui_frame()
+
     def test_moving_items(self):
 
         children = dpg.get_item_children(self.window_id, 1)
@@ -47,6 +70,591 @@ def test_moving_items(self):
 
 
 
+    def test_batch_values(self):
+
+        with dpg.window():
+            sliders = [dpg.add_slider_float() for _ in range(3)]
+            checkbox = dpg.add_checkbox()
+            text = dpg.add_input_text()
+
+        dpg.set_values(sliders + [checkbox], [1.0, 2.0, 3.0, True])
+        self.assertEqual(dpg.get_values(sliders + [checkbox]), [1.0, 2.0, 3.0, True])
+
+        dpg.set_values([text], ["hello"])
+        self.assertEqual(dpg.get_value(text), "hello")
+
+        dpg.configure_items([self.item1, self.item2], label="same")
+        self.assertEqual(dpg.get_item_label(self.item1), "same")
+        self.assertEqual(dpg.get_item_label(self.item2), "same")
+
+        dpg.configure_items([self.item1, self.item2], [{"label": "a"}, {"label": "b"}])
+        self.assertEqual(dpg.get_item_label(self.item1), "a")
+        self.assertEqual(dpg.get_item_label(self.item2), "b")
+
+        # keywords are shared, configs[i] wins where both set a key
+        dpg.configure_items([self.item1, self.item2], [{"label": "c"}, {}], label="d", show=False)
+        self.assertEqual(dpg.get_item_label(self.item1), "c")
+        self.assertEqual(dpg.get_item_label(self.item2), "d")
+        self.assertFalse(dpg.is_item_shown(self.item1))
+        self.assertFalse(dpg.is_item_shown(self.item2))
+
+        with self.assertRaises(Exception):
+            dpg.configure_items([self.item1, self.item2], [{"label": "e"}, "f"])
+        self.assertEqual(dpg.get_item_label(self.item1), "c")
+
+    def test_zero_copy_series(self):
+
+        import array
+        x = array.array('d', [0.0, 1.0, 2.0])
+        y = array.array('d', [3.0, 4.0, 5.0])
+
+        with dpg.window():
+            with dpg.plot():
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    referenced = dpg.add_line_series(x, y, zero_copy=True)
+                    mixed = dpg.add_line_series(x, array.array('f', [3.0, 4.0, 5.0]), zero_copy=True)
+
+        # buffers are referenced, not copied
+        value = dpg.get_value(referenced)
+        self.assertIs(value[0], x)
+        self.assertIs(value[1], y)
+
+        # mismatched types fall back to a copy
+        value = dpg.get_value(mixed)
+        self.assertEqual(value[0], [0.0, 1.0, 2.0])
+        self.assertEqual(value[1], [3.0, 4.0, 5.0])
+
+    def test_append_series_data(self):
+
+        with dpg.window():
+            with dpg.plot():
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    series = dpg.add_line_series([], [], capacity=3)
+
+        dpg.append_series_data(series, 0.0, 10.0)
+        dpg.append_series_data(series, [1.0, 2.0, 3.0, 4.0], [11.0, 12.0, 13.0, 14.0])
+
+        # oldest samples are overwritten, values come back oldest first
+        value = dpg.get_value(series)
+        self.assertEqual(value[0], [2.0, 3.0, 4.0])
+        self.assertEqual(value[1], [12.0, 13.0, 14.0])
+
+    def test_series_downsample(self):
+
+        with dpg.window():
+            with dpg.plot():
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    series = dpg.add_line_series([0.0, 1.0, 2.0], [0.0, 1.0, 0.0], downsample=dpg.mvPlotDownsample_LTTB)
+
+        # decimation and culling only affect drawing, the stored data is untouched
+        dpg.configure_item(series, sorted_x=True)
+        self.assertEqual(dpg.get_item_configuration(series)["downsample"], dpg.mvPlotDownsample_LTTB)
+        self.assertTrue(dpg.get_item_configuration(series)["sorted_x"])
+        self.assertEqual(dpg.get_value(series)[0], [0.0, 1.0, 2.0])
+
+    def test_series_lod(self):
+
+        count = 1 << 17
+        with dpg.window(width=400, height=400):
+            with dpg.plot(width=300, height=300):
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    series = dpg.add_line_series([float(i) for i in range(count)], [float(i % 100) for i in range(count)], lod=True)
+
+        # the pyramid is built on the thread pool after the first draw
+        for _ in range(200):
+            self.render_frames()
+            if dpg.get_item_info(series)["lod_levels"] > 0:
+                break
+            time.sleep(0.01)
+
+        info = dpg.get_item_info(series)
+        self.assertGreater(info["lod_levels"], 0)
+        self.assertLess(info["lod_memory"], count * 16) # all levels, smaller than the x/y input
+
+        # appends extend it
+        dpg.append_series_data(series, [float(count), float(count + 1)], [0.0, 1.0])
+        self.assertEqual(len(dpg.get_value(series)[0]), count + 2)
+        self.assertGreater(dpg.get_item_info(series)["lod_levels"], 0)
+
+    def test_heat_series_texture(self):
+
+        with dpg.window():
+            with dpg.plot():
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    series = dpg.add_heat_series([0.0, 0.5, 1.0, 0.25], 2, 2, use_texture=True)
+
+        self.assertTrue(dpg.get_item_configuration(series)["use_texture"])
+        dpg.configure_item(series, use_texture=False)
+        self.assertFalse(dpg.get_item_configuration(series)["use_texture"])
+
+        # two color qualitative maps, so every cell is exactly one of them
+        red, blue, green, white = [1.0, 0.0, 0.0, 1.0], [0.0, 0.0, 1.0, 1.0], [0.0, 1.0, 0.0, 1.0], [1.0, 1.0, 1.0, 1.0]
+        with dpg.colormap_registry():
+            red_blue = dpg.add_colormap([[255, 0, 0, 255], [0, 0, 255, 255]], True)
+            green_white = dpg.add_colormap([[0, 255, 0, 255], [255, 255, 255, 255]], True)
+
+        with dpg.window():
+            with dpg.plot() as plot:
+                dpg.add_plot_axis(dpg.mvXAxis)
+                with dpg.plot_axis(dpg.mvYAxis):
+                    series = dpg.add_heat_series([0.0, 1.0, 1.0, 0.0], 2, 2, scale_min=0.0, scale_max=1.0, use_texture=True)
+        dpg.bind_colormap(plot, red_blue)
+
+        def texels():
+            self.render_frames(2)
+            return dpg.get_texture_pixels(series)
+
+        self.assertEqual(texels(), red + blue + blue + red)
+        self.assertTrue(dpg.get_item_state(series)["ok"])
+
+        # data
+        dpg.set_value(series, [[1.0, 0.0, 0.0, 1.0]])
+        self.assertEqual(dpg.get_value(series)[0], [1.0, 0.0, 0.0, 1.0])
+        self.assertEqual(texels(), blue + red + red + blue)
+
+        # scale, every value is now below it
+        dpg.configure_item(series, scale_min=2.0, scale_max=3.0)
+        self.assertEqual(dpg.get_item_configuration(series)["scale_min"], 2.0)
+        self.assertEqual(dpg.get_item_configuration(series)["scale_max"], 3.0)
+        self.assertEqual(texels(), red * 4)
+
+        # colormap
+        dpg.bind_colormap(plot, green_white)
+        self.assertEqual(texels(), green * 4)
+        dpg.configure_item(series, scale_min=0.0, scale_max=1.0)
+        self.assertEqual(texels(), white + green + green + white)
+
+        # resizing recreates the texture
+        dpg.configure_item(series, rows=1, cols=2)
+        self.assertEqual(dpg.get_item_configuration(series)["rows"], 1)
+        self.assertEqual(texels(), white + green)
+        self.assertTrue(dpg.get_item_state(series)["ok"])
+
+    def test_table_data(self):
+
+        import array
+
+        with dpg.window():
+            with dpg.table() as table:
+                dpg.add_table_column()
+                dpg.add_table_column()
+                dpg.add_table_column()
+
+        # buffers are referenced, lists copied
+        dpg.set_table_data(table, [array.array('d', [0.5, 1.5]), [1, 2], ["a", "b"]], formats=["%.2f"])
+        self.assertEqual(dpg.get_table_data(table), [["0.50", "1.50"], ["1", "2"], ["a", "b"]])
+        dpg.set_table_data(table, [])
+        self.assertEqual(dpg.get_table_data(table), [])
+        self.assertEqual(len(dpg.get_item_children(table, 1)), 0)
+
+        # a text cell anywhere makes the column text, non-sequences raise
+        dpg.set_table_data(table, [[1, 2.5, "n/a"], [1, 2, 10**400]])
+        self.assertEqual(dpg.get_table_data(table), [["1", "2.5", "n/a"], ["1", "2", str(10**400)]])
+        with self.assertRaises(Exception):
+            dpg.set_table_data(table, [5])
+        self.assertEqual(dpg.get_table_data(table), [])
+
+    def test_table_native_sort(self):
+
+        cells = []
+        with dpg.window():
+            with dpg.table(sortable=True, native_sort=True) as table:
+                dpg.add_table_column(sort_key=dpg.mvTable_SortKeyNumber)
+                for value in ("10", "9", "11"):
+                    with dpg.table_row(filter_key=value):
+                        cells.append(dpg.add_text(value))
+
+        # cell values top to bottom, as drawn
+        def drawn_order():
+            self.render_frames(2)
+            return [dpg.get_value(cell) for cell in sorted(cells, key=lambda cell: dpg.get_item_state(cell)["rect_min"][1])]
+
+        # rows stay where they are, only the drawing order changes
+        self.assertTrue(dpg.get_item_configuration(table)["native_sort"])
+        self.assertEqual(dpg.get_item_configuration(dpg.get_item_children(table, 0)[0])["sort_key"], dpg.mvTable_SortKeyNumber)
+        self.assertEqual(drawn_order(), ["9", "10", "11"])
+        self.assertEqual(dpg.get_item_children(table, 1), [dpg.get_item_parent(cell) for cell in cells])
+
+        # edits and moved rows are resorted
+        dpg.set_value(cells[1], "12")
+        self.assertEqual(drawn_order(), ["10", "11", "12"])
+        dpg.move_item_down(dpg.get_item_parent(cells[0]))
+        self.assertEqual(drawn_order(), ["10", "11", "12"])
+
+        # the filter applies to the sorted rows
+        dpg.set_value(table, "1")
+        self.assertEqual(len(dpg.get_item_children(table, 1)), 3)
+        self.assertEqual(drawn_order()[0], "10")
+
+    def test_dynamic_texture_source(self):
+
+        with dpg.value_registry():
+            value = dpg.add_float_vect_value(default_value=[0.0]*16)
+
+        with dpg.texture_registry():
+            texture = dpg.add_dynamic_texture(2, 2, [0.0]*16)
+        dpg.configure_item(texture, source=value)
+
+        # uploads follow changes made through the source
+        dpg.set_value(value, [1.0]*16)
+        self.assertEqual(dpg.get_value(texture), [1.0]*16)
+
+    def test_texture_formats(self):
+
+        with dpg.texture_registry():
+            rgba8 = dpg.add_dynamic_texture(2, 2, bytearray(range(16)), format=dpg.mvFormat_Byte_rgba)
+            gray = dpg.add_static_texture(2, 1, [0.0, 1.0], format=dpg.mvFormat_Byte_r)
+            mixed = dpg.add_static_texture(3, 1, [0, 0.5, 1], format=dpg.mvFormat_Byte_r)
+            half = dpg.add_dynamic_texture(1, 1, [0.5, 0.25, 1.0, 2.0], format=dpg.mvFormat_Half_rgba)
+
+        # bytes are kept as is, floats are 0.0-1.0, halves round trip
+        self.assertEqual(dpg.get_value(rgba8), list(range(16)))
+        self.assertEqual(dpg.get_value(gray), [0, 255])
+        self.assertEqual(dpg.get_value(mixed), [0, 128, 255])
+        self.assertEqual(dpg.get_value(half), [0.5, 0.25, 1.0, 2.0])
+        self.assertEqual(dpg.get_item_configuration(rgba8)["format"], dpg.mvFormat_Byte_rgba)
+
+    def test_texture_regions(self):
+
+        with dpg.texture_registry():
+            texture = dpg.add_dynamic_texture(2, 2, bytearray(16), format=dpg.mvFormat_Byte_rgba)
+
+        dpg.set_texture_region(texture, 1, 0, 1, 2, bytearray([255]) * 8)
+        self.assertEqual(dpg.get_value(texture), [0, 0, 0, 0, 255, 255, 255, 255] * 2)
+
+        # rows wrap around the cursor
+        dpg.push_texture_rows(texture, bytearray([7]) * 24)
+        self.assertEqual(dpg.get_value(texture), [7] * 16)
+
+        # raw buffers too short for the texture are never written
+        short = bytearray(8)
+        with dpg.texture_registry():
+            raw = dpg.add_raw_texture(2, 2, short, format=dpg.mvFormat_Byte_rgba)
+        with self.assertRaises(Exception):
+            dpg.set_texture_region(raw, 0, 0, 2, 2, bytearray([255]) * 16)
+        with self.assertRaises(Exception):
+            dpg.push_texture_rows(raw, bytearray([255]) * 8)
+        self.assertEqual(short, bytearray(8))
+
+    def test_streaming_textures(self):
+
+        with dpg.texture_registry():
+            dynamic = dpg.add_dynamic_texture(1, 1, [1.0, 1.0, 1.0, 1.0], streaming=True)
+            other = dpg.add_dynamic_texture(1, 1, [1.0, 1.0, 1.0, 1.0])
+
+        self.assertTrue(dpg.get_item_configuration(dynamic)["streaming"])
+        self.assertFalse(dpg.get_item_configuration(other)["streaming"])
+
+        # every frame cycles through the pixel buffers, what the gpu holds
+        # must be the latest upload and not a stale or half written one
+        with dpg.texture_registry():
+            texture = dpg.add_dynamic_texture(2, 1, bytearray(8), format=dpg.mvFormat_Byte_rgba, streaming=True)
+        self.render_frames(1)
+
+        for frame in range(5):
+            pixels = [(frame * 8 + i) % 256 for i in range(8)]
+            dpg.set_value(texture, pixels)
+            self.render_frames(1)
+            self.assertEqual(dpg.get_texture_pixels(texture), pixels)
+
+    def test_load_image_async(self):
+
+        import os
+        import tempfile
+        import threading
+
+        # 2x1 binary ppm
+        with tempfile.NamedTemporaryFile(suffix=".ppm", delete=False) as file:
+            file.write(b"P6 2 1 255\n" + bytes([255, 0, 0, 0, 255, 0]))
+
+        loaded = threading.Event()
+        results = []
+        def on_load(sender, app_data, user_data):
+            results.append((app_data, user_data))
+            loaded.set()
+
+        dpg.load_image_async(file.name, on_load, format=dpg.mvFormat_Byte_rgba, user_data="thumb")
+        self.assertTrue(loaded.wait(5.0))
+        os.remove(file.name)
+
+        (width, height, channels, data), user_data = results[0]
+        self.assertEqual((width, height, channels, user_data), (2, 1, 4, "thumb"))
+        self.assertEqual(list(data), [255, 0, 0, 255, 0, 255, 0, 255])
+
+    def test_texture_atlas(self):
+
+        with dpg.texture_registry(atlas=True, atlas_page_size=256) as registry:
+            icon = dpg.add_static_texture(2, 1, [1.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0])
+
+        config = dpg.get_item_configuration(registry)
+        self.assertTrue(config["atlas"])
+        self.assertEqual(config["atlas_page_size"], 256)
+        self.assertEqual(dpg.get_value(icon), [1.0, 0.0, 0.0, 1.0, 0.0, 1.0, 0.0, 1.0])
+
+        other = dpg.add_static_texture(4, 2, [1.0]*32, parent=registry)
+        large = dpg.add_static_texture(512, 1, [1.0]*2048, parent=registry)
+
+        # packed on the first draw, each into its own rect of a page
+        self.render_frames()
+        rects = []
+        for texture, width, height in ((icon, 2, 1), (other, 4, 2)):
+            config = dpg.get_item_configuration(texture)
+            uv_min, uv_max = config["atlas_uv_min"], config["atlas_uv_max"]
+            self.assertAlmostEqual(uv_max[0] - uv_min[0], width / 256)
+            self.assertAlmostEqual(uv_max[1] - uv_min[1], height / 256)
+            self.assertGreater(uv_min[0], 0.0) # inside the border
+            self.assertGreater(uv_min[1], 0.0)
+            rects.append((uv_min, uv_max))
+        self.assertNotEqual(rects[0][0], rects[1][0])
+
+        # larger than a page, keeps its own texture
+        config = dpg.get_item_configuration(large)
+        self.assertEqual(list(config["atlas_uv_min"]), [0.0, 0.0])
+        self.assertEqual(list(config["atlas_uv_max"]), [1.0, 1.0])
+
+    def test_callback_batching(self):
+
+        dpg.configure_app(callback_batch=8)
+        self.assertEqual(dpg.get_app_configuration()["callback_batch"], 8)
+
+        # the first frame callback holds the callback thread while the
+        # others queue, they then run 8 per GIL hold
+        release = threading.Event()
+        ran = []
+
+        def on_frame(sender):
+            if not ran:
+                release.wait(5.0)
+            ran.append(sender)
+
+        first = dpg.get_frame_count() + 1
+        for frame in range(first, first + 10):
+            dpg.set_frame_callback(frame, on_frame)
+        self.wait_for_callbacks()
+        dpg.get_callback_statistics(reset=True)
+
+        self.render_frames(14)
+        release.set()
+        self.wait_for_callbacks()
+
+        statistics = dpg.get_callback_statistics()
+        self.assertEqual(len(ran), 10)
+        self.assertEqual(statistics["calls"], 10)
+        self.assertLessEqual(statistics["batches"], 3)
+        self.assertGreaterEqual(statistics["latency_max"], statistics["latency_mean"])
+
+    def test_callback_queue_policy(self):
+
+        dpg.configure_app(callback_queue_limit=100, callback_coalescing=False)
+        config = dpg.get_app_configuration()
+        self.assertEqual(config["callback_queue_limit"], 100)
+        self.assertFalse(config["callback_coalescing"])
+
+        statistics = dpg.get_callback_statistics()
+        for key in ("queue_depth", "coalesced", "dropped"):
+            self.assertIn(key, statistics)
+
+        dpg.configure_app(callback_queue_limit=0, callback_coalescing=True)
+
+        # a frame callback holds the callback thread, so everything after it
+        # stays queued while frames are rendered
+        started = threading.Event()
+        gate = threading.Event()
+        self.addCleanup(gate.set)
+        def hold():
+            started.set()
+            gate.wait(10.0)
+        dpg.set_frame_callback(dpg.get_frame_count() + 1, hold)
+        for _ in range(10):
+            self.render_frames(1)
+            if started.wait(0.1):
+                break
+        self.assertTrue(started.is_set())
+
+        ran = []
+        with dpg.item_handler_registry() as coalescing:
+            dpg.add_item_visible_handler(callback=lambda sender: ran.append("coalescing"))
+        with dpg.item_handler_registry() as dropping:
+            dpg.add_item_visible_handler(callback=lambda sender: ran.append("dropping"))
+
+        # visible every frame: once one call is queued, newer ones replace it
+        dpg.bind_item_handler_registry(self.item1, coalescing)
+        self.render_frames(2)
+        dpg.get_callback_statistics(reset=True)
+        self.render_frames(5)
+        statistics = dpg.get_callback_statistics()
+        self.assertEqual(statistics["coalesced"], 5)
+        self.assertEqual(statistics["dropped"], 0)
+        self.assertEqual(statistics["queue_depth"], 2)
+
+        # a full queue drops new senders, the queued one keeps coalescing
+        dpg.configure_app(callback_queue_limit=2)
+        dpg.bind_item_handler_registry(self.item2, dropping)
+        self.render_frames(2)
+        dpg.get_callback_statistics(reset=True)
+        self.render_frames(3)
+        statistics = dpg.get_callback_statistics(reset=True)
+        self.assertEqual(statistics["coalesced"], 3)
+        self.assertEqual(statistics["dropped"], 3)
+
+        gate.set()
+        self.wait_for_callbacks()
+        self.assertEqual(ran, ["coalescing"])
+        statistics = dpg.get_callback_statistics()
+        self.assertEqual((statistics["coalesced"], statistics["dropped"], statistics["queue_depth"]), (0, 0, 0))
+
+    def test_lazy_item_state(self):
+
+        self.assertFalse(dpg.get_app_configuration()["lazy_item_state"])
+        dpg.configure_app(lazy_item_state=True)
+        self.assertTrue(dpg.get_app_configuration()["lazy_item_state"])
+
+        with dpg.window():
+            polled = dpg.add_input_text()
+            unpolled = dpg.add_input_text()
+
+        # querying keeps reporting every applicable key
+        state = dpg.get_item_state(polled)
+        for key in ("hovered", "active", "clicked", "visible", "rect_size"):
+            self.assertIn(key, state)
+
+        # a polled item keeps capturing: focusing it makes it active
+        dpg.focus_item(polled)
+        self.render_frames(3)
+        if not dpg.get_item_state(polled)["active"]:
+            self.skipTest("the viewport has no keyboard focus")
+
+        # an unpolled one is skipped until it's queried
+        dpg.focus_item(unpolled)
+        self.render_frames(3)
+        state = dpg.get_item_state(unpolled)
+        self.assertTrue(state["visible"])
+        self.assertFalse(state["active"])
+        self.render_frames(2)
+        self.assertTrue(dpg.get_item_state(unpolled)["active"])
+
+    def test_indexed_handlers(self):
+
+        pressed = []
+        moved = []
+        with dpg.handler_registry():
+            key_handler = dpg.add_key_press_handler(key=65, callback=lambda sender, key: pressed.append(key))
+            dpg.add_key_down_handler(callback=lambda sender, key: pressed.append(key))
+            dpg.add_mouse_drag_handler(button=0, callback=lambda sender, drag: pressed.append(drag))
+            dpg.add_mouse_move_handler(callback=lambda sender, pos: moved.append(pos))
+
+        # reindexed after a key change
+        dpg.configure_item(key_handler, key=66)
+        self.render_frames(3)
+        self.assertEqual(dpg.get_item_configuration(key_handler)["key"], 66)
+
+        self.wait_for_callbacks()
+
+        # nothing is held, so only the move handler can fire: once the
+        # pointer is over the viewport (not on displays without focus)
+        self.assertEqual(pressed, [])
+        if not moved:
+            self.skipTest("the viewport never got the pointer")
+        self.assertEqual(len(moved[0]), 2)
+
+    def test_callback_records(self):
+
+        # frame callbacks go through the record ring, the first one holds
+        # the callback thread so the others are still queued
+        release = threading.Event()
+        ran = []
+
+        def on_frame(sender):
+            if not ran:
+                release.wait(5.0)
+            ran.append(sender)
+
+        first = dpg.get_frame_count() + 1
+        frames = list(range(first, first + 6))
+        for frame in frames:
+            dpg.set_frame_callback(frame, on_frame)
+        self.wait_for_callbacks()
+
+        self.render_frames(10)
+        depth = dpg.get_callback_statistics()["queue_depth"]
+        release.set()
+        self.wait_for_callbacks()
+
+        self.assertGreaterEqual(depth, len(frames) - 1)
+        self.assertEqual(ran, frames)
+
+    def test_callback_lanes(self):
+
+        dpg.configure_app(callback_workers=2)
+        self.assertEqual(dpg.get_app_configuration()["callback_workers"], 2)
+
+        # visible handlers run every frame, the thread that ran each is kept
+        threads = {}
+
+        def on_visible(sender):
+            threads[sender] = threading.get_ident()
+
+        reused = dpg.generate_uuid()
+        with dpg.item_handler_registry() as handlers:
+            routed = dpg.add_item_visible_handler(callback=on_visible)
+            dpg.add_item_visible_handler(callback=on_visible, tag="lane_handler")
+            dpg.add_item_visible_handler(callback=on_visible, tag=reused)
+            plain = dpg.add_item_visible_handler(callback=on_visible)
+        dpg.bind_item_handler_registry(self.item1, handlers)
+
+        dpg.set_callback_lane(routed, lane="io")
+        dpg.set_callback_lane("lane_handler", lane="io")
+        dpg.set_callback_lane(reused, parallel=True)
+        dpg.set_callback_lane(plain, lane="io")
+        dpg.set_callback_lane(plain)
+
+        self.render_frames(3)
+        self.wait_for_callbacks()
+        self.assertEqual(set(threads), {routed, "lane_handler", reused, plain})
+        for sender in (routed, "lane_handler", reused):
+            self.assertNotEqual(threads[sender], threads[plain])
+
+        # a deleted item's lane isn't inherited by a new item with its uuid
+        dpg.delete_item(reused)
+        dpg.add_item_visible_handler(callback=on_visible, tag=reused, parent=handlers)
+        threads.clear()
+        self.render_frames(3)
+        self.wait_for_callbacks()
+        self.assertEqual(threads[reused], threads[plain])
+
+        with self.assertRaises(Exception):
+            dpg.set_callback_lane(-1, lane="io")
+
+    def test_async_frames(self):
+
+        async def main():
+            dpg_aio.setup_event_loop()
+            ran = asyncio.Event()
+
+            async def on_frame():
+                await asyncio.sleep(0)
+                ran.set()
+
+            # coroutine callback, scheduled on this loop
+            dpg.set_frame_callback(dpg.get_frame_count() + 2, on_frame)
+
+            waiting = asyncio.ensure_future(dpg_aio.next_frame())
+            await asyncio.sleep(0)
+            self.render_frames(3)
+            rendered = await asyncio.wait_for(waiting, 5.0)
+            await asyncio.wait_for(ran.wait(), 5.0)
+            self.assertEqual(await dpg_aio.until_frame(rendered), dpg.wait_for_frame(frame=0))
+
+            dpg.set_callback_event_loop(None)
+            return rendered
+
+        self.assertGreater(asyncio.run(main()), 0)
+
     def test_zelete_items(self):
         
         children = dpg.get_item_children(self.window_id, 1)
@@ -133,6 +133,7 @@ def setup_package():
 
     shutil.copy(src_path + "/DearPyGui/dearpygui/demo.py", src_path + "/output/dearpygui")
     shutil.copy(src_path + "/DearPyGui/dearpygui/experimental.py", src_path + "/output/dearpygui")
+    shutil.copy(src_path + "/DearPyGui/dearpygui/aio.py", src_path + "/output/dearpygui")
 
     with open(src_path + "/output/dearpygui/__init__.py", 'w') as file:
         file.write("__version__='" + version_number() + "'\n")